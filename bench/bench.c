@@ -0,0 +1,471 @@
+/*
+ * This file contains the benchmark suite
+ * of the neural network library.It times
+ * the parsing,scaling,loading,predicting
+ * and training procedures on the bundled
+ * datasets and on larger synthetic shapes
+ * and writes the results as JSON lines.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard input output library,
+ * the standard utilities library,the standard
+ * assertions library,the string manipulation
+ * library,the unix standard symbolic constants
+ * library,the gsl random number generators and
+ * the header files of the dataset,the neural
+ * network,the quantised network,the training
+ * helpers and the telemetry that provides the
+ * monotonic clock.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <unistd.h>
+#include <gsl/gsl_rng.h>
+#include "dataset.h"
+#include "neural_utils.h"
+#include "neural_net.h"
+#include "neural_quant.h"
+#include "telemetry.h"
+
+
+
+
+/*
+ * Defining a new data structure called bench_shape_t
+ * that describes a dataset the benchmarks run on.A shape
+ * without a file is generated with a fixed seed,and a new
+ * data structure called bench_stats_t that holds the order
+ * statistics of the timed repetitions in seconds.
+ *
+ */
+
+typedef struct
+{
+    char                *name;          // The name of the shape in the results.
+    char                *file;          // The bundled dataset file,NULL for synthetic shapes.
+    size_t              rows;           // The number of rows of a synthetic shape.
+    llint               signals;        // The number of input signals.
+    llint               outputs;        // The number of desired output signals.
+    llint               hidden;         // The number of neurons of the hidden layer.
+    int                 type;           // The dataset type.
+} bench_shape_t;
+
+typedef struct
+{
+    double              min;            // The fastest repetition.
+    double              median;         // The median repetition.
+    double              p90;            // The 90th percentile.
+    double              p99;            // The 99th percentile.
+    double              mean;           // The arithmetic mean.
+} bench_stats_t;
+
+
+
+
+/*
+ * The shapes the benchmarks run on.The first ones are
+ * the bundled datasets,the last ones are synthetic shapes
+ * large enough to leave the caches of a single core.
+ *
+ */
+
+static bench_shape_t shapes[]=
+{
+    { "iris",           "iris.data",                0,      4,  3,  4,      DATASET_CLASSIFY },
+    { "thyroid",        "thyroid-train.data",       0,      5,  3,  20,     DATASET_CLASSIFY },
+    { "ann-thyroid",    "ann-thyroid-train.data",   0,      21, 3,  20,     DATASET_CLASSIFY },
+    { "sin",            "sin.data",                 0,      1,  1,  10,     DATASET_PREDICT  },
+    { "synthetic-wide", NULL,                       4096,   128,8,  128,    DATASET_CLASSIFY },
+    { "synthetic-tall", NULL,                       20000,  32, 4,  32,     DATASET_CLASSIFY },
+};
+
+
+
+
+/*
+ * The scaling functions of the datasets,the same
+ * min-max normalization the neuralnet program uses.
+ *
+ */
+
+static double bench_scaler(double min,double max,double x,double a,double b)
+{
+    return a*((x-min)/(max-min))-b;
+}
+
+static double bench_descaler(double min,double max,double x,double a,double b)
+{
+    return (((x+b)*(max-min))/a)+min;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n*log(n))     Where n is the number of repetitions.
+ *
+ * The static function stats_calculate() sorts the given repetition
+ * times and fills in their order statistics.Percentiles are taken
+ * with the nearest rank method.
+ *
+ */
+
+static int double_compare(const void *a,const void *b)
+{
+    double x=*(const double *)a,y=*(const double *)b;
+    return (x>y)-(x<y);
+}
+
+static void stats_calculate(double *samples,size_t n,bench_stats_t *st)
+{
+    size_t i; double sum=0.0;
+    qsort(samples,n,sizeof(double ),double_compare);
+    for (i=0;i<n;i++) { sum+=samples[i]; }
+    st->min=samples[0];
+    st->median=(n%2==1 ? samples[n/2] : (samples[n/2-1]+samples[n/2])/2.0);
+    st->p90=samples[(size_t )(0.90*(double )(n-1)+0.5)];
+    st->p99=samples[(size_t )(0.99*(double )(n-1)+0.5)];
+    st->mean=sum/(double )n;
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*c)      Where ( r x c ) are the dimensions
+ *                          of the generated dataset.
+ *
+ * The static function synthetic_write() writes a classification
+ * dataset of the given shape into a temporary file in the format
+ * of the bundled datasets.Every row belongs to the class whose
+ * centre is nearest,so the targets depend on the signals.
+ *
+ */
+
+static FILE *synthetic_write(bench_shape_t *sh)
+{
+    size_t i; llint j,c,best; double x,d,dmin;
+    FILE *f=tmpfile(); gsl_rng *r=NULL;
+    double *row=NULL;
+    assert(f!=NULL);
+    r=gsl_rng_alloc(gsl_rng_taus); gsl_rng_set(r,12345);
+    row=(double *)malloc(sh->signals*sizeof(double ));
+    assert(row!=NULL);
+
+    fprintf(f,"%zu\n%lld\n",sh->rows,sh->signals+sh->outputs);
+    for (i=0;i<sh->rows;i++)
+    {
+        for (j=0;j<sh->signals;j++) { row[j]=gsl_rng_uniform(r); fprintf(f,"%.6f ",row[j]); }
+        best=0; dmin=0.0;
+        for (c=0;c<sh->outputs;c++)
+        {
+            d=0.0;
+            for (j=0;j<sh->signals;j++) { x=row[j]-(double )((j+c)%sh->outputs)/(double )sh->outputs; d+=x*x; }
+            if (c==0 || d<dmin) { dmin=d; best=c; }
+        }
+        for (c=0;c<sh->outputs;c++) { fprintf(f,"%d%c",c==best,c+1==sh->outputs ? '\n' : ' '); }
+    }
+
+    free(row); gsl_rng_free(r);
+    rewind(f); return f;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function stats_print() writes the order statistics
+ * of a benchmark as a single JSON object per line.
+ *
+ */
+
+static void stats_print(FILE *out,char *benchmark,bench_shape_t *sh,dataset_t *ds,size_t warmup,size_t n,bench_stats_t *st)
+{
+    fprintf(out,"{\"benchmark\":\"%s\",\"shape\":\"%s\",\"rows\":%lld,\"columns\":%lld,\"warmup\":%zu,\"repetitions\":%zu,"
+            "\"min\":%.9g,\"median\":%.9g,\"p90\":%.9g,\"p99\":%.9g,\"mean\":%.9g}\n",
+            benchmark,sh->name,ds->rows,ds->columns,warmup,n,st->min,st->median,st->p90,st->p99,st->mean);
+    fflush(out);
+    fprintf(stderr,"%-12s %-16s median %12.6f ms   p90 %12.6f ms\n",benchmark,sh->name,st->median*1e3,st->p90*1e3);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*n)      Where r is the number of repetitions
+ *                          and n the number of rows of the dataset.
+ *
+ * The static function network_run() times neural_net_predict() over
+ * every row and then a single epoch of the back-propagation algorithm
+ * per repetition on the same session,under the two given names.
+ *
+ */
+
+static void network_run(FILE *out,bench_shape_t *sh,dataset_t *ds,neural_net_t *nn,char *predict,char *train,size_t warmup,size_t n,double *samples)
+{
+    size_t i; double t0; bench_stats_t st;
+    gsl_matrix *results=NULL; training_session_t session;
+
+    // Predicting: neural_net_predict() over every row.
+    gsl_matrix_view X=gsl_matrix_submatrix(ds->data,0,0,ds->rows,nn->config->signals);
+    for (i=0;i<warmup+n;i++)
+    {
+        t0=telemetry_clock(); results=neural_net_predict(nn,(gsl_matrix *)&X);
+        if (i>=warmup) { samples[i-warmup]=telemetry_clock()-t0; }
+        gsl_matrix_free(results);
+    }
+    stats_calculate(samples,n,&st); stats_print(out,predict,sh,ds,warmup,n,&st);
+
+    // Training: a single epoch of the back-propagation
+    // algorithm per repetition on the same session.
+    training_session_init(&session,nn,ds->data); session.quiet=1;
+    for (i=0;i<warmup+n;i++)
+    {
+        session.epochs=session.epoch+1;
+        t0=telemetry_clock(); backpropagation_session(nn,ds->data,&session);
+        if (i>=warmup) { samples[i-warmup]=telemetry_clock()-t0; }
+    }
+    stats_calculate(samples,n,&st); stats_print(out,train,sh,ds,warmup,n,&st);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(w+n)      Where w is the number of warmup and n the
+ *                          number of timed repetitions of every benchmark.
+ *
+ * The static function shape_run() runs the eight benchmarks on a single
+ * shape.Every repetition is prepared outside of the timed region,so only
+ * the benchmarked procedure itself is measured.
+ *
+ */
+
+static void shape_run(FILE *out,char *directory,bench_shape_t *sh,size_t warmup,size_t n)
+{
+    // Variable declarations.
+    size_t i; double t0,*samples=NULL;
+    char path[4096],dumpdir[]="/tmp/neuralbench.XXXXXX";
+    FILE *f=NULL; dataset_t *ds=NULL;
+    gsl_matrix *orig=NULL;
+    neural_config_t config,loaded;
+    neural_net_t *nn=NULL,*other=NULL;
+    neural_quant_t *nq=NULL; gsl_matrix *results=NULL;
+    gsl_matrix_view X; bench_stats_t st;
+    llint neurons[2];
+
+    samples=(double *)malloc(n*sizeof(double ));
+    assert(samples!=NULL);
+
+    // Opening the dataset file or generating the
+    // synthetic one.A missing file skips the shape.
+    if (sh->file!=NULL)
+    {
+        snprintf(path,sizeof(path),"%s/%s",directory,sh->file);
+        f=fopen(path,"r");
+        if (f==NULL) { fprintf(stderr,"Skipping %s,could not open %s.\n",sh->name,path); free(samples); return; }
+    } else { f=synthetic_write(sh); }
+
+    // Parsing: dataset_create() on the opened stream.
+    for (i=0;i<warmup+n;i++)
+    {
+        rewind(f); t0=telemetry_clock();
+        ds=dataset_create(f,sh->type,bench_scaler,bench_descaler);
+        if (i>=warmup) { samples[i-warmup]=telemetry_clock()-t0; }
+        if (i+1<warmup+n) { dataset_free(ds); }
+    } fclose(f);
+    stats_calculate(samples,n,&st); stats_print(out,"parse",sh,ds,warmup,n,&st);
+
+    // Scaling: dataset_scale() on a fresh copy of
+    // the parsed values every repetition.
+    orig=gsl_matrix_alloc(ds->data->size1,ds->data->size2);
+    gsl_matrix_memcpy(orig,ds->data);
+    for (i=0;i<warmup+n;i++)
+    {
+        gsl_matrix_memcpy(ds->data,orig);
+        if (ds->minimums!=NULL) { gsl_vector_free(ds->minimums); ds->minimums=NULL; }
+        if (ds->maximums!=NULL) { gsl_vector_free(ds->maximums); ds->maximums=NULL; }
+        t0=telemetry_clock(); dataset_scale(ds);
+        if (i>=warmup) { samples[i-warmup]=telemetry_clock()-t0; }
+    } gsl_matrix_free(orig);
+    stats_calculate(samples,n,&st); stats_print(out,"scale",sh,ds,warmup,n,&st);
+
+    // Creating the network every other benchmark uses,
+    // its weights drawn from a fixed seed so that runs
+    // can be compared with each other.
+    neurons[0]=sh->hidden; neurons[1]=sh->outputs;
+    config.nlayers=2; config.neurons=neurons;
+    config.signals=sh->signals+1; config.epsilon=0.0;
+    config.eta=0.5; config.momentum=0.009;
+    config.alpha=1.0; config.beta=0.0;
+    config.epochs=1; config.atype=ACTIVATION_LGST;
+    config.train=backpropagation; activation_assign(&config);
+    config.precision=PRECISION_F64; loaded.precision=PRECISION_F64; config.storage=STORAGE_NATIVE;
+    config.seed=12345;
+    nn=neural_net_create(&config);
+
+    // Loading: neural_net_load() from a dumping directory.
+    if (mkdtemp(dumpdir)!=NULL)
+    {
+        neural_net_dump(nn,dumpdir);
+        for (i=0;i<warmup+n;i++)
+        {
+            t0=telemetry_clock(); other=neural_net_load(&loaded,dumpdir);
+            if (i>=warmup) { samples[i-warmup]=telemetry_clock()-t0; }
+            neural_net_free(other); free(loaded.neurons);
+        }
+        snprintf(path,sizeof(path),"%s/config.bin",dumpdir); unlink(path);
+        snprintf(path,sizeof(path),"%s/weights.bin",dumpdir); unlink(path);
+        rmdir(dumpdir);
+        stats_calculate(samples,n,&st); stats_print(out,"load",sh,ds,warmup,n,&st);
+    }
+
+    // Predicting and training in double precision and
+    // then again with a single precision network.
+    network_run(out,sh,ds,nn,"predict","train_epoch",warmup,n,samples);
+
+    // Predicting with the int8 quantisation of the
+    // trained network,calibrated on every row.
+    nq=neural_quant_create(nn,ds->data);
+    X=gsl_matrix_submatrix(ds->data,0,0,ds->rows,config.signals);
+    for (i=0;i<warmup+n;i++)
+    {
+        t0=telemetry_clock(); results=neural_quant_predict(nq,&X.matrix);
+        if (i>=warmup) { samples[i-warmup]=telemetry_clock()-t0; }
+        gsl_matrix_free(results);
+    }
+    stats_calculate(samples,n,&st); stats_print(out,"predict_int8",sh,ds,warmup,n,&st);
+    neural_quant_free(nq); neural_net_free(nn);
+    config.precision=PRECISION_F32; nn=neural_net_create(&config);
+    network_run(out,sh,ds,nn,"predict_f32","train_epoch_f32",warmup,n,samples);
+
+    neural_net_free(nn); dataset_free(ds);
+    free(samples); return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(a*b)      Where a and b are the number of lines
+ *                          in the baseline and the current results.
+ *
+ * The static function results_compare() reads the medians of a baseline
+ * results file and of the current results file and prints the ratio of
+ * every benchmark found in both.A ratio above one is a slowdown.
+ *
+ */
+
+static int line_parse(char *line,char *key,double *median)
+{
+    char benchmark[64],shape[64]; char *m=NULL;
+    if (sscanf(line,"{\"benchmark\":\"%63[^\"]\",\"shape\":\"%63[^\"]\"",benchmark,shape)!=2) { return 0; }
+    if ((m=strstr(line,"\"median\":"))==NULL) { return 0; }
+    snprintf(key,160,"%s/%s",benchmark,shape);
+    *median=atof(m+9); return 1;
+}
+
+static void results_compare(char *baseline,char *current)
+{
+    char a[1024],b[1024],ka[160],kb[160];
+    double ma,mb; FILE *fa=NULL,*fb=NULL;
+    fa=fopen(baseline,"r"); fb=fopen(current,"r");
+    if (fa==NULL || fb==NULL) { fprintf(stderr,"Could not open the results to compare.\n"); exit(EXIT_FAILURE); }
+
+    fprintf(stderr,"\n%-30s %14s %14s %8s\n","benchmark","baseline ms","current ms","ratio");
+    while (fgets(b,sizeof(b),fb)!=NULL)
+    {
+        if (!line_parse(b,kb,&mb)) { continue; }
+        rewind(fa);
+        while (fgets(a,sizeof(a),fa)!=NULL)
+        {
+            if (!line_parse(a,ka,&ma) || strcmp(ka,kb)!=0) { continue; }
+            fprintf(stderr,"%-30s %14.6f %14.6f %8.3f\n",kb,ma*1e3,mb*1e3,ma>0.0 ? mb/ma : 0.0);
+            break;
+        }
+    } fclose(fa); fclose(fb);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function usage() prints the options of the benchmark
+ * executable into the standard error stream.
+ *
+ */
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "usage:\n"
+        "\n"
+        "       ./neuralbench [--out=<filepath>] [--compare=<filepath>] [--warmup=<number>] [--repetitions=<number>] [--datasets=<filepath>] [--only=<shape>]\n"
+        "\n"
+        "Available options:\n"
+        "   [--out=<filepath>]          The JSON lines results file,standard output by default.\n"
+        "   [--compare=<filepath>]      The results of an earlier run to compare the medians against.\n"
+        "   [--warmup=<number>]         The number of untimed repetitions of every benchmark,2 by default.\n"
+        "   [--repetitions=<number>]    The number of timed repetitions of every benchmark,15 by default.\n"
+        "   [--datasets=<filepath>]     The directory of the bundled datasets,datasets by default.\n"
+        "   [--only=<shape>]            Runs the benchmarks of a single shape.\n");
+    return;
+}
+
+
+
+
+int main(int argc,char *argv[])
+{
+    // Variable declarations and
+    // default option values.
+    size_t warmup=2,n=15,s; int i;
+    char *out=NULL,*compare=NULL,*only=NULL;
+    char *directory="datasets";
+    FILE *f=stdout;
+
+    // Reading the options in any order.
+    for (i=1;i<argc;i++)
+    {
+        if      (strncmp(argv[i],"--out=",6)==0)            { out=&argv[i][6]; }
+        else if (strncmp(argv[i],"--compare=",10)==0)       { compare=&argv[i][10]; }
+        else if (strncmp(argv[i],"--warmup=",9)==0)         { warmup=(size_t )atol(&argv[i][9]); }
+        else if (strncmp(argv[i],"--repetitions=",14)==0)   { n=(size_t )atol(&argv[i][14]); }
+        else if (strncmp(argv[i],"--datasets=",11)==0)      { directory=&argv[i][11]; }
+        else if (strncmp(argv[i],"--only=",7)==0)           { only=&argv[i][7]; }
+        else { usage(); exit(EXIT_FAILURE); }
+    }
+    if (n==0 || (compare!=NULL && out==NULL)) { usage(); exit(EXIT_FAILURE); }
+
+    // Running every shape and writing the results,
+    // then comparing them with the baseline if given.
+    if (out!=NULL && (f=fopen(out,"w"))==NULL) { fprintf(stderr,"Could not open %s.\n",out); exit(EXIT_FAILURE); }
+    for (s=0;s<sizeof(shapes)/sizeof(shapes[0]);s++)
+    {
+        if (only!=NULL && strcmp(only,shapes[s].name)!=0) { continue; }
+        shape_run(f,directory,&shapes[s],warmup,n);
+    }
+    if (f!=stdout) { fclose(f); }
+    if (compare!=NULL) { results_compare(compare,out); }
+    return 0;
+}
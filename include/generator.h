@@ -0,0 +1,103 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * synthetic dataset generator.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the generator.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+
+
+
+/*
+ * Including the standard input output library
+ * for the output stream of the generated rows
+ * and the neural_layer.h header file for the
+ * llint data type.
+ *
+ */
+
+#include <stdio.h>
+#include "neural_layer.h"
+
+
+
+
+/*
+ * Defining macros for the shapes of the generated
+ * datasets.The thyroid shape is a pattern classification
+ * dataset,the circle and sin shapes are curve fitting ones.
+ *
+ */
+
+#define GENERATE_THYROID    84      // Imbalanced classes of gaussian lab values.
+#define GENERATE_CIRCLE     67      // The upper half of a circle,or a hemisphere.
+#define GENERATE_SIN        83      // The sin of the mean of the signals.
+
+
+
+
+/*
+ * Defining a new data structure called generator_t
+ * that holds the settings of a generated dataset.The
+ * classes are only used by the classification shape,
+ * the curve fitting shapes have a single target column.
+ *
+ */
+
+typedef struct
+{
+    int                 shape;          // The shape of the generated dataset.
+    llint               rows;           // The number of generated rows.
+    llint               signals;        // The number of input signals per row.
+    llint               classes;        // The number of classes of the classification shape.
+    double              noise;          // The standard deviation of the noise,relative to the signal range.
+    unsigned long int   seed;           // The seed of the random number generator.
+} generator_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the synthetic dataset generator.
+ *
+ */
+
+llint               generator_columns(generator_t *g);
+llint               generator_write(FILE *f,generator_t *g);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro GENERATOR_H has been
+ * defined the generator.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
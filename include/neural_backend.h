@@ -0,0 +1,151 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * compute backends of the dense kernels and
+ * the autotuner that picks among them.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_backend.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_BACKEND_H
+#define NEURAL_BACKEND_H
+
+
+
+
+/*
+ * Including the neural_net.h header file
+ * that contains the neural network and
+ * the configuration data structures.
+ *
+ */
+
+#include "neural_net.h"
+
+
+
+
+/*
+ * Defining the constants of the autotuner.Every kernel is
+ * timed over about BACKEND_WORK multiply-adds per layer,the
+ * fastest of BACKEND_PASSES passes is kept,and the choices are
+ * cached into the file BACKEND_CACHE of the model directory,one
+ * line per host.
+ *
+ */
+
+#define BACKEND_WORK        (1<<16)         // The multiply-adds a kernel is timed over per layer.
+#define BACKEND_PASSES      3               // The number of timed passes per kernel.
+#define BACKEND_CACHE       "/backend.txt"  // The cache of the choices in the model directory.
+#define BACKEND_KERNELS     7               // The number of kernels of a backend.
+
+
+
+
+/*
+ * Defining the signatures of the dense kernels.All matrices
+ * are row major and ld is the distance between their rows:
+ *
+ *      DotFn       returns  x' * y,with the given strides.
+ *      GemvFn      stores   y = W * x,for a ( m x n ) W.
+ *      GemtvFn     stores   y = W' * x,for a ( m x n ) W.
+ *      GemmFn      stores   C = X * W',for a ( r x n ) X and a ( m x n ) W.
+ *      GerFn       adds     alpha * x * y' to a ( m x n ) W.
+ *      MomentumFn  stores   V = mu * V + alpha * x * y' and adds V to W.
+ *      ApplyFn     stores   y = f(x),the activation of the configuration.
+ *
+ * The last argument of GemmFn is a slot the caller keeps for the
+ * weights W across calls.A kernel that packs the weights leaves them
+ * there on the first call and reuses them on the rest,until the caller
+ * hands the slot to neural_backend_release().With a null slot they are
+ * packed on every call.
+ *
+ */
+
+typedef double      (*DotFn)(size_t n,const double *x,size_t incx,const double *y,size_t incy);
+typedef void        (*GemvFn)(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y);
+typedef void        (*GemmFn)(size_t r,size_t m,size_t n,const double *X,size_t ldx,const double *W,size_t ldw,double *C,size_t ldc,void **packed);
+typedef void        (*GemtvFn)(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y);
+typedef void        (*GerFn)(size_t m,size_t n,double alpha,const double *x,const double *y,size_t incy,double *W,size_t ldw);
+typedef void        (*MomentumFn)(size_t m,size_t n,double alpha,double mu,const double *x,const double *y,size_t incy,double *W,size_t ldw,double *V,size_t ldv);
+typedef void        (*ApplyFn)(neural_config_t *config,size_t n,const double *x,double *y);
+
+
+
+
+/*
+ * Defining a new data structure called neural_backend_t
+ * that holds an implementation of every dense kernel.The
+ * naive backend adds up every sum one term after the other,
+ * as the loops of the network always did,the cblas one calls
+ * the linked reference cblas,the simd one the in-tree register
+ * tiled kernels and the blas one the system BLAS found at build
+ * time,which is opened at runtime so that its symbols do not
+ * clash with the reference ones.A tuned backend takes every
+ * kernel from the backend that ran it fastest and names the
+ * chosen ones.
+ *
+ */
+
+typedef struct
+{
+    char                name[96];           // The name of the backend,or its kernels if tuned.
+    DotFn               dot;                // The dot product.
+    GemvFn              gemv;               // The matrix vector product.
+    GemtvFn             gemtv;              // The transposed matrix vector product.
+    GemmFn              gemm;               // The matrix matrix product.
+    GerFn               ger;                // The rank one update.
+    MomentumFn          momentum;           // The rank one update through a velocity.
+    ApplyFn             apply;              // The activation of a vector.
+} neural_backend_t;
+
+
+
+
+/*
+ * The dense loops of the network call the kernels of
+ * the global backend.Until neural_backend_use() switches
+ * it,it is made of the in-tree kernels that add up every
+ * sum in order,so the network computes exactly what it
+ * always did.
+ *
+ */
+
+extern neural_backend_t neural_backend;
+
+neural_backend_t    *neural_backend_find(char *name);
+void                neural_backend_use(neural_backend_t *backend);
+void                neural_backend_release(void *packed);
+void                neural_backend_tune(neural_net_t *nn,size_t rows,neural_backend_t *tuned);
+void                neural_backend_select(neural_net_t *nn,char *directory,size_t rows);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_BACKEND_H has been
+ * defined the neural_backend.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
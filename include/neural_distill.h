@@ -0,0 +1,109 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * distillation of a large teacher network
+ * into a small student network.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_distill.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_DISTILL_H
+#define NEURAL_DISTILL_H
+
+
+
+
+/*
+ * Including the dataset.h header file that
+ * contains the dataset data structure and the
+ * neural_eval.h header file that contains the
+ * neural network and the evaluation data structures.
+ *
+ */
+
+#include "dataset.h"
+#include "neural_eval.h"
+
+
+
+
+/*
+ * Defining the number of timed passes over the rows
+ * when the prediction speed of a teacher and of its
+ * student are measured.The fastest pass is kept,which
+ * filters out the passes disturbed by other processes.
+ *
+ */
+
+#define DISTILL_PASSES      5
+
+
+
+
+/*
+ * Defining a new data structure called distill_report_t
+ * that holds the comparison of a student network with
+ * the teacher it has been distilled from on a set of rows.
+ * The scores are only filled in when the rows hold the
+ * desired output signals.
+ *
+ */
+
+typedef struct
+{
+    size_t              rows;           // The number of compared rows.
+    int                 targets;        // Non-zero if the rows hold the desired output signals.
+    double              agreement;      // The fraction of rows whose strongest output signal is the same.
+    size_t              weights;        // The number of synaptic weights of the student.
+    size_t              teacher_weights;// The number of synaptic weights of the teacher.
+    double              seconds;        // The seconds the student takes to predict a row.
+    double              teacher_seconds;// The seconds the teacher takes to predict a row.
+    evaluation_t        teacher;        // The scores of the teacher.
+    evaluation_t        student;        // The scores of the student.
+} distill_report_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the distillation of a network such as labelling
+ * the training rows and comparing the student with
+ * its teacher.
+ *
+ */
+
+gsl_matrix          *neural_distill_label(neural_net_t *teacher,gsl_matrix *data,llint copies,double noise,unsigned long seed);
+void                neural_distill_compare(neural_net_t *student,neural_net_t *teacher,dataset_t *ds,distill_report_t *report);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_DISTILL_H has been
+ * defined the neural_distill.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
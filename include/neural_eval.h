@@ -0,0 +1,96 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * evaluation of trained neural networks on
+ * held-out data and via k-fold cross validation.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_eval.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_EVAL_H
+#define NEURAL_EVAL_H
+
+
+
+
+/*
+ * Including the dataset.h header file that contains
+ * the dataset data structure and the neural_net.h
+ * header file that contains the neural network and
+ * neural configuration data structures.
+ *
+ */
+
+#include "dataset.h"
+#include "neural_net.h"
+
+
+
+
+/*
+ * Defining a new data structure called evaluation_t that
+ * holds the scores of a neural network on a set of rows.
+ * For classification datasets the accuracy is the fraction
+ * of rows whose largest output signal matches the desired
+ * class.For curve fitting datasets the root mean square
+ * error is measured in the original units of the targets
+ * whenever the dataset has been normalized.
+ *
+ */
+
+typedef struct
+{
+    size_t              train_rows;             // The number of rows the network was trained on.
+    size_t              test_rows;              // The number of rows that were scored.
+    llint               correct;                // The number of correctly classified rows.
+    double              accuracy;               // The classification accuracy.
+    double              rmse;                   // The root mean square error.
+    llint               epochs;                 // The number of epochs the network was trained for.
+} evaluation_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the evaluation of neural networks such as
+ * scoring,permuting and cross validating.
+ *
+ */
+
+size_t              *evaluation_permutation(size_t n,unsigned long seed);
+void                evaluation_score(neural_net_t *nn,dataset_t *ds,size_t *index,size_t rows,evaluation_t *ev);
+evaluation_t        *cross_validation_run(neural_config_t *config,dataset_t *ds,gsl_matrix *targets,llint k,unsigned long seed);
+void                evaluation_aggregate(evaluation_t *folds,llint k,evaluation_t *mean,evaluation_t *stddev);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the 
+ * compiler and the macro NEURAL_EVAL_H has been
+ * defined the neural_eval.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
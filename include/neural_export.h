@@ -0,0 +1,83 @@
+/*
+ * This file contains function prototypings
+ * regarding the export of a trained neural
+ * network into standalone C source code.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_export.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_EXPORT_H
+#define NEURAL_EXPORT_H
+
+
+
+
+/*
+ * Including the standard input output library
+ * and the neural_net.h header file that contains
+ * the neural network data structure.
+ *
+ */
+
+#include <stdio.h>
+#include "neural_net.h"
+
+
+
+
+/*
+ * Defining the largest number of synaptic weights of
+ * a layer whose forward pass is unrolled into one
+ * statement per neuron,with a term per weight.Larger
+ * layers are exported as loops of constant bounds,which
+ * the compiler still specialises for the exact sizes.
+ *
+ */
+
+#define EXPORT_UNROLL       1024
+
+
+
+
+/*
+ * The exported source only depends on the standard
+ * mathematics library.The min max scaling of the input
+ * signals is folded into the weights and the biases of
+ * the first layer,so the exported predict function takes
+ * the raw input signals,and for curve fitting the output
+ * signals are descaled before they are returned.
+ *
+ */
+
+void                neural_export_c(neural_net_t *nn,gsl_vector *minimums,gsl_vector *maximums,int type,char *prefix,FILE *f);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_EXPORT_H has been
+ * defined the neural_export.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
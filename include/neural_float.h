@@ -0,0 +1,93 @@
+/*
+ * This file contains function prototypings
+ * regarding the single precision training
+ * and predicting procedures of the neural
+ * network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_float.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_FLOAT_H
+#define NEURAL_FLOAT_H
+
+
+
+
+/*
+ * Including the standard integer types library
+ * and the neural_utils.h header file that contains
+ * the neural network and training session data
+ * structures.
+ *
+ */
+
+#include <stdint.h>
+#include "neural_utils.h"
+
+
+
+
+/*
+ * A single precision network keeps its synaptic weights,
+ * velocities and scratch matrices in floats,which halves
+ * the memory the training and predicting procedures stream
+ * through.The dot products and the error sums are still
+ * accumulated in doubles.The training dataset is narrowed
+ * into a float copy once per training session.
+ *
+ */
+
+gsl_matrix_float    *neural_float_narrow(gsl_matrix *m);
+void                neural_float_forward(neural_net_t *nn,const float *x);
+gsl_matrix          *neural_float_activate(neural_net_t *nn,gsl_vector *signals);
+double              neural_float_epoch(neural_net_t *nn,gsl_matrix_float *data,training_session_t *ts);
+double              neural_float_error(neural_net_t *nn,gsl_matrix_float *data,size_t *index,size_t rows);
+
+
+
+/*
+ * The half precision formats only store synaptic weights.
+ * IEEE fp16 keeps 11 bits of mantissa and a range up to
+ * 65504,bf16 keeps the 8 bit exponent of a float and so
+ * its range,with 8 bits of mantissa.Both are narrowed
+ * from floats with rounding to the nearest even value
+ * and widened back exactly.
+ *
+ */
+
+uint16_t            neural_float_to_half(float value);
+float               neural_float_from_half(uint16_t half);
+uint16_t            neural_float_to_bfloat(float value);
+float               neural_float_from_bfloat(uint16_t half);
+void                neural_float_widen(int storage,const uint16_t *half,size_t n,double *w);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_FLOAT_H has been
+ * defined the neural_float.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * cache-blocked matrix multiply that serves
+ * the batched forward propagation.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_gemm.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_GEMM_H
+#define NEURAL_GEMM_H
+
+
+
+
+/*
+ * Including the standard definitions
+ * library for the size_t datatype.
+ *
+ */
+
+#include <stddef.h>
+
+
+
+
+/*
+ * Defining the tiling of the matrix multiply.A tile of
+ * GEMM_MR rows by GEMM_NR neurons is accumulated in registers,
+ * GEMM_KC synaptic weights of a neuron are consumed per pass,so
+ * that a packed panel of weights stays in the first level cache,
+ * and GEMM_MC rows of input signals are packed per block,so that
+ * they stay in the second level cache.
+ *
+ */
+
+#define GEMM_MR             4       // The rows of a register tile.
+#define GEMM_NR             4       // The neurons of a register tile.
+#define GEMM_KC             256     // The synaptic weights per pass over a panel.
+#define GEMM_MC             64      // The rows of a packed block of input signals.
+
+
+
+
+/*
+ * Defining a new data structure called gemm_panels_t that
+ * holds the synaptic weights matrix of a layer packed into
+ * panels of GEMM_NR neurons.Within a panel the weights of
+ * its neurons are interleaved,the i-th weight of every neuron
+ * side by side,and the last panel is padded with zeros.
+ *
+ */
+
+typedef struct
+{
+    size_t              neurons;        // The number of neurons,the rows of the weights matrix.
+    size_t              weights;        // The number of synaptic weights per neuron.
+    size_t              panels;         // The number of panels.
+    double              *data;          // The packed synaptic weights.
+} gemm_panels_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the packing of the synaptic weights and the
+ * multiplication of a block of input signals by them.
+ *
+ */
+
+gemm_panels_t       *neural_gemm_pack(const double *W,size_t neurons,size_t weights,size_t tda);
+void                neural_gemm(const double *X,size_t rows,size_t ldx,gemm_panels_t *P,double *C,size_t ldc);
+void                neural_gemm_free(gemm_panels_t *P);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_GEMM_H has been
+ * defined the neural_gemm.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -0,0 +1,131 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * half precision inference engine of the
+ * neural network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_half.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_HALF_H
+#define NEURAL_HALF_H
+
+
+
+
+/*
+ * Including the standard integer types library
+ * and the neural_net.h header file that contains
+ * the neural network and the configuration data
+ * structures.
+ *
+ */
+
+#include <stdint.h>
+#include "neural_net.h"
+
+
+
+
+/*
+ * Defining the number of synaptic weights that are
+ * widened into doubles at once.A tile of that many
+ * weights,whole rows of a layer,fits in the second
+ * level cache,and every tile costs a pass of packing
+ * over the batch of input signals it multiplies,so
+ * the tiles are as large as that cache allows.
+ *
+ */
+
+#define HALF_TILE           65536
+
+
+
+
+/*
+ * Defining a new data structure called half_layer_t that
+ * holds a single layer of a network whose synaptic weights
+ * have been saved in fp16 or bf16.The weights are kept in
+ * the two bytes they have been saved in,row after row,and
+ * only a tile of them is widened at a time while predicting.
+ *
+ */
+
+typedef struct
+{
+    llint               rows;           // The number of neurons of the layer.
+    llint               columns;        // The number of input signals of the layer,the bias included.
+    uint16_t            *H;             // The synaptic weights in half precision,row after row.
+} half_layer_t;
+
+
+
+
+/*
+ * Defining a new data structure called neural_half_t
+ * that represents a network with half precision weights
+ * used for predicting only.It shares the configuration
+ * of the saved network and holds one half layer per layer
+ * of it,the tile of widened weights,two batches of output
+ * signals of the hidden layers and the output signals of
+ * the output layer.
+ *
+ */
+
+typedef struct
+{
+    neural_config_t     *config;        // The configuration of the network.
+    int                 storage;        // The format of the weights,STORAGE_FP16 or STORAGE_BF16.
+    half_layer_t        *layers;        // The half precision layers.
+    double              *tile;          // The weights of the current tile widened into doubles.
+    double              *buffer[2];     // The output signals of a batch of rows of the hidden layers.
+    gsl_matrix          *output;        // The output signals of the output layer.
+} neural_half_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the half precision network such as load,activate,
+ * predict,exists,free etc...
+ *
+ */
+
+neural_half_t       *neural_half_load(neural_config_t *config,char *directory);
+gsl_matrix          *neural_half_activate(neural_half_t *nh,gsl_vector *signals);
+gsl_matrix          *neural_half_predict(neural_half_t *nh,gsl_matrix *data);
+int                 neural_half_exists(char *directory);
+void                neural_half_free(neural_half_t *nh);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_HALF_H has been
+ * defined the neural_half.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -33,11 +33,13 @@
  * Including the matrix library from the
  * GNU scientific library that provides
  * data structure definitions for matrices
- * and an interface for matrix operations.
+ * and an interface for matrix operations,
+ * in double and in single precision.
  * 
  */
 
 #include <gsl/gsl_matrix.h>
+#include <gsl/gsl_matrix_float.h>
 
 
 
@@ -69,8 +71,14 @@
  * is the matrix that contains the generated output signal
  * from each neuron in the layer.The fourth field,namely
  * D is the gradient value for each neuron in the layer.
- * The fifth field is the synaptic weights matrix from
- * the previous training epoch.
+ * The fifth field,namely V,is the velocity of the synaptic
+ * weights,the last shift applied to them,that drives the
+ * momentum term.It is only laid out when the momentum is
+ * non-zero,otherwise its data pointer is null.The matrices
+ * are views over memory owned by the network,so a layer
+ * makes no allocations of its own.A layer of a single
+ * precision network has the same five matrices as float
+ * views instead,and its double views are left empty.
  * 
  */
 
@@ -78,11 +86,16 @@ typedef long long int   llint;
 
 typedef struct
 {
-    gsl_matrix      *W;     // The synaptic weights matrix
-    gsl_matrix      *I;     // The linear aggregators matrix.
-    gsl_matrix      *Y;     // The output signals matrix.
-    gsl_matrix      *D;     // The gradient matrix.
-    gsl_matrix      *O;     // The synaptic weights of the previous epoch.
+    gsl_matrix_view       W;    // The synaptic weights matrix
+    gsl_matrix_view       I;    // The linear aggregators matrix.
+    gsl_matrix_view       Y;    // The output signals matrix.
+    gsl_matrix_view       D;    // The gradient matrix.
+    gsl_matrix_view       V;    // The velocity of the synaptic weights.
+    gsl_matrix_float_view Wf;   // The single precision synaptic weights matrix.
+    gsl_matrix_float_view If;   // The single precision linear aggregators matrix.
+    gsl_matrix_float_view Yf;   // The single precision output signals matrix.
+    gsl_matrix_float_view Df;   // The single precision gradient matrix.
+    gsl_matrix_float_view Vf;   // The single precision velocity of the synaptic weights.
 } neural_layer_t;
 
 
@@ -95,13 +108,19 @@ typedef struct
  *
  */
 
-neural_layer_t      *neural_layer_create(llint j,llint i,int layer_type);
+size_t              neural_layer_scratch(llint j,int layer_type);
+void                neural_layer_create(neural_layer_t *nl,llint j,llint i,int layer_type,double *weights,double *velocity,double *scratch,unsigned long seed);
 gsl_matrix          *neural_layer_getW(neural_layer_t *nl);
 gsl_matrix          *neural_layer_getI(neural_layer_t *nl);
 gsl_matrix          *neural_layer_getY(neural_layer_t *nl);
 gsl_matrix          *neural_layer_getD(neural_layer_t *nl);
-gsl_matrix          *neural_layer_getO(neural_layer_t *nl);
-void                neural_layer_free(neural_layer_t *nl);
+gsl_matrix          *neural_layer_getV(neural_layer_t *nl);
+void                neural_layer_create_float(neural_layer_t *nl,llint j,llint i,int layer_type,float *weights,float *velocity,float *scratch,unsigned long seed);
+gsl_matrix_float    *neural_layer_getW_float(neural_layer_t *nl);
+gsl_matrix_float    *neural_layer_getI_float(neural_layer_t *nl);
+gsl_matrix_float    *neural_layer_getY_float(neural_layer_t *nl);
+gsl_matrix_float    *neural_layer_getD_float(neural_layer_t *nl);
+gsl_matrix_float    *neural_layer_getV_float(neural_layer_t *nl);
 
 
 
@@ -0,0 +1,154 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * low-rank factorised inference engine of
+ * the neural network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_lowrank.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_LOWRANK_H
+#define NEURAL_LOWRANK_H
+
+
+
+
+/*
+ * Including the dataset.h header file that
+ * contains the dataset data structure and the
+ * neural_eval.h header file that contains the
+ * neural network and the evaluation data structures.
+ *
+ */
+
+#include "dataset.h"
+#include "neural_eval.h"
+
+
+
+
+/*
+ * Defining a new data structure called lowrank_layer_t that
+ * holds a single layer of a factorised network.The synaptic
+ * weights of the layer are replaced by the product of two thin
+ * matrices taken from their singular value decomposition:
+ *
+ *      W ~ A * B     A = U(:,1..r) * S(1..r)     B = V(:,1..r)'
+ *
+ * where A has one row per neuron and r columns and B has r rows
+ * and one column per input signal.A layer whose rank is zero is
+ * not factorised and is propagated with its synaptic weights.The
+ * rows of A may hold more columns than the rank in use,the stride
+ * is the number of doubles from one row of A to the next.A loaded
+ * layer only holds the matrices it is propagated with.
+ *
+ */
+
+typedef struct
+{
+    llint               rows;           // The number of neurons of the layer.
+    llint               columns;        // The number of input signals of the layer,the bias included.
+    llint               rank;           // The number of singular values in use,zero for a dense layer.
+    llint               stride;         // The number of doubles between two rows of A.
+    double              *W;             // The synaptic weights,row after row,NULL if not kept.
+    double              *A;             // The left factor,NULL if not kept.
+    double              *B;             // The right factor,NULL if not kept.
+} lowrank_layer_t;
+
+
+
+
+/*
+ * Defining a new data structure called neural_lowrank_t
+ * that represents a factorised neural network used for
+ * predicting only.It shares the configuration of the
+ * network it has been factorised from and holds one
+ * layer per layer of it,the input and output signals of
+ * the current layer,the products of the right factor with
+ * the input signals and the output signals of the output
+ * layer.
+ *
+ */
+
+typedef struct
+{
+    neural_config_t     *config;        // The configuration of the factorised network.
+    lowrank_layer_t     *layers;        // The factorised layers.
+    double              *X;             // The input signals of the current layer.
+    double              *Y;             // The output signals of the current hidden layer,the bias first.
+    double              *T;             // The input signals of the current layer multiplied by B.
+    gsl_matrix          *output;        // The output signals of the output layer.
+} neural_lowrank_t;
+
+
+
+
+/*
+ * Defining a new data structure called lowrank_report_t
+ * that holds the outcome of fitting the ranks of a network
+ * to an accuracy budget,the number of weights of either
+ * network,which is also the number of multiplications per
+ * row,and the scores of both on the rows the ranks have
+ * been fitted on.
+ *
+ */
+
+typedef struct
+{
+    size_t              weights;        // The number of weights of the factorised network.
+    size_t              reference_weights;// The number of weights of the original network.
+    evaluation_t        reference;      // The scores of the original network.
+    evaluation_t        factorised;     // The scores of the factorised network.
+} lowrank_report_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the factorised network such as create,fit,
+ * activate,predict,score,dump,load,free etc...
+ *
+ */
+
+neural_lowrank_t    *neural_lowrank_create(neural_net_t *nn);
+void                neural_lowrank_fit(neural_lowrank_t *nl,neural_net_t *nn,dataset_t *ds,double budget,lowrank_report_t *report);
+gsl_matrix          *neural_lowrank_activate(neural_lowrank_t *nl,gsl_vector *signals);
+gsl_matrix          *neural_lowrank_predict(neural_lowrank_t *nl,gsl_matrix *data);
+void                neural_lowrank_score(neural_lowrank_t *nl,dataset_t *ds,evaluation_t *ev);
+void                neural_lowrank_dump(neural_lowrank_t *nl,char *directory);
+neural_lowrank_t    *neural_lowrank_load(neural_config_t *config,char *directory);
+int                 neural_lowrank_exists(char *directory);
+void                neural_lowrank_free(neural_lowrank_t *nl);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_LOWRANK_H has been
+ * defined the neural_lowrank.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
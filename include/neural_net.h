@@ -36,6 +36,7 @@
  */
 
 #include "neural_layer.h"
+#include "thread_pool.h"
 
 
 
@@ -63,7 +64,9 @@ typedef void        (*TrainingFn)(const void *,const void *);
  * neurons per layer is defined as well as constants about
  * the training process of the network such as the learning
  * rate,the convergence constant,momentum value,alpha and beta
- * coefficients for the activation function.It also contains
+ * coefficients for the activation function,the precision
+ * the network is stored and computed in and the format its
+ * synaptic weights are saved in.It also contains
  * three function pointers that potentially will invoke the
  * activation function,it's derivative and the training function
  * which must be implemented by the user.
@@ -86,10 +89,80 @@ typedef struct
     DerivativeFn        derivative;             // A function pointer to the derivative function.
     TrainingFn          train;                  // A function pointer to the training function.
     int                 atype;                  // A numeric value for the activation type.
+    int                 precision;              // The floating point precision,PRECISION_F64 or PRECISION_F32.
+    int                 storage;                // The format of the saved weights,STORAGE_NATIVE,STORAGE_FP16 or STORAGE_BF16.
+    unsigned long       seed;                   // The seed of the initial synaptic weights,the current time if zero.
 } neural_config_t;
 
 
 
+/*
+ * The matrices of every layer live in a single arena,the
+ * synaptic weights of all layers first,then their velocities
+ * unless the momentum is zero and last the scratch matrices,
+ * each one starting on a boundary of NEURAL_NET_ALIGN bytes.
+ * A single precision network holds floats in the arena.
+ *
+ */
+
+#define NEURAL_NET_ALIGN    64      // The alignment of the arena and of every matrix in it.
+
+
+#define PRECISION_F64       64      // The network is stored and computed in doubles.
+#define PRECISION_F32       32      // The network is stored and computed in floats.
+#define STORAGE_NATIVE      78      // The weights are saved in the precision of the network.
+#define STORAGE_FP16        72      // The weights are saved as IEEE half precision values.
+#define STORAGE_BF16        66      // The weights are saved as bfloat16 values.
+
+
+/*
+ * A double precision network none of whose layers holds more
+ * than NEURAL_TINY_WEIGHTS synaptic weights is tiny,its whole
+ * forward pass runs as one fused routine over the arena.Any
+ * other double precision network predicts a dataset of at least
+ * NEURAL_BATCH_MIN rows in batches of NEURAL_BATCH_ROWS.
+ *
+ */
+
+#define NEURAL_TINY_WEIGHTS 1024    // The most synaptic weights of a layer of a tiny network.
+#define NEURAL_BATCH_MIN    16      // The fewest rows a prediction multiplies as a batch.
+#define NEURAL_BATCH_ROWS   256     // The rows propagated per batch.
+
+
+/*
+ * A single row propagated through a layer of at least twice
+ * NEURAL_SPLIT_MIN synaptic weights has the neurons of the
+ * layer split across the threads of the network.
+ *
+ */
+
+#define NEURAL_SPLIT_MIN    (1<<16) // The fewest synaptic weights per thread of a split layer.
+
+
+
+/*
+ * Defining a new data structure called neural_slice_t
+ * that represents a run of neurons of a split layer,
+ * which a worker of the network propagates.
+ *
+ */
+
+typedef struct
+{
+    task_t              task;       // The task that hands the run to a worker.
+    neural_config_t     *config;    // The configuration of the network.
+    const double        *W;         // The synaptic weights of the first neuron of the run.
+    size_t              ldw;        // The distance between the weights of two neurons.
+    size_t              weights;    // The number of synaptic weights per neuron.
+    size_t              neurons;    // The number of neurons of the run.
+    const double        *x;         // The input signals of the layer.
+    size_t              incx;       // The stride of the input signals.
+    double              *I;         // The linear aggregators of the run.
+    double              *y;         // The output signals of the run.
+} neural_slice_t;
+
+
+
 /*
  * Defining a new data structure called neural_net_t
  * that represents the abstract concept of an artificial
@@ -108,6 +181,15 @@ typedef struct
 {
     neural_config_t     *config;
     neural_layer_t      **layers;
+    void                *arena;     // The memory of every layer matrix.
+    size_t              size;       // The number of bytes in the arena.
+    float               *input;     // The float input signals of a single precision network.
+    gsl_matrix_view     output;     // The double output signals of a single precision network.
+    int                 tiny;       // Non-zero if the fused forward pass serves the network.
+    size_t              threads;    // The threads the neurons of a wide layer are split across.
+    thread_pool_t       *pool;      // The workers of the split layers,started on first use.
+    neural_slice_t      **slices;   // The runs of neurons of every layer,null for a layer that is not split.
+    size_t              *nslices;   // The number of runs of every layer.
 } neural_net_t;
 
 
@@ -123,10 +205,22 @@ typedef struct
 
 neural_net_t        *neural_net_create(neural_config_t *config);
 gsl_matrix          *neural_net_predict(neural_net_t *nn,gsl_matrix *signals);
+gsl_matrix          *neural_net_activate(neural_net_t *nn,gsl_vector *signals);
 void                neural_net_train(neural_net_t *nn,gsl_matrix *data);
 void                neural_net_dump(neural_net_t *nn,char *directory);
 neural_net_t        *neural_net_load(neural_config_t *config,char *directory);
+int                 neural_net_checkpoint(neural_net_t *nn,char *directory,llint epoch);
+llint               neural_net_restore(neural_net_t *nn,char *directory);
+void                neural_net_threads(neural_net_t *nn,size_t threads);
+neural_net_t        *neural_net_momentum(neural_net_t *nn,double momentum);
+void                neural_net_layer_propagate(neural_net_t *nn,size_t l,const double *x,size_t incx);
+double              neural_net_weight(neural_net_t *nn,size_t l,size_t j,size_t i);
+void                neural_net_weight_set(neural_net_t *nn,size_t l,size_t j,size_t i,double value);
+double              neural_net_signal(neural_net_t *nn,size_t l,size_t i);
+char                *neural_net_path(char *directory,char *name);
 void                neural_net_free(neural_net_t *nn);
+void                neural_config_dump(neural_config_t *config,FILE *f);
+void                neural_config_load(neural_config_t *config,FILE *f);
 
 
 
@@ -0,0 +1,152 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * int8 quantised inference engine of the
+ * neural network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_quant.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_QUANT_H
+#define NEURAL_QUANT_H
+
+
+
+
+/*
+ * Including the standard integer types library,
+ * the dataset.h header file that contains the
+ * dataset data structure and the neural_eval.h
+ * header file that contains the neural network
+ * and the evaluation data structures.
+ *
+ */
+
+#include <stdint.h>
+#include "dataset.h"
+#include "neural_eval.h"
+
+
+
+
+/*
+ * Defining a new data structure called quant_layer_t that
+ * holds a single layer of a quantised network.Every row of
+ * synaptic weights is mapped onto the integers -127..127 by
+ * a scale of its own,W(j,i) ~ Q(j,i) * scales(j),and the input
+ * signals of the layer by a single scale that is calibrated
+ * on a representative input file,Y(i) ~ q(i) * input_scale.
+ * The linear aggregators are then integer dot products with
+ * 32 bit accumulators,rescaled once per neuron.
+ *
+ */
+
+typedef struct
+{
+    llint               rows;           // The number of neurons of the layer.
+    llint               columns;        // The number of input signals of the layer,the bias included.
+    llint               stride;         // The number of weights per row,padded to a whole number of blocks.
+    float               input_scale;    // The real value of a single step of the quantised input signals.
+    float               *scales;        // The real value of a single step of every row of weights.
+    int8_t              *Q;             // The quantised synaptic weights,row after row.
+} quant_layer_t;
+
+
+
+
+/*
+ * Defining a new data structure called neural_quant_t
+ * that represents a quantised neural network used for
+ * predicting only.It shares the configuration of the
+ * network it has been quantised from and holds one
+ * quantised layer per layer of it,the quantised input
+ * signals of the current layer,the real output signals
+ * of the current hidden layer and the output signals of
+ * the output layer.
+ *
+ */
+
+typedef struct
+{
+    neural_config_t     *config;        // The configuration of the quantised network.
+    quant_layer_t       *layers;        // The quantised layers.
+    int8_t              *signals;       // The quantised input signals of the current layer.
+    double              *Y;             // The output signals of the current hidden layer,the bias first.
+    gsl_matrix          *output;        // The output signals of the output layer.
+} neural_quant_t;
+
+
+
+
+/*
+ * Defining a new data structure called quant_report_t
+ * that holds the comparison of a quantised network with
+ * the network it has been quantised from on a set of rows.
+ * The scores are only filled in when the rows hold the
+ * desired output signals.
+ *
+ */
+
+typedef struct
+{
+    size_t              rows;           // The number of compared rows.
+    int                 targets;        // Non-zero if the rows hold the desired output signals.
+    double              agreement;      // The fraction of rows whose strongest output signal is the same.
+    double              max_delta;      // The largest absolute difference of an output signal.
+    double              mean_delta;     // The mean absolute difference of the output signals.
+    size_t              bytes;          // The number of bytes of the quantised weights and scales.
+    size_t              reference_bytes;// The number of bytes of the weights of the original network.
+    evaluation_t        reference;      // The scores of the original network.
+    evaluation_t        quantised;      // The scores of the quantised network.
+} quant_report_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the quantised network such as create,activate,
+ * predict,compare,dump,load,free etc...
+ *
+ */
+
+neural_quant_t      *neural_quant_create(neural_net_t *nn,gsl_matrix *calibration);
+gsl_matrix          *neural_quant_activate(neural_quant_t *nq,gsl_vector *signals);
+gsl_matrix          *neural_quant_predict(neural_quant_t *nq,gsl_matrix *data);
+void                neural_quant_compare(neural_quant_t *nq,neural_net_t *nn,dataset_t *ds,quant_report_t *report);
+void                neural_quant_dump(neural_quant_t *nq,char *directory);
+neural_quant_t      *neural_quant_load(neural_config_t *config,char *directory);
+int                 neural_quant_exists(char *directory);
+void                neural_quant_free(neural_quant_t *nq);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_QUANT_H has been
+ * defined the neural_quant.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -0,0 +1,201 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * concurrent hyperparameter search over
+ * neural network configurations.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_search.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_SEARCH_H
+#define NEURAL_SEARCH_H
+
+
+
+
+/*
+ * Including the standard input-output library
+ * for the results table,the dataset.h header
+ * file,the neural_net.h header file and the
+ * neural_eval.h header file that contains the
+ * evaluation data structure used for scoring.
+ *
+ */
+
+#include <stdio.h>
+#include "dataset.h"
+#include "neural_net.h"
+#include "neural_eval.h"
+
+
+
+
+/*
+ * Defining two macro constants that represent
+ * the supported search strategies,namely the
+ * exhaustive grid search and the random search.
+ *
+ */
+
+#define SEARCH_GRID         71
+#define SEARCH_RANDOM       82
+
+
+
+/*
+ * Defining three macro constants that represent
+ * the trial schedulers.Without a scheduler every
+ * trial runs for the full epoch limit,successive
+ * halving runs one bracket of shrinking rungs and
+ * hyperband runs several brackets that trade the
+ * number of trials against their initial budget.
+ *
+ */
+
+#define SCHEDULE_NONE       78
+#define SCHEDULE_HALVING    72
+#define SCHEDULE_HYPERBAND  66
+
+
+
+
+/*
+ * Defining a new data structure called search_range_t
+ * that represents a closed interval [lo,hi] of values
+ * for a single hyperparameter.A degenerate interval
+ * with lo equal to hi fixes the hyperparameter.
+ *
+ */
+
+typedef struct
+{
+    double              lo;                     // The lower bound of the interval.
+    double              hi;                     // The upper bound of the interval.
+} search_range_t;
+
+
+
+/*
+ * Defining a new data structure called search_space_t that
+ * describes the hyperparameters to be explored,the fixed
+ * settings shared by all trials and the settings of the
+ * search itself.The number of layers counts the hidden
+ * layers plus the output layer,as the "--nlayers" flag
+ * does,and the width range applies to every hidden layer.
+ * The width of the output layer is fixed by the dataset.
+ *
+ */
+
+typedef struct
+{
+    search_range_t      nlayers;                // The range of the total number of layers.
+    search_range_t      neurons;                // The range of neurons per hidden layer.
+    search_range_t      eta;                    // The range of the learning rate.
+    search_range_t      momentum;               // The range of the momentum rate.
+    search_range_t      alpha;                  // The range of the alpha coefficient.
+    search_range_t      beta;                   // The range of the beta coefficient.
+    int                 activations[3];         // The activation function types to try.
+    int                 nactivations;           // The number of activation function types.
+    llint               signals;                // The number of input signals including the bias.
+    llint               outputs;                // The number of output neurons.
+    llint               epochs;                 // The epoch limit of every trial.
+    double              epsilon;                // The convergence constant of every trial.
+    int                 strategy;               // SEARCH_GRID or SEARCH_RANDOM.
+    llint               trials;                 // The number of random trials.
+    llint               steps;                  // The number of grid points per continuous range.
+    double              holdout;                // The fraction of rows held out for validation.
+    unsigned long       seed;                   // The seed for sampling and the validation split.
+    size_t              threads;                // The number of worker threads,0 for one per cpu.
+    int                 scheduler;              // SCHEDULE_NONE,SCHEDULE_HALVING or SCHEDULE_HYPERBAND.
+    llint               min_epochs;             // The epoch budget of the first rung.
+    llint               reduction;              // The factor by which rungs shrink the trials.
+} search_space_t;
+
+
+
+/*
+ * Defining a new data structure called search_trial_t
+ * that represents a single sampled configuration of
+ * the search together with its validation scores
+ * and the epoch budget of the last rung it reached.
+ * Every trial owns its configuration and the neurons
+ * array inside it.
+ *
+ */
+
+typedef struct
+{
+    llint               id;                     // The trial number in sampling order.
+    neural_config_t     config;                 // The configuration of the trial.
+    evaluation_t        score;                  // The scores on the validation rows.
+    double              loss;                   // The mean square error on the validation rows.
+    llint               budget;                 // The epoch budget of the last rung reached.
+} search_trial_t;
+
+
+
+/*
+ * Defining a new data structure called search_result_t
+ * that holds every trial ranked from best to worst and
+ * the trained network of the best trial,which uses the
+ * configuration of the first trial of the ranking.The
+ * epoch counters measure the training work that was done
+ * against the work of running every trial to the limit.
+ *
+ */
+
+typedef struct
+{
+    search_trial_t      *trials;                // The trials ranked from best to worst.
+    llint               ntrials;                // The total number of trials.
+    neural_net_t        *best;                  // The trained network of the best trial.
+    llint               epochs_used;            // The total number of epochs trained.
+    llint               epochs_full;            // The epochs needed without early stopping.
+} search_result_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding the
+ * hyperparameter search such as sampling,running and
+ * reporting the trials.
+ *
+ */
+
+search_trial_t      *search_trials_create(search_space_t *space,llint *ntrials);
+search_result_t     *search_run(search_space_t *space,dataset_t *ds);
+void                search_report(FILE *f,search_result_t *sr,int type);
+void                search_result_free(search_result_t *sr);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the 
+ * compiler and the macro NEURAL_SEARCH_H has been
+ * defined the neural_search.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ * This file contains macro definitions
+ * and function prototypings regarding the
+ * neuron pruning of the neural network data
+ * structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_shrink.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_SHRINK_H
+#define NEURAL_SHRINK_H
+
+
+
+
+/*
+ * Including the neural_net.h header
+ * file that contains the neural network
+ * and the configuration data structures.
+ *
+ */
+
+#include "neural_net.h"
+
+
+
+
+/*
+ * Defining macro constants representing the
+ * different ways the hidden neurons of a network
+ * are ranked by when whole neurons are pruned.
+ *
+ */
+
+#define RANK_NORM           78      // The norm of the outgoing synaptic weights of a neuron.
+#define RANK_VARIANCE       86      // The variance of the output signal of a neuron over a dataset.
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the removal of whole hidden neurons from a
+ * neural network.
+ *
+ */
+
+neural_net_t        *neural_shrink_create(neural_net_t *nn,neural_config_t *config,double fraction,int rank,gsl_matrix *data);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_SHRINK_H has been
+ * defined the neural_shrink.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
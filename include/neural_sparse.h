@@ -0,0 +1,190 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * magnitude pruning and the sparse inference
+ * engine of the neural network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the neural_sparse.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef NEURAL_SPARSE_H
+#define NEURAL_SPARSE_H
+
+
+
+
+/*
+ * Including the standard integer types library,
+ * the dataset.h header file that contains the
+ * dataset data structure and the neural_eval.h
+ * header file that contains the neural network
+ * and the evaluation data structures.
+ *
+ */
+
+#include <stdint.h>
+#include "dataset.h"
+#include "neural_eval.h"
+
+
+
+
+/*
+ * Defining the density below which a layer is propagated
+ * with the sparse kernel.The sparse kernel gathers every
+ * input signal through the column index of its weight,which
+ * costs about twice as much as a step of the dense kernel,so
+ * denser layers are expanded back into dense rows on loading.
+ *
+ */
+
+#define SPARSE_DENSITY      0.5
+
+
+
+
+/*
+ * Defining a new data structure called sparse_layer_t that
+ * holds a single layer of a pruned network in the compressed
+ * sparse row format.The non-zero weights of row j are the
+ * values offsets(j) up to offsets(j+1) and their columns are
+ * held in the same cells of the indices.A layer that is too
+ * dense for the sparse kernel keeps every weight in the values
+ * instead,row after row,and has no offsets and no indices.
+ *
+ */
+
+typedef struct
+{
+    llint               rows;           // The number of neurons of the layer.
+    llint               columns;        // The number of input signals of the layer,the bias included.
+    llint               nonzeros;       // The number of synaptic weights that survived the pruning.
+    uint32_t            *offsets;       // The first non-zero weight of every row and the end of the last one.
+    uint32_t            *indices;       // The column of every non-zero weight,NULL for a dense layer.
+    double              *values;        // The non-zero weights,or every weight of a dense layer.
+} sparse_layer_t;
+
+
+
+
+/*
+ * Defining a new data structure called sparse_mask_t that
+ * holds the synaptic weights a network has been pruned of.
+ * Every pruned weight is kept as its offset from the start
+ * of the data of its layer's weights matrix,so that the mask
+ * can be applied after every row while the pruned network is
+ * fine-tuned and the pruned weights stay at zero.
+ *
+ */
+
+typedef struct
+{
+    llint               nlayers;        // The number of layers of the pruned network.
+    size_t              *counts;        // The number of pruned weights per layer.
+    size_t              **cells;        // The offsets of the pruned weights per layer.
+} sparse_mask_t;
+
+
+
+
+/*
+ * Defining a new data structure called neural_sparse_t
+ * that represents a pruned neural network used for
+ * predicting only.It shares the configuration of the
+ * network it has been pruned from and holds one sparse
+ * layer per layer of it,the output signals of the current
+ * hidden layer and the output signals of the output layer.
+ *
+ */
+
+typedef struct
+{
+    neural_config_t     *config;        // The configuration of the pruned network.
+    sparse_layer_t      *layers;        // The sparse layers.
+    double              *Y;             // The output signals of the current hidden layer,the bias first.
+    double              *X;             // The input signals of the current layer.
+    gsl_matrix          *output;        // The output signals of the output layer.
+} neural_sparse_t;
+
+
+
+
+/*
+ * Defining a new data structure called sparse_report_t
+ * that holds the comparison of a pruned network with
+ * the network it has been pruned from on a set of rows.
+ * The scores are only filled in when the rows hold the
+ * desired output signals.
+ *
+ */
+
+typedef struct
+{
+    size_t              rows;           // The number of compared rows.
+    int                 targets;        // Non-zero if the rows hold the desired output signals.
+    double              agreement;      // The fraction of rows whose strongest output signal is the same.
+    double              max_delta;      // The largest absolute difference of an output signal.
+    double              mean_delta;     // The mean absolute difference of the output signals.
+    size_t              nonzeros;       // The number of synaptic weights of the pruned network.
+    size_t              weights;        // The number of synaptic weights of the original network.
+    size_t              sparse_layers;  // The number of layers propagated with the sparse kernel.
+    size_t              bytes;          // The number of bytes of the compressed sparse rows.
+    size_t              reference_bytes;// The number of bytes of the weights of the original network.
+    evaluation_t        reference;      // The scores of the original network.
+    evaluation_t        pruned;         // The scores of the pruned network.
+} sparse_report_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the pruning of a neural network and the sparse
+ * network such as create,activate,predict,compare,
+ * dump,load,free etc...
+ *
+ */
+
+sparse_mask_t       *neural_sparse_prune(neural_net_t *nn,double sparsity);
+void                neural_sparse_mask_apply(const void *n,const void *s,void *arg);
+void                neural_sparse_mask_free(sparse_mask_t *mask);
+neural_sparse_t     *neural_sparse_create(neural_net_t *nn);
+gsl_matrix          *neural_sparse_activate(neural_sparse_t *ns,gsl_vector *signals);
+gsl_matrix          *neural_sparse_predict(neural_sparse_t *ns,gsl_matrix *data);
+void                neural_sparse_compare(neural_sparse_t *ns,neural_net_t *nn,dataset_t *ds,sparse_report_t *report);
+void                neural_sparse_dump(neural_sparse_t *ns,char *directory);
+neural_sparse_t     *neural_sparse_load(neural_config_t *config,char *directory);
+int                 neural_sparse_exists(char *directory);
+void                neural_sparse_free(neural_sparse_t *ns);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro NEURAL_SPARSE_H has been
+ * defined the neural_sparse.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
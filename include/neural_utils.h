@@ -48,6 +48,115 @@
 
 
 
+/*
+ * Defining macro constants representing
+ * the different activation function types
+ * that can be stored in the atype field of
+ * the neural configuration data structure.
+ *
+ */
+
+#define ACTIVATION_LGST     1       // Logistic activation function.
+#define ACTIVATION_LNR      2       // Linear activation function.
+#define ACTIVATION_HTAN     3       // Hyperbolic tangent activation function.
+
+
+
+
+/*
+ * Including the unix types library for the
+ * process identifiers of the checkpoint writers
+ * and the neural_net.h header file that contains
+ * datatype definitions and function prototypings
+ * regarding the neural network data structure.
+ *
+ */
+
+#include <sys/types.h>
+#include "neural_net.h"
+
+
+
+
+/*
+ * Defining a new function pointer called EpochFn.The
+ * training procedure invokes it after every epoch with
+ * the neural network,the training session and the user
+ * data of the session as the first,second and third
+ * argument respectively.
+ *
+ */
+
+typedef void        (*EpochFn)(const void *,const void *,void *);
+
+
+
+/*
+ * Defining a new data structure called training_session_t
+ * that represents a single run of the training procedure.
+ * Besides the epoch counter and the epoch budget it holds
+ * an optional array of row indices so that a network can be
+ * trained on a permuted or partial view of a shared dataset
+ * matrix without copying it.When the index array is NULL
+ * every row of the matrix takes part in the training.
+ * The stop flag may be raised by another thread or by a
+ * signal handler to end the run after the current epoch,
+ * and a stopped or exhausted session can be resumed by
+ * raising its epoch budget and training it again.The
+ * progress line is printed at most once per interval,and
+ * the gradient norm is only measured on request since it
+ * costs an extra pass over the local gradients per row.
+ * The row function,if any,is invoked after the synaptic
+ * weights have been adjusted to every single row.
+ *
+ */
+
+typedef struct
+{
+    size_t              *index;                 // The row indices of the training view,NULL for all rows.
+    size_t              rows;                   // The number of rows in the training view.
+    llint               epoch;                  // The number of epochs completed so far.
+    llint               epochs;                 // The epoch budget,training stops once it is reached.
+    double              mse;                    // The mean square error after the last epoch.
+    double              loss;                   // The mse difference between the last two epochs.
+    int                 quiet;                  // Suppresses the per-epoch progress line when set.
+    double              interval;               // The minimum seconds between two progress lines,0 prints every epoch.
+    double              printed;                // The time stamp of the last progress line.
+    int                 gradients;              // Measures the gradient norm of every epoch when set.
+    double              gradient;               // The root mean square gradient norm of the last epoch.
+    volatile int        stop;                   // Set from outside to end training after the current epoch.
+    EpochFn             on_epoch;               // Invoked after every epoch,may be NULL.
+    void                *arg;                   // The user data of the epoch function.
+    EpochFn             on_row;                 // Invoked after every row,may be NULL.
+    void                *row_arg;               // The user data of the row function.
+} training_session_t;
+
+
+
+/*
+ * Defining a new data structure called checkpoint_t that
+ * holds the state of the periodic training checkpoints.
+ * Every checkpoint is written by a forked child process
+ * that works on a copy-on-write snapshot of the network,
+ * so the training loop never waits for the disk.At most
+ * one writer is in flight,a checkpoint that falls due
+ * while the previous one is still being written is
+ * deferred to the next epoch.
+ *
+ */
+
+typedef struct
+{
+    char                *directory;             // The directory the checkpoints are written into.
+    llint               every;                  // The number of epochs between two checkpoints.
+    pid_t               child;                  // The writer process in flight,0 if there is none.
+    int                 deferred;               // Set when a due checkpoint was postponed.
+    llint               written;                // The number of checkpoints started.
+} checkpoint_t;
+
+
+
+
 
 /*
  * Funtion prototypings of utility procedures
@@ -58,6 +167,11 @@
  */
 
 void            backpropagation(const void *,const void *);
+void            backpropagation_session(const void *,const void *,const void *);
+void            training_session_init(training_session_t *ts,neural_net_t *nn,gsl_matrix *data);
+double          sample_error_calculate(neural_net_t *nn,gsl_matrix *data,size_t *index,size_t rows);
+void            checkpoint_epoch(const void *,const void *,void *);
+int             checkpoint_finish(checkpoint_t *cp);
 double          mean_square_error_calculate(const void *,const void *,const void *);
 double          logistic_function(const void *,const void *,const void *);
 double          logistic_derivative(const void *,const void *,const void *);
@@ -65,6 +179,7 @@ double          hyperbolic_function(const void *,const void *,const void *);
 double          hyperbolic_derivative(const void *,const void *,const void *);
 double          linear_function(const void *,const void *,const void *);
 double          linear_derivative(const void *,const void *,const void *);
+void            activation_assign(neural_config_t *config);
 
 
 
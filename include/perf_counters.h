@@ -0,0 +1,106 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * hardware performance counters.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the perf_counters.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+
+
+
+/*
+ * Including the standard input output library
+ * and the standard integer types library.
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+
+
+
+/*
+ * Defining macros for the counted hardware events.
+ * The cycles counter leads the group,so every event
+ * is counted over exactly the same instructions.
+ *
+ */
+
+#define PERF_CYCLES         0       // The cpu cycles.
+#define PERF_INSTRUCTIONS   1       // The retired instructions.
+#define PERF_L1D_MISSES     2       // The level one data cache read misses.
+#define PERF_LLC_MISSES     3       // The last level cache read misses.
+#define PERF_BRANCH_MISSES  4       // The mispredicted branches.
+#define PERF_EVENTS         5       // The number of counted events.
+
+
+
+
+/*
+ * Defining a new data structure called perf_counters_t
+ * that holds the file descriptors of an event group.An
+ * event the cpu or the kernel does not support stays
+ * closed and is reported as unavailable.The values are
+ * scaled up when the kernel multiplexed the group.
+ *
+ */
+
+typedef struct
+{
+    int                 fd[PERF_EVENTS];        // The file descriptors of the events,-1 if unavailable.
+    uint64_t            id[PERF_EVENTS];        // The kernel identifiers of the events.
+    uint64_t            values[PERF_EVENTS];    // The counts of the last measured phase.
+} perf_counters_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the hardware performance counters such as open,
+ * start,stop,print etc...
+ *
+ */
+
+perf_counters_t     *perf_counters_open(void);
+void                perf_counters_start(perf_counters_t *pc);
+void                perf_counters_stop(perf_counters_t *pc);
+void                perf_counters_print(FILE *f,perf_counters_t *pc,char *phase,double samples);
+void                perf_counters_close(perf_counters_t *pc);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro PERF_COUNTERS_H has been
+ * defined the perf_counters.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * per-layer profiler of the training and
+ * predicting procedures.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the profiler.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+
+
+
+/*
+ * Including the standard input output library,
+ * the standard integer types library and the
+ * time library for the monotonic clock.
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+
+
+
+/*
+ * Defining macros for the profiled phases and the
+ * number of layer slots.The error sweeps cover the
+ * whole network and are accounted to the first slot,
+ * layers deeper than the last slot share it.
+ *
+ */
+
+#define PROFILE_FORWARD     0       // The forward propagation of a layer.
+#define PROFILE_DELTA       1       // The local gradients of a layer.
+#define PROFILE_UPDATE      2       // The synaptic weights update of a layer.
+#define PROFILE_ERROR       3       // The mean square error sweeps.
+#define PROFILE_PHASES      4       // The number of profiled phases.
+#define PROFILE_LAYERS      16      // The number of layer slots.
+
+
+
+
+/*
+ * The profiler is switched on at runtime by profiler_enable().
+ * While it is off every hook costs a single branch.Compiling with
+ * -DNO_PROFILE removes the hooks altogether.
+ *
+ */
+
+extern int          profiler_enabled;
+
+uint64_t            profiler_clock(void);
+void                profiler_record(int phase,size_t layer,uint64_t start,size_t bytes);
+void                profiler_enable(char *trace);
+void                profiler_report(FILE *f);
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The inline functions profiler_begin() and profiler_end() surround
+ * a profiled region.The first one returns the time stamp the region
+ * started at,or zero if the profiler is off,and the second one accounts
+ * the elapsed time and the given number of bytes touched to the phase
+ * and layer.
+ *
+ */
+
+#ifdef NO_PROFILE
+static inline uint64_t profiler_begin(void) { return 0; }
+static inline void profiler_end(int phase,size_t layer,uint64_t start,size_t bytes) { return; }
+#else
+static inline uint64_t profiler_begin(void) { return profiler_enabled ? profiler_clock() : 0; }
+static inline void profiler_end(int phase,size_t layer,uint64_t start,size_t bytes) { if (start!=0) { profiler_record(phase,layer,start,bytes); } }
+#endif
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro PROFILER_H has been
+ * defined the profiler.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -0,0 +1,111 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * training telemetry data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the telemetry.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+
+
+
+/*
+ * Including the standard input output library
+ * for the telemetry stream and the neural_utils.h
+ * header file that contains the definition of the
+ * training session data structure.
+ *
+ */
+
+#include <stdio.h>
+#include "neural_utils.h"
+
+
+
+
+/*
+ * Defining a new data structure called telemetry_record_t
+ * that holds the metrics of a single training epoch,and a
+ * new data structure called telemetry_t that collects them.
+ * The records are kept in a buffer that is allocated once
+ * and written out as JSON lines whenever it fills up,so the
+ * training loop never formats text or touches the stream in
+ * between.Another epoch function may be chained behind the
+ * telemetry,its time is not counted against the epoch.
+ *
+ */
+
+typedef struct
+{
+    llint               epoch;          // The epoch counter after the epoch.
+    double              seconds;        // The wall time of the epoch.
+    double              throughput;     // The number of training rows per second.
+    double              loss;           // The mse difference between the last two epochs.
+    double              mse;            // The mean square error after the epoch.
+    double              eta;            // The learning rate of the epoch.
+    double              gradient;       // The root mean square gradient norm of the epoch.
+} telemetry_record_t;
+
+typedef struct
+{
+    telemetry_record_t  *records;       // The preallocated buffer of records.
+    size_t              capacity;       // The number of records written out at once.
+    size_t              count;          // The number of buffered records.
+    FILE                *stream;        // The stream the JSON lines are written into.
+    int                 owned;          // Set when the stream is closed by telemetry_free().
+    double              stamp;          // The time stamp the current epoch started at.
+    EpochFn             next;           // The chained epoch function,may be NULL.
+    void                *next_arg;      // The user data of the chained epoch function.
+} telemetry_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the telemetry data structure such as create,
+ * attach,flush,free etc...
+ *
+ */
+
+double              telemetry_clock(void);
+telemetry_t         *telemetry_create(char *target,size_t interval);
+void                telemetry_attach(telemetry_t *tm,training_session_t *ts);
+void                telemetry_epoch(const void *n,const void *s,void *arg);
+void                telemetry_flush(telemetry_t *tm);
+void                telemetry_free(telemetry_t *tm);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the
+ * compiler and the macro TELEMETRY_H has been
+ * defined the telemetry.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * This file contains data type definitions
+ * and function prototypings regarding the
+ * thread pool data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Using include guards to check if
+ * the thread_pool.h header file has
+ * been included at least once.If it
+ * hasn't the compiler copy-pastes
+ * everything into the file that is
+ * including it.If the file on the
+ * other hand has been included the
+ * compiler skips the contents entirely.
+ *
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+
+
+
+/*
+ * Including the posix threads library that
+ * provides the thread,mutex and condition
+ * variable primitives the pool is built on.
+ *
+ */
+
+#include <stddef.h>
+#include <pthread.h>
+
+
+
+
+/*
+ * Defining a new function pointer called TaskFn.
+ * Every unit of work submitted to the pool is a
+ * task function together with its argument.
+ *
+ */
+
+typedef void        (*TaskFn)(void *);
+
+
+
+
+/*
+ * Defining a new data structure called task_t that
+ * represents a single queued unit of work,and a new
+ * data structure called thread_pool_t that represents
+ * a fixed set of persistent worker threads consuming
+ * a first-in first-out queue of tasks.A task that is
+ * posted instead of submitted lives in memory of the
+ * caller,so that work handed out over and over again
+ * needs no allocation.The pending
+ * counter tracks queued and running tasks so that
+ * the submitting thread can wait for all of them.
+ *
+ */
+
+typedef struct task
+{
+    TaskFn              fn;         // The task function.
+    void                *arg;       // The argument of the task function.
+    struct task         *next;      // The next task in the queue.
+    int                 owned;      // Non-zero if the submitter owns the node,which is then not freed.
+} task_t;
+
+typedef struct
+{
+    pthread_t           *workers;   // The worker threads of the pool.
+    size_t              nworkers;   // The total number of worker threads.
+    task_t              *head;      // The first task in the queue.
+    task_t              *tail;      // The last task in the queue.
+    size_t              pending;    // The number of queued and running tasks.
+    int                 shutdown;   // Set when the pool is being destroyed.
+    pthread_mutex_t     lock;       // Protects the queue and the counters.
+    pthread_cond_t      ready;      // Signalled when a task is queued.
+    pthread_cond_t      done;       // Signalled when pending drops to zero.
+} thread_pool_t;
+
+
+
+
+
+/*
+ * Function prototypings of procedures regarding
+ * the thread pool data structure such as create,
+ * submit,wait,free etc...
+ *
+ */
+
+thread_pool_t       *thread_pool_create(size_t nworkers);
+void                thread_pool_submit(thread_pool_t *tp,TaskFn fn,void *arg);
+void                thread_pool_post(thread_pool_t *tp,task_t *task);
+void                thread_pool_wait(thread_pool_t *tp);
+size_t              thread_pool_cpus(void);
+void                thread_pool_free(thread_pool_t *tp);
+
+
+
+
+
+/*
+ * Once everything has been copy-pasted by the 
+ * compiler and the macro THREAD_POOL_H has been
+ * defined the thread_pool.h header file will not
+ * be included more than once.
+ *
+ */
+
+#endif
@@ -0,0 +1,202 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * synthetic dataset generator.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the standard
+ * mathematics library,the gsl random number
+ * generators and distributions and the header
+ * file "generator.h" that contains datatype
+ * definitions and function prototypings regarding
+ * the synthetic dataset generator.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <math.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include "generator.h"
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function generator_columns() returns the number of columns
+ * of the generated dataset,namely the signals and the targets.
+ *
+ * @param:  generator_t     *g
+ * @return: llint
+ *
+ */
+
+llint generator_columns(generator_t *g)
+{
+    assert(g!=NULL);
+    if (g->shape==GENERATE_THYROID) { return g->signals+g->classes; }
+    return g->signals+1;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(s*c)      Where s is the number of signals
+ *                          and c the number of classes.
+ *
+ * The static function thyroid_row() writes a single row of the
+ * classification shape.Like the thyroid dataset the first class
+ * is the most frequent one,the class priors fall with the square
+ * of the class index.Every signal has its own magnitude,like the
+ * lab values of the thyroid dataset,and every class a gaussian
+ * centre within it.The targets are written as a one-hot vector.
+ *
+ */
+
+static void thyroid_row(FILE *f,generator_t *g,gsl_rng *r,double *centres,double *scales,double *priors)
+{
+    llint j,c=0; double u=gsl_rng_uniform(r);
+    while (c+1<g->classes && u>=priors[c]) { u-=priors[c]; c++; }
+    for (j=0;j<g->signals;j++)
+    {
+        fprintf(f,"%.6g ",centres[c*g->signals+j]+gsl_ran_gaussian(r,g->noise*scales[j]));
+    }
+    for (j=0;j<g->classes;j++) { fprintf(f,"%d%c",j==c,j+1==g->classes ? '\n' : ' '); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(s)        Where s is the number of signals.
+ *
+ * The static function circle_row() writes a single row of the circle
+ * shape.The signals are drawn uniformly from a ball of radius 0.5
+ * centred at 1 and the target is the height of the hemisphere above
+ * them,so a single signal gives the half circle of circle.data.
+ *
+ */
+
+static void circle_row(FILE *f,generator_t *g,gsl_rng *r,double *x)
+{
+    llint j; double norm=0.0,radius,height;
+    for (j=0;j<g->signals;j++) { x[j]=gsl_ran_gaussian(r,1.0); norm+=x[j]*x[j]; }
+    norm=sqrt(norm); radius=0.5*pow(gsl_rng_uniform(r),1.0/(double )g->signals);
+    height=0.0;
+    for (j=0;j<g->signals;j++)
+    {
+        x[j]=(norm>0.0 ? radius*x[j]/norm : 0.0);
+        height+=x[j]*x[j];
+        fprintf(f,"%.6f ",x[j]+1.0);
+    }
+    height=sqrt(fmax(0.25-height,0.0))+1.0;
+    fprintf(f,"%.6f\n",height+gsl_ran_gaussian(r,g->noise*0.5));
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(s)        Where s is the number of signals.
+ *
+ * The static function sin_row() writes a single row of the sin shape.
+ * The signals are drawn uniformly from [ 0, 2*pi ] and the target is
+ * the sin of their mean,so a single signal gives sin.data.
+ *
+ */
+
+static void sin_row(FILE *f,generator_t *g,gsl_rng *r)
+{
+    llint j; double x,sum=0.0;
+    for (j=0;j<g->signals;j++)
+    {
+        x=2.0*M_PI*gsl_rng_uniform(r); sum+=x;
+        fprintf(f,"%.6f ",x);
+    }
+    fprintf(f,"%.6f\n",sin(sum/(double )g->signals)+gsl_ran_gaussian(r,g->noise));
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*s)      Where r is the number of rows and
+ *                          s the number of columns.
+ *
+ * The function generator_write() takes two arguments as parameters,
+ * namely an output stream and the settings of the generated dataset.
+ * It writes the number of rows and columns in the first two lines,like
+ * the bundled datasets,and then streams the rows one at a time,so the
+ * memory used does not depend on the number of rows.The same seed always
+ * produces the same dataset.The number of written rows is returned.
+ *
+ * @param:  FILE            *f
+ * @param:  generator_t     *g
+ * @return: llint
+ *
+ */
+
+llint generator_write(FILE *f,generator_t *g)
+{
+    // Variable declarations
+    // and type assertions.
+    llint i,j,c;
+    double *centres=NULL,*scales=NULL;
+    double *priors=NULL,*x=NULL,total=0.0;
+    gsl_rng *r=NULL;
+    assert(f!=NULL && g!=NULL);
+    assert(g->rows>0 && g->signals>0 && g->noise>=0.0);
+    assert(g->shape!=GENERATE_THYROID || g->classes>1);
+
+    // Seeding the random number generator
+    // and allocating the per signal buffers.
+    r=gsl_rng_alloc(gsl_rng_taus); gsl_rng_set(r,g->seed);
+    x=(double *)malloc(g->signals*sizeof(double ));
+    assert(x!=NULL);
+
+    // Drawing the magnitudes of the signals,the class
+    // centres and the class priors of the classification
+    // shape before any row is written.
+    if (g->shape==GENERATE_THYROID)
+    {
+        scales=(double *)malloc(g->signals*sizeof(double ));
+        centres=(double *)malloc(g->classes*g->signals*sizeof(double ));
+        priors=(double *)malloc(g->classes*sizeof(double ));
+        assert(scales!=NULL && centres!=NULL && priors!=NULL);
+        for (j=0;j<g->signals;j++) { scales[j]=pow(10.0,2.3*gsl_rng_uniform(r)); }
+        for (c=0;c<g->classes;c++)
+        {
+            for (j=0;j<g->signals;j++) { centres[c*g->signals+j]=scales[j]*gsl_rng_uniform(r); }
+            priors[c]=1.0/(double )((c+1)*(c+1)); total+=priors[c];
+        } for (c=0;c<g->classes;c++) { priors[c]/=total; }
+    }
+
+    // Writing the dimensions of the dataset
+    // and then streaming its rows.
+    fprintf(f,"%lld\n%lld\n",g->rows,generator_columns(g));
+    for (i=0;i<g->rows;i++)
+    {
+        if (g->shape==GENERATE_THYROID) { thyroid_row(f,g,r,centres,scales,priors); }
+        if (g->shape==GENERATE_CIRCLE)  { circle_row(f,g,r,x); }
+        if (g->shape==GENERATE_SIN)     { sin_row(f,g,r); }
+    }
+
+    free(x); free(scales); free(centres); free(priors);
+    gsl_rng_free(r); return g->rows;
+}
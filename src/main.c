@@ -18,7 +18,8 @@
  * the standard utilities library,the standard
  * assertions library,the standard mathematics
  * library,the standard string manipulation
- * library,the standard unix file library,
+ * library,the character classification library,
+ * the standard unix file library,
  * the stadard unix types library,the unix
  * standard symbolic constants and types
  * library,the dataset.h header file that
@@ -38,6 +39,7 @@
 #include <assert.h>
 #include <math.h>
 #include <string.h>
+#include <ctype.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -47,16 +49,47 @@
 
 
 
+/*
+ * Including the header files of the procedures
+ * behind every execution type,the evaluation and
+ * search of models,the training instrumentation,
+ * the synthetic datasets,the model compressions,
+ * the export into C source and the backends.
+ *
+ */
+
+#include "neural_eval.h"
+#include "neural_search.h"
+#include "telemetry.h"
+#include "generator.h"
+#include "profiler.h"
+#include "perf_counters.h"
+#include "neural_quant.h"
+#include "neural_sparse.h"
+#include "neural_shrink.h"
+#include "neural_lowrank.h"
+#include "neural_half.h"
+#include "neural_distill.h"
+#include "neural_export.h"
+#include "neural_backend.h"
+
+
+
 
 #define EXECUTION_TRAIN             84          // Execution type training.
 #define EXECUTION_PREDICT           80          // Execution type predicting.
+#define EXECUTION_SEARCH            83          // Execution type hyperparameter search.
+#define EXECUTION_GENERATE          71          // Execution type synthetic dataset generation.
+#define EXECUTION_CONVERT           67          // Execution type model precision conversion.
+#define EXECUTION_QUANTIZE          81          // Execution type int8 model quantisation.
+#define EXECUTION_PRUNE             90          // Execution type magnitude pruning.
+#define EXECUTION_SHRINK            78          // Execution type neuron pruning.
+#define EXECUTION_FACTORIZE         70          // Execution type low-rank factorisation.
+#define EXECUTION_EXPORT            69          // Execution type export into C source.
 #define MODE_CLASSIFICATION         67          // Training mode classification.
 #define MODE_CURVEFITTING           85          // Training mode curve fitting.
 #define NORMALIZE_YES               89          // Normalization flag to true.
 #define NORMALIZE_NO                78          // Normalization flag to false.
-#define ACTIVATION_LGST             1           // Logistic activation function.
-#define ACTIVATION_LNR              2           // Linear activation function.
-#define ACTIVATION_HTAN             3           // Hyperbolic tangent activation function.
 
 
 
@@ -82,9 +115,37 @@ int         read_activation(int argc,char **argv);
 double      read_epsilon(int argc,char **argv);
 double      read_eta(int argc,char **argv);
 double      read_momentum(int argc,char **argv);
+double      read_fine_tune_momentum(int argc,char **argv);
 llint       read_epochs(int argc,char **argv);
 double      read_alpha(int argc,char **argv);
 double      read_beta(int argc,char **argv);
+char        *read_option(int argc,char **argv,char *flag);
+llint       read_cross_validate(int argc,char **argv);
+char        *read_test_file(int argc,char **argv);
+llint       read_checkpoint_every(int argc,char **argv);
+char        *read_resume_from(int argc,char **argv);
+telemetry_t *read_telemetry(int argc,char **argv);
+void        read_console(int argc,char **argv,training_session_t *ts);
+void        read_generator(int argc,char **argv,generator_t *g);
+void        dataset_generate(int argc,char **argv);
+int         read_precision(int argc,char **argv);
+int         read_storage(int argc,char **argv);
+neural_backend_t *read_backend(int argc,char **argv);
+size_t      read_threads(int argc,char **argv);
+unsigned long read_seed(int argc,char **argv);
+double      read_fraction(int argc,char **argv);
+llint       read_fine_tune(int argc,char **argv);
+int         read_rank(int argc,char **argv);
+double      read_budget(int argc,char **argv);
+void        read_distill(int argc,char **argv,llint *copies,double *noise,unsigned long *seed);
+void        model_convert(int argc,char **argv);
+void        model_export(int argc,char **argv);
+void        minmax_copy(char *from,char *to);
+void        phase_begin(void);
+void        phase_end(char *phase,double samples);
+void        read_range(int argc,char **argv,char *flag,double lo,double hi,search_range_t *r);
+int         read_activations(int argc,char **argv,int *activations);
+void        read_search_space(int argc,char **argv,search_space_t *space);
 
 
 
@@ -95,8 +156,18 @@ double      read_beta(int argc,char **argv);
  *
  */
 
+dataset_t   *training_dataset_load(char *filename,int ds_type,int norm);
 void        resubstitution_testing(neural_net_t *nn,dataset_t *ds,int mode,int norm);
+void        cross_validation_testing(neural_config_t *config,dataset_t *ds,gsl_matrix *targets,llint k,int mode);
+void        holdout_testing(neural_net_t *nn,dataset_t *ds,char *filename,int mode,int norm,char *directory);
 void        predictions_print(FILE *f,gsl_matrix *m);
+dataset_t   *model_dataset_load(char *filename,int ds_type,int norm,char *directory);
+void        quantization_testing(neural_quant_t *nq,neural_net_t *nn,dataset_t *ds,int mode);
+void        pruning_testing(neural_sparse_t *ns,neural_net_t *nn,dataset_t *ds,int mode);
+void        shrinking_testing(neural_net_t *small,neural_net_t *nn,dataset_t *ds,int mode);
+void        factorization_testing(neural_lowrank_t *nl,neural_net_t *nn,dataset_t *ds,lowrank_report_t *report,int mode);
+void        distillation_testing(neural_net_t *student,neural_net_t *teacher,dataset_t *ds,int mode);
+void        storage_testing(neural_net_t *nn,dataset_t *ds,char *directory,int mode);
 void        predictions_format(gsl_matrix *m,dataset_t *ds,size_t ycol,int mode,int norm);
 double      minmax_scaler(double min,double max,double x,double a,double b);
 double      minmax_descaler(double min,double max,double x,double a,double b);
@@ -107,17 +178,58 @@ void        usage(void);
 
 
 
+/*
+ * The hardware performance counters of the main thread.
+ * They stay NULL unless "--perf-counters" has been given,
+ * in which case the parse,scale,train and predict phases
+ * are measured and reported.
+ *
+ */
+
+static perf_counters_t *counters=NULL;
+
+
+
+
+
+
 int main(int argc,char *argv[])
 {
     int                 ds_type;            // the dataset_t type flag.
     neural_config_t     config;             // The neural configuration data structure.
+    neural_config_t     original;           // The configuration of the network a model is pruned or distilled from.
     neural_net_t        *ann=NULL;          // The neural network data structure.
     dataset_t           *dataset=NULL;      // The dataset data structure.
     char                *filename=NULL;     // The file name variable. 
     char                *dumpDir=NULL;      // The dumping directory name variable.
     char                *loadDir=NULL;      // The  loading directory name variable.
+    char                *testFile=NULL;     // The hold-out test file name variable.
+    llint               folds=0;            // The number of cross validation folds.
+    llint               start=0;            // The epoch the training starts from.
+    char                *resumeDir=NULL;    // The checkpoint directory to resume from.
+    training_session_t  session;            // The training session of the trained network.
+    checkpoint_t        checkpoint={0};     // The periodic training checkpoints.
+    telemetry_t         *telemetry=NULL;    // The per-epoch training metrics.
     FILE                *stream=NULL;       // The file streaming variable.
     gsl_matrix          *results=NULL;      // The results matrix.
+    search_space_t      space;              // The hyperparameter search space.
+    search_result_t     *ranking=NULL;      // The ranked hyperparameter search trials.
+    neural_quant_t      *quant=NULL;        // The int8 quantised neural network.
+    neural_sparse_t     *sparse=NULL;       // The pruned neural network in compressed sparse rows.
+    neural_net_t        *pruned=NULL;       // The neural network that is pruned and fine-tuned.
+    sparse_mask_t       *mask=NULL;         // The synaptic weights the network has been pruned of.
+    neural_lowrank_t    *lowrank=NULL;      // The low-rank factorised neural network.
+    neural_half_t       *half=NULL;         // The neural network with half precision weights.
+    lowrank_report_t    fit;                // The outcome of fitting the ranks of the factorised network.
+    char                *distillDir=NULL;   // The directory of the teacher network to distill from.
+    neural_net_t        *teacher=NULL;      // The teacher network a student is distilled from.
+    gsl_matrix          *soft=NULL;         // The training rows labelled with the outputs of the teacher.
+    llint               copies=0;           // The number of augmented copies of the training rows.
+    double              noise=0.0;          // The relative standard deviation of the augmentation noise.
+    unsigned long       seed=1;             // The seed of the augmentation noise.
+    neural_backend_t    *backend=NULL;      // The compute backend asked for on the command line.
+    dataset_t           *test=NULL;         // The hold-out dataset data structure.
+    struct stat         st={0};             // The status of the dumping directory.
 
     
     // Check the total number of arguments and if there
@@ -132,6 +244,26 @@ int main(int argc,char *argv[])
     // returned value to the type variable.
     int type=read_execution_type(argc,argv);
 
+    // The generation of synthetic datasets and the conversion
+    // of saved models take none of the positional flags of the
+    // other execution types,so they are handled before they are read.
+    if (type==EXECUTION_GENERATE) { dataset_generate(argc,argv); return 0; }
+    if (type==EXECUTION_CONVERT)  { model_convert(argc,argv); return 0; }
+    if (type==EXECUTION_EXPORT)   { model_export(argc,argv); return 0; }
+
+    // Switching the per-layer profiler on if it has been
+    // asked for.The summary is printed when the program
+    // exits,together with the optional chrome trace.
+    if (read_option(argc,argv,"--profile")!=NULL) { profiler_enable(read_option(argc,argv,"--profile-trace=")); }
+
+    // Opening the hardware performance counters if they
+    // have been asked for.Training and predicting still
+    // run when the kernel does not allow them.
+    if (read_option(argc,argv,"--perf-counters")!=NULL && (counters=perf_counters_open())==NULL)
+    {
+        fprintf(stderr,"Could not open the hardware performance counters ( see /proc/sys/kernel/perf_event_paranoid ).\n");
+    }
+
     // Read the mode type and assign the returned
     // value to the mode variable.
     int mode=read_training_mode(argc,argv);
@@ -167,41 +299,19 @@ int main(int argc,char *argv[])
         // filename equals to "stdin",namely the
         // standard input stream,then we read from
         // the stdin stream,if not then we open
-        // the given filename.
+        // the given filename.When distilling the rows
+        // are scaled with the min max values the teacher
+        // was trained with,which the student inherits.
         filename=read_in_file(argc,argv);
-        if (strcmp(filename,"stdin")==0)
-        { 
-            // If the user wants to fetch the training
-            // dataset via unix piping then we assign
-            // the stdin stream to the stream variable.
-            // We instantiate a new dataset_t data structure
-            // with the stream variable and the normalization 
-            // and denormalization functions as parameters.
-            stream=stdin;
-            dataset=dataset_create(stream,ds_type,minmax_scaler,minmax_descaler);
-
-            // If the normalization setting has been set to true
-            // then we normalize the loaded dataset.
-            if (norm==NORMALIZE_YES) { dataset_scale(dataset); }
-        }
+        distillDir=read_option(argc,argv,"--distill-from=");
+        if (distillDir!=NULL) { dataset=model_dataset_load(filename,ds_type,norm,distillDir); }
         else
         {
-            // If the user wants fetch the training dataset
-            // from a regular unix file stream then we open
-            // the given filepath and assign the returned
-            // stream data structure to the stream variable.
-            // We instantiate a new dataset_t data structure
-            // with the stream viarble and the normalization
-            // and denormalization function as parameters.
-            // Once the dataset has been loaded we deallocate
-            // resources associated with the opened stream.
-            stream=fopen(filename,"r");
-            dataset=dataset_create(stream,ds_type,minmax_scaler,minmax_descaler);
-            fclose(stream);
-
-            // If the normalization setting has been set to
-            // true then we normalize the loaded dataset.
-            if (norm==NORMALIZE_YES) { dataset_scale(dataset); }
+            // Otherwise the training dataset is read from
+            // the given file,or via unix piping if the
+            // filename equals to "stdin",and normalized
+            // if the normalization setting has been set.
+            dataset=training_dataset_load(filename,ds_type,norm);
         }
         
         // Reading the name of the directory
@@ -252,6 +362,21 @@ int main(int argc,char *argv[])
         // Reading the beta coefficient for the activation function.
         config.beta=read_beta(argc,argv);
 
+        // Reading the precision the network is stored and
+        // trained in,double precision by default,and the
+        // format its weights are saved in.
+        config.precision=read_precision(argc,argv);
+        config.storage=read_storage(argc,argv);
+
+        // Seeding the initial synaptic weights with the
+        // given seed,or with the current time if none.
+        config.seed=read_seed(argc,argv);
+
+        // Switching to the asked compute backend,if any,
+        // otherwise the default one is kept so that the
+        // training is reproducible across hosts.
+        if ((backend=read_backend(argc,argv))!=NULL) { neural_backend_use(backend); }
+
         // Using the optimized version of the back-propagation
         // algorithm that uses the momentum parameter for faster
         // convergence.
@@ -262,56 +387,111 @@ int main(int argc,char *argv[])
         // we assign the corresponding function pointer to
         // the activate field and derivative field of the
         // neural configuration data structure.
-        if (config.atype==ACTIVATION_LGST)
-        {
-            // If request activation function is the logistic
-            // function then we assign the address of the
-            // logistic function and it's derivative to the
-            // activate and derivate fields.
-            config.activate=logistic_function;
-            config.derivative=logistic_derivative;
-        }
-        else if (config.atype==ACTIVATION_LNR)
-        {
-            // If requested activation function is the linear
-            // function then we assign the address of the
-            // linear function and it's derivative to the
-            // activate and derivative fields.
-            config.activate=linear_function;
-            config.derivative=linear_derivative;
-        }
-        else if (config.atype==ACTIVATION_HTAN)
-        {
-            // If requested activation function is the hyperbolic
-            // tangent function then we assign the address of the
-            // hyperbolic tangent function and it's derivative to
-            // the activate and derivative fields.
-            config.activate=hyperbolic_function;
-            config.derivative=hyperbolic_derivative;
-        } else {}
+        activation_assign(&config);
 
         
         // Creating a new instance of the neural network
         // data structure by passing the neural configuration
         // data structure as an argument.
         ann=neural_net_create(&config);
+        neural_net_threads(ann,read_threads(argc,argv));
+
+
+        // If a teacher has been given the network is distilled
+        // from it.The teacher labels the training rows,and any
+        // augmented copies of them,with its soft outputs,which
+        // the network is trained against instead of the targets.
+        if (distillDir!=NULL)
+        {
+            original.precision=config.precision;
+            teacher=neural_net_load(&original,distillDir);
+            activation_assign(&original);
+            if (original.signals!=config.signals || original.neurons[original.nlayers-1]!=config.neurons[config.nlayers-1])
+            {
+                fprintf(stderr,"The teacher in %s has other input or output signals than the student.\n",distillDir);
+                exit(EXIT_FAILURE);
+            }
+            read_distill(argc,argv,&copies,&noise,&seed);
+            phase_begin(); soft=neural_distill_label(teacher,dataset->data,copies,noise,seed);
+            phase_end("label",(double )soft->size1);
+        }
+
+
+        // Opening a training session over the whole dataset.If
+        // a resume directory has been given the weights,momentum
+        // and epoch counter of an earlier run are restored and the
+        // training carries on from the saved epoch.
+        training_session_init(&session,ann,soft!=NULL ? soft : dataset->data);
+        resumeDir=read_resume_from(argc,argv);
+        if (resumeDir!=NULL && (session.epoch=neural_net_restore(ann,resumeDir))<0)
+        {
+            fprintf(stderr,"Could not resume training from %s.\n",resumeDir);
+            exit(EXIT_FAILURE);
+        }
+
+        // Reading the checkpoint interval.If it has been given
+        // a snapshot of the network is written into the dumping
+        // directory every that many epochs by a background process.
+        checkpoint.every=read_checkpoint_every(argc,argv);
+        checkpoint.directory=dumpDir;
+        if (checkpoint.every>0) { session.on_epoch=checkpoint_epoch; session.arg=&checkpoint; }
+
+        // Reading the console and telemetry options.The progress
+        // line may be silenced or rate limited and the metrics of
+        // every epoch may be written as JSON lines into a file.
+        read_console(argc,argv,&session);
+        telemetry=read_telemetry(argc,argv);
+        if (telemetry!=NULL) { telemetry_attach(telemetry,&session); }
 
 
         // Once the neural network data structure has been
         // created and properly configured we begin the training
         // process using the read dataset.
-        neural_net_train(ann,dataset->data);
+        start=session.epoch; phase_begin();
+        backpropagation_session(ann,soft!=NULL ? soft : dataset->data,&session);
+        phase_end("train",(double )session.rows*(double )(session.epoch-start));
+        if (telemetry!=NULL) { telemetry_free(telemetry); }
 
         
         // Once the training process has been completed as well
         // we save the current instance of the neural network
         // data structure into the specified directory name.
-        neural_net_dump(ann,dumpDir);
+        // When checkpointing the last writer is awaited first
+        // and the final model is saved as a checkpoint,so the
+        // run can be resumed with a larger epoch budget.
+        if (checkpoint_finish(&checkpoint)!=0) { fprintf(stderr,"Could not write a checkpoint into %s.\n",dumpDir); }
+        if (checkpoint.every>0) { neural_net_checkpoint(ann,dumpDir,session.epoch); }
+        else { neural_net_dump(ann,dumpDir); }
+
+        // Reporting what saving the weights in a half
+        // precision format costs in accuracy.Checkpoints
+        // are always saved in the precision of the network.
+        if (checkpoint.every==0 && config.storage!=STORAGE_NATIVE) { storage_testing(ann,dataset,dumpDir,mode); }
 
         // Applying A simple resubstitution test to check on
         // the performance of the trained neural network.
         resubstitution_testing(ann,dataset,mode,norm);
 
+        // Reading the number of cross validation folds.If it
+        // has been given we train that many extra networks
+        // concurrently on permuted views of the same dataset
+        // and report their scores on the held-out rows.A
+        // distilled network's folds train on the soft outputs.
+        folds=read_cross_validate(argc,argv);
+        if (folds>1) { cross_validation_testing(&config,dataset,soft,folds,mode); }
+
+        // Reading the name of the hold-out test file.If it
+        // has been given the trained network is scored on
+        // the unseen rows of that file.
+        testFile=read_test_file(argc,argv);
+        if (testFile!=NULL) { holdout_testing(ann,dataset,testFile,mode,norm,dumpDir); }
+
+        // Comparing a distilled network with its teacher on
+        // the hold-out rows if any,or on the training rows
+        // otherwise.
+        if (teacher!=NULL && testFile!=NULL) { test=model_dataset_load(testFile,ds_type,norm,distillDir); }
+        if (teacher!=NULL) { distillation_testing(ann,teacher,test!=NULL ? test : dataset,mode); }
+
         // Checking whether the user has set the normalization
         // flag.If so we have to save in binary the mininum and
         // maximum values for each column in the training dataset.
@@ -322,6 +502,8 @@ int main(int argc,char *argv[])
         // neural network data structure,the dataset data structure
         // and the neurons array associated with the configuration
         // data structure.
+        if (test!=NULL) { dataset_free(test); }
+        if (teacher!=NULL) { neural_net_free(teacher); gsl_matrix_free(soft); free(original.neurons); }
         neural_net_free(ann);
         dataset_free(dataset);
         free(config.neurons);
@@ -346,7 +528,7 @@ int main(int argc,char *argv[])
             // a new instance of the dataset_t data structure
             // using the stream variable and the normalization
             // and denormalization functions as arguments.
-            stream=stdin;
+            stream=stdin; phase_begin();
             dataset=dataset_create(stream,ds_type,minmax_scaler,minmax_descaler);
         }
         else
@@ -359,10 +541,10 @@ int main(int argc,char *argv[])
             // and denormalization functions as paarameters.Once the values
             // have been loaded we deallocated resources associated with the
             // opened stream data structure.
-            stream=fopen(filename,"r");
+            stream=fopen(filename,"r"); phase_begin();
             dataset=dataset_create(stream,ds_type,minmax_scaler,minmax_descaler);
             fclose(stream);
-        }
+        } phase_end("parse",(double )dataset->rows);
         
         // Reading the name of the directory that contains
         // the save neural network data structure.
@@ -376,52 +558,52 @@ int main(int argc,char *argv[])
             // specified directory and scale the values of
             // the dataset data structure.
             dataset_load_minmax(dataset,loadDir);
-            dataset_scale(dataset);
+            phase_begin(); dataset_scale(dataset);
+            phase_end("scale",(double )dataset->rows);
         }
         
 
         // Loading the saved neural network data structure
-        // from the specified directory name.
-        ann=neural_net_load(&config,loadDir);
+        // from the specified directory name in the asked
+        // precision.The saved weights are converted to it.
+        // A directory that holds a quantised model is loaded
+        // into the int8 inference engine instead and one that
+        // holds a pruned model into the sparse inference engine,
+        // one that holds a factorised model into the low-rank one.
+        // Weights saved in fp16 or bf16 are kept in two bytes by
+        // the half precision engine unless f32 has been asked for.
+        config.precision=read_precision(argc,argv);
+        if (neural_quant_exists(loadDir))        { quant=neural_quant_load(&config,loadDir);     }
+        else if (neural_sparse_exists(loadDir))  { sparse=neural_sparse_load(&config,loadDir);   }
+        else if (neural_lowrank_exists(loadDir)) { lowrank=neural_lowrank_load(&config,loadDir); }
+        else if (config.precision==PRECISION_F64 && neural_half_exists(loadDir)) { half=neural_half_load(&config,loadDir); }
+        else                                     { ann=neural_net_load(&config,loadDir);         }
 
         // Based on the supplied activation function type
         // we assign the corresponding function pointer to
         // the activate field and derivative field of the
         // neural configuration data structure.
-        if (config.atype==ACTIVATION_LGST)
-        {
-            // If request activation function is the logistic
-            // function then we assign the address of the
-            // logistic function and it's derivative to the
-            // activate and derivate fields.
-            config.activate=logistic_function;
-            config.derivative=logistic_derivative;
-        }
-        else if (config.atype==ACTIVATION_LNR)
-        {
-            // If requested activation function is the linear
-            // function then we assign the address of the
-            // linear function and it's derivative to the
-            // activate and derivative fields.
-            config.activate=linear_function;
-            config.derivative=linear_derivative;
-        }
-        else if (config.atype==ACTIVATION_HTAN)
-        {
-            // If requested activation function is the hyperbolic
-            // tangent function then we assign the address of the
-            // hyperbolic tangent function and it's derivative to
-            // the activate and derivative fields.
-            config.activate=hyperbolic_function;
-            config.derivative=hyperbolic_derivative;
-        } else {}
+        activation_assign(&config);
+
+        // Switching a loaded network to the asked compute
+        // backend,or by default to the one the autotuner
+        // picks for this host and cached next to the model.
+        if ((ann!=NULL || half!=NULL) && (backend=read_backend(argc,argv))!=NULL) { neural_backend_use(backend); }
+        else if (ann!=NULL) { neural_backend_select(ann,loadDir,dataset->data->size1); }
+        if (ann!=NULL) { neural_net_threads(ann,read_threads(argc,argv)); }
         
 
         // Fetching the given unseed data into the loaded
         // neural network data structure and storing the
         // corresponding output signals into the results
         // matrix data structure.
-        results=neural_net_predict(ann,dataset->data);
+        phase_begin();
+        if (quant!=NULL)        { results=neural_quant_predict(quant,dataset->data);     }
+        else if (sparse!=NULL)  { results=neural_sparse_predict(sparse,dataset->data);   }
+        else if (lowrank!=NULL) { results=neural_lowrank_predict(lowrank,dataset->data); }
+        else if (half!=NULL)    { results=neural_half_predict(half,dataset->data);       }
+        else                    { results=neural_net_predict(ann,dataset->data);         }
+        phase_end("predict",(double )dataset->rows);
 
         // Formating the output signals based on the given command
         // line parameters and printing them in a user-friendly format.
@@ -433,11 +615,270 @@ int main(int argc,char *argv[])
         // the dataset data structure and the neurons array of
         // the neural configuration data structure.
         gsl_matrix_free(results);
+        if (quant!=NULL)        { neural_quant_free(quant);     }
+        else if (sparse!=NULL)  { neural_sparse_free(sparse);   }
+        else if (lowrank!=NULL) { neural_lowrank_free(lowrank); }
+        else if (half!=NULL)    { neural_half_free(half);       }
+        else                    { neural_net_free(ann);         }
+        dataset_free(dataset);
+        free(config.neurons);
+    }
+
+    // Check if the value of the type variable is
+    // equal to the value of the EXECUTION_QUANTIZE macro.
+    if (type==EXECUTION_QUANTIZE)
+    {
+        // If so,we load the saved model and the calibration
+        // rows,scaled like the training rows were,and quantise
+        // the synaptic weights and the signals of every layer.
+        loadDir=read_load_dir(argc,argv);
+        dumpDir=read_option(argc,argv,"--dump-dir=");
+        if (dumpDir==NULL) { usage(); exit(EXIT_FAILURE); }
+        dataset=model_dataset_load(read_in_file(argc,argv),ds_type,norm,loadDir);
+        config.precision=read_precision(argc,argv);
+        ann=neural_net_load(&config,loadDir);
+        activation_assign(&config);
+        if (dataset->columns<config.signals) { fprintf(stderr,"The calibration file has too few columns.\n"); exit(EXIT_FAILURE); }
+        quant=neural_quant_create(ann,dataset->data);
+
+        // Saving the quantised model together with the
+        // min max values of the normalization.
+        if (stat(dumpDir,&st)==-1) { mkdir(dumpDir,0700); }
+        neural_quant_dump(quant,dumpDir);
+        minmax_copy(loadDir,dumpDir);
+
+        // Comparing the quantised model with the saved one
+        // on the hold-out rows if any,or on the calibration
+        // rows otherwise.
+        testFile=read_test_file(argc,argv);
+        if (testFile!=NULL) { test=model_dataset_load(testFile,ds_type,norm,loadDir); }
+        quantization_testing(quant,ann,test!=NULL ? test : dataset,mode);
+
+        if (test!=NULL) { dataset_free(test); }
+        neural_quant_free(quant);
         neural_net_free(ann);
         dataset_free(dataset);
         free(config.neurons);
     }
 
+    // Check if the value of the type variable is
+    // equal to the value of the EXECUTION_PRUNE macro.
+    if (type==EXECUTION_PRUNE)
+    {
+        // If so,we load the saved model twice,once to keep
+        // as the reference and once to prune,together with
+        // the rows of the input file scaled like the training
+        // rows were.
+        loadDir=read_load_dir(argc,argv);
+        dumpDir=read_option(argc,argv,"--dump-dir=");
+        if (dumpDir==NULL) { usage(); exit(EXIT_FAILURE); }
+        dataset=model_dataset_load(read_in_file(argc,argv),ds_type,norm,loadDir);
+        config.precision=read_precision(argc,argv);
+        original.precision=config.precision;
+        ann=neural_net_load(&original,loadDir);
+        pruned=neural_net_load(&config,loadDir);
+        activation_assign(&original);
+        activation_assign(&config);
+        if (dataset->columns<config.signals) { fprintf(stderr,"The input file has too few columns.\n"); exit(EXIT_FAILURE); }
+
+        // Zeroing the smallest synaptic weights of every layer
+        // and fine-tuning the rest for the given number of epochs,
+        // with the given momentum if any.
+        // The mask is applied after every row,so the pruned
+        // weights stay at zero.
+        pruned=neural_net_momentum(pruned,read_fine_tune_momentum(argc,argv));
+        mask=neural_sparse_prune(pruned,read_fraction(argc,argv));
+        training_session_init(&session,pruned,dataset->data);
+        session.epochs=read_fine_tune(argc,argv);
+        session.on_row=neural_sparse_mask_apply; session.row_arg=mask;
+        read_console(argc,argv,&session);
+        if (session.epochs>0 && dataset->columns!=config.signals+config.neurons[config.nlayers-1])
+        {
+            fprintf(stderr,"Fine-tuning needs the target columns in the input file.\n");
+            exit(EXIT_FAILURE);
+        }
+        phase_begin();
+        if (session.epochs>0) { backpropagation_session(pruned,dataset->data,&session); }
+        phase_end("fine-tune",(double )dataset->rows*(double )session.epoch);
+
+        // Saving the pruned model in compressed sparse rows
+        // together with the min max values of the normalization.
+        sparse=neural_sparse_create(pruned);
+        if (stat(dumpDir,&st)==-1) { mkdir(dumpDir,0700); }
+        neural_sparse_dump(sparse,dumpDir);
+        minmax_copy(loadDir,dumpDir);
+
+        // Comparing the pruned model with the saved one
+        // on the hold-out rows if any,or on the input
+        // rows otherwise.
+        testFile=read_test_file(argc,argv);
+        if (testFile!=NULL) { test=model_dataset_load(testFile,ds_type,norm,loadDir); }
+        pruning_testing(sparse,ann,test!=NULL ? test : dataset,mode);
+
+        if (test!=NULL) { dataset_free(test); }
+        neural_sparse_mask_free(mask);
+        neural_sparse_free(sparse);
+        neural_net_free(pruned);
+        neural_net_free(ann);
+        dataset_free(dataset);
+        free(original.neurons);
+        free(config.neurons);
+    }
+
+    // Check if the value of the type variable is
+    // equal to the value of the EXECUTION_SHRINK macro.
+    if (type==EXECUTION_SHRINK)
+    {
+        // If so,we load the saved model and the rows of the
+        // input file scaled like the training rows were,and
+        // remove the weakest hidden neurons of every layer
+        // into a new,smaller network.
+        loadDir=read_load_dir(argc,argv);
+        dumpDir=read_option(argc,argv,"--dump-dir=");
+        if (dumpDir==NULL) { usage(); exit(EXIT_FAILURE); }
+        dataset=model_dataset_load(read_in_file(argc,argv),ds_type,norm,loadDir);
+        original.precision=read_precision(argc,argv);
+        ann=neural_net_load(&original,loadDir);
+        activation_assign(&original);
+        if (dataset->columns<original.signals) { fprintf(stderr,"The input file has too few columns.\n"); exit(EXIT_FAILURE); }
+        pruned=neural_shrink_create(ann,&config,read_fraction(argc,argv),read_rank(argc,argv),dataset->data);
+
+        // Fine-tuning the smaller network for the given
+        // number of epochs on the rows of the input file,
+        // with the given momentum if any.
+        pruned=neural_net_momentum(pruned,read_fine_tune_momentum(argc,argv));
+        training_session_init(&session,pruned,dataset->data);
+        session.epochs=read_fine_tune(argc,argv);
+        read_console(argc,argv,&session);
+        if (session.epochs>0 && dataset->columns!=config.signals+config.neurons[config.nlayers-1])
+        {
+            fprintf(stderr,"Fine-tuning needs the target columns in the input file.\n");
+            exit(EXIT_FAILURE);
+        }
+        phase_begin();
+        if (session.epochs>0) { backpropagation_session(pruned,dataset->data,&session); }
+        phase_end("fine-tune",(double )dataset->rows*(double )session.epoch);
+
+        // Saving the smaller network as an ordinary model
+        // together with the min max values of the normalization.
+        if (stat(dumpDir,&st)==-1) { mkdir(dumpDir,0700); }
+        neural_net_dump(pruned,dumpDir);
+        minmax_copy(loadDir,dumpDir);
+
+        // Comparing the smaller network with the saved one
+        // on the hold-out rows if any,or on the input rows
+        // otherwise.
+        testFile=read_test_file(argc,argv);
+        if (testFile!=NULL) { test=model_dataset_load(testFile,ds_type,norm,loadDir); }
+        shrinking_testing(pruned,ann,test!=NULL ? test : dataset,mode);
+
+        if (test!=NULL) { dataset_free(test); }
+        neural_net_free(pruned);
+        neural_net_free(ann);
+        dataset_free(dataset);
+        free(original.neurons);
+        free(config.neurons);
+    }
+
+    // Check if the value of the type variable is
+    // equal to the value of the EXECUTION_FACTORIZE macro.
+    if (type==EXECUTION_FACTORIZE)
+    {
+        // If so,we load the saved model and the rows of the
+        // input file scaled like the training rows were.The
+        // ranks are fitted on these rows,so they need the
+        // target columns.
+        loadDir=read_load_dir(argc,argv);
+        dumpDir=read_option(argc,argv,"--dump-dir=");
+        if (dumpDir==NULL) { usage(); exit(EXIT_FAILURE); }
+        dataset=model_dataset_load(read_in_file(argc,argv),ds_type,norm,loadDir);
+        config.precision=read_precision(argc,argv);
+        ann=neural_net_load(&config,loadDir);
+        activation_assign(&config);
+        if (dataset->columns!=config.signals+config.neurons[config.nlayers-1])
+        {
+            fprintf(stderr,"Fitting the ranks needs the target columns in the input file.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        // Decomposing the synaptic weights of every layer and
+        // keeping the smallest ranks that stay within the budget.
+        phase_begin();
+        lowrank=neural_lowrank_create(ann);
+        neural_lowrank_fit(lowrank,ann,dataset,read_budget(argc,argv),&fit);
+        phase_end("factorize",(double )dataset->rows);
+
+        // Saving the factorised model together with the
+        // min max values of the normalization.
+        if (stat(dumpDir,&st)==-1) { mkdir(dumpDir,0700); }
+        neural_lowrank_dump(lowrank,dumpDir);
+        minmax_copy(loadDir,dumpDir);
+
+        // Comparing the factorised model with the saved one
+        // on the hold-out rows if any,or on the input rows
+        // otherwise.
+        testFile=read_test_file(argc,argv);
+        if (testFile!=NULL) { test=model_dataset_load(testFile,ds_type,norm,loadDir); }
+        factorization_testing(lowrank,ann,test,&fit,mode);
+
+        if (test!=NULL) { dataset_free(test); }
+        neural_lowrank_free(lowrank);
+        neural_net_free(ann);
+        dataset_free(dataset);
+        free(config.neurons);
+    }
+
+    // Check if the value of the type variable is
+    // equal to the value of the EXECUTION_SEARCH macro.
+    if (type==EXECUTION_SEARCH)
+    {
+        // If so,we parse and scale the training dataset
+        // only once.Every trial of the search is trained
+        // against this single in-memory matrix.
+        filename=read_in_file(argc,argv);
+        dataset=training_dataset_load(filename,ds_type,norm);
+        dumpDir=read_dump_dir(argc,argv);
+
+        // Reading the ranges of the hyperparameters and
+        // the settings of the search itself.The number of
+        // output neurons is given by the target columns.
+        space.signals=read_signals(argc,argv)+1;
+        space.outputs=dataset->columns-space.signals;
+        if (space.outputs<1) { fprintf(stderr,"The dataset has no target columns.\n"); exit(EXIT_FAILURE); }
+        read_search_space(argc,argv,&space);
+
+        // Running the trials concurrently and printing
+        // the ranked results table.The same table is
+        // saved next to the best model.
+        ranking=search_run(&space,dataset);
+        search_report(stdout,ranking,dataset->type);
+        printf(WHT"SEARCH EPOCHS:"RESET" %lld trained of %lld without early stopping (%.1f%%)\n",ranking->epochs_used,
+            ranking->epochs_full,100.0*(double )ranking->epochs_used/(double )ranking->epochs_full);
+        filename=(char *)malloc((strlen(dumpDir)+strlen("/search_results.txt")+1)*sizeof(char ));
+        assert(filename!=NULL);
+        strcpy(filename,dumpDir); strcat(filename,"/search_results.txt");
+        stream=fopen(filename,"w");
+        if (stream!=NULL) { search_report(stream,ranking,dataset->type); fclose(stream); }
+        free(filename); filename=NULL;
+
+        // Saving the network of the best trial and the
+        // minimum and maximum values of the dataset into
+        // the dumping directory so that it can be used
+        // with the "--predict" execution type.
+        if (ranking->best!=NULL)
+        {
+            neural_net_dump(ranking->best,dumpDir);
+            if (norm==NORMALIZE_YES) { dataset_dump_minmax(dataset,dumpDir); }
+        }
+
+        search_result_free(ranking);
+        dataset_free(dataset);
+    }
+
+    // Closing the hardware performance counters
+    // if they have been opened.
+    if (counters!=NULL) { perf_counters_close(counters); counters=NULL; }
+
     // Return the value zero back to the operating system
     // indicating that everything went as expected and no
     // errors or problems were encountered during execution.
@@ -465,6 +906,14 @@ int read_execution_type(int argc,char **argv)
 {
     if (argc>=2 && strcmp(argv[1],"--train")==0)   { return EXECUTION_TRAIN;   }
     if (argc>=2 && strcmp(argv[1],"--predict")==0) { return EXECUTION_PREDICT; }
+    if (argc>=2 && strcmp(argv[1],"--search")==0)  { return EXECUTION_SEARCH;  }
+    if (argc>=2 && strcmp(argv[1],"--generate")==0) { return EXECUTION_GENERATE; }
+    if (argc>=2 && strcmp(argv[1],"--convert")==0)  { return EXECUTION_CONVERT;  }
+    if (argc>=2 && strcmp(argv[1],"--quantize")==0) { return EXECUTION_QUANTIZE; }
+    if (argc>=2 && strncmp(argv[1],"--prune=",8)==0) { return EXECUTION_PRUNE; }
+    if (argc>=2 && strncmp(argv[1],"--shrink=",9)==0) { return EXECUTION_SHRINK; }
+    if (argc>=2 && strcmp(argv[1],"--factorize")==0) { return EXECUTION_FACTORIZE; }
+    if (argc>=2 && strncmp(argv[1],"--export-c=",11)==0) { return EXECUTION_EXPORT; }
     usage(); exit(EXIT_FAILURE);
 }
 
@@ -765,6 +1214,30 @@ double read_momentum(int argc,char **argv)
 
 
 
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_fine_tune_momentum() reads the momentum
+ * value a pruned or shrunk model is fine-tuned with from the command
+ * line arguments and returns it.A saved model keeps no velocity,so if
+ * the "--momentum" flag was not specified the model is fine-tuned
+ * without momentum.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: double
+ *
+ */
+
+double read_fine_tune_momentum(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--momentum=");
+    return (value!=NULL ? atof(value) : 0.0);
+}
+
+
+
 /*
  * @COMPLEXITY: Theta(1)
  *
@@ -832,134 +1305,1344 @@ double read_beta(int argc,char **argv)
 
 
 /*
- * @COMPLEXITY: Theta(1)
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
  *
- * The function minmax_scaler() takes five arguments as parameters.
- * The first two are the minimum and maximum values of some column j.
- * The third parameter is an element of the i of the column and a,b
- * are the values that specify the range of scaling e,g [0,1] or [-1,-1].
- * This function returns the new normalized value of x.
+ * The helper function read_option() scans every command line argument
+ * for the given flag prefix and returns the text that follows it,or
+ * NULL if the flag was not specified.Unlike the positional options above
+ * the flags read through this function may appear in any order after
+ * the mandatory ones.
  *
- * @param:  double      min
- * @param:  double      max
- * @param:  double      x
- * @param:  double      a
- * @param:  double      b
- * @return: double
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @param:  char    *flag
+ * @return: char    *
  *
  */
-double minmax_scaler(double min,double max,double x,double a,double b)
+
+char *read_option(int argc,char **argv,char *flag)
 {
-    double result=a*((x-min)/(max-min))-b;
-    return result;
+    int i; size_t len=strlen(flag);
+    for (i=1;i<argc;i++) { if (strncmp(argv[i],flag,len)==0) { return &argv[i][len]; } }
+    return NULL;
 }
 
 
+
 /*
- * @COMPLEXITY: Theta(1)
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
  *
- * The function minimax_descaler() is the opposite function of the
- * minmax_scaler function.Instead of normalizing the given data it
- * denormalizes it back to it's original form.
+ * The helper function read_cross_validate() reads the number of folds
+ * for the k-fold cross validation from the command line arguments,parses
+ * it into a long long int and returns it.If the "--cross-validate" flag
+ * was not specified zero is returned and no cross validation takes place.
  *
- * @param:  double      min
- * @param:  double      max
- * @param:  double      x
- * @param:  double      a
- * @param:  double      b
- * @return: double
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: llint
  *
  */
 
-double minmax_descaler(double min,double max,double x,double a,double b)
+llint read_cross_validate(int argc,char **argv)
 {
-    double result=(((x+b)*(max-min))/a)+min;
-    return result;
+    char *value=read_option(argc,argv,"--cross-validate=");
+    if (value==NULL) { return 0; }
+    if (atoll(value)<2) { usage(); exit(EXIT_FAILURE); }
+    return atoll(value);
+}
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_test_file() reads the name of the hold-out
+ * test file from the command line arguments and returns it.If the
+ * "--test-file" flag was not specified NULL is returned.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: char    *
+ *
+ */
+
+char *read_test_file(int argc,char **argv)
+{
+    return read_option(argc,argv,"--test-file=");
 }
 
 
 
 
 /*
- * @COMPLEXITY: O(m*n)      Where ( m x n ) are th dimensions
- *                          of the given matrix data structure.
- * 
- * The function predictions_print() takes three arguments as
- * parameters.The first argument is a file stream data structure
- * and the second argument is a gsl_matrix data structure.This
- * function prints the values of the matrix in a user-friendly
- * format.
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
  *
- * @param:  FILE            *stream
- * @param:  gsl_matrix      *m
- * @return: void
+ * The helper function read_checkpoint_every() reads the number of
+ * epochs between two training checkpoints from the command line
+ * arguments.If the "--checkpoint-every" flag was not specified zero
+ * is returned and no checkpoints are written.If the number is not
+ * positive the usage() function is invoked and the program execution
+ * is terminated.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: llint
  *
  */
 
-void predictions_print(FILE *stream,gsl_matrix *m)
+llint read_checkpoint_every(int argc,char **argv)
 {
-    // variable declarations.
-    size_t i,j; double data;
+    char *value=read_option(argc,argv,"--checkpoint-every=");
+    if (value==NULL) { return 0; }
+    if (atoll(value)<1) { usage(); exit(EXIT_FAILURE); }
+    return atoll(value);
+}
 
-    // Iterating over the rows and
-    // columns of the matrix and
-    // printing it's values into the
-    // specified stream.
-    for (i=0;i<m->size1;i++)
-    {
-        for (j=0;j<m->size2;j++)
-        {
-            data=gsl_matrix_get(m,i,j);
-            fprintf(stream,"%g ",data);
-        } fprintf(stream,"\n");
-    }
-    return;
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_resume_from() reads the name of the
+ * checkpoint directory a training run is resumed from.If the
+ * "--resume-from" flag was not specified NULL is returned.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: char    *
+ *
+ */
+
+char *read_resume_from(int argc,char **argv)
+{
+    return read_option(argc,argv,"--resume-from=");
 }
 
 
 
 
 /*
- * @COMPLEXITY: O(m*n)      Where ( m x n ) are the dimensions of the given matrix.
- *                          
- * 
- * The function predictions_format() takes five arguments as parameters.
- * The first argument is a gsl_matrix data structure that contains the
- * output signals of the neural network.The second argument is a dataset_t
- * data structure.The third argument is the starting index of the output
- * targets in the dataset.The last two are the execution type and training
- * mode of the program.This function formats the output signals of the given
- * predictions matrix based on the neural net configurations.
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
  *
- * @param:  gsl_matrix      *m
- * @param:  dataset_t       *ds
- * @param:  size_t          ycol
- * @param:  int             mode
- * @param:  int             norm
- * @return: void
+ * The helper function read_telemetry() reads the telemetry target and
+ * the number of epochs buffered between two writes from the command line
+ * arguments and returns the opened telemetry.If the "--telemetry" flag
+ * was not specified NULL is returned.If the target cannot be opened or
+ * the interval is not positive the program execution is terminated.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: telemetry_t *
  *
  */
 
-void predictions_format(gsl_matrix *m,dataset_t *ds,size_t ycol,int mode,int norm)
+telemetry_t *read_telemetry(int argc,char **argv)
 {
-    // Variable declarastions,type assertions.
-    assert(m!=NULL && ds!=NULL);
-    assert(mode==MODE_CLASSIFICATION || mode==MODE_CURVEFITTING);
-    gsl_vector_view v; size_t i,j,index; double min,max,data;
-    
-    // Iterating over rows the given matrix data structure.
-    for (i=0;i<m->size1;i++)
-    {
-        // Because the neural network program supports
-        // two types of training,namely pattern classification
-        // and curve fitting, we have to format the output signals
-        // accordingly.
-        
+    telemetry_t *tm=NULL; llint every=100;
+    char *target=read_option(argc,argv,"--telemetry=");
+    char *value=read_option(argc,argv,"--telemetry-every=");
+    if (target==NULL) { return NULL; }
+    if (value!=NULL) { every=atoll(value); }
+    if (every<1) { usage(); exit(EXIT_FAILURE); }
+    tm=telemetry_create(target,(size_t )every);
+    if (tm==NULL) { fprintf(stderr,"Could not open the telemetry target %s.\n",target); exit(EXIT_FAILURE); }
+    return tm;
+}
 
-        // Checking if the training mode is classification.
-        if (mode==MODE_CLASSIFICATION)
-        {
-            // If so,we want to find the cell in the
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_console() reads the console options from
+ * the command line arguments into the given training session."--console=no"
+ * silences the progress line and "--console-interval" sets the minimum
+ * number of seconds between two progress lines,zero prints every epoch.
+ * If a value is invalid the usage() function is invoked and the program
+ * execution is terminated.
+ *
+ * @param:  int                 argc
+ * @param:  char                **argv
+ * @param:  training_session_t  *ts
+ * @return: void
+ *
+ */
+
+void read_console(int argc,char **argv,training_session_t *ts)
+{
+    char *value=read_option(argc,argv,"--console=");
+    if (value!=NULL && strcmp(value,"yes")!=0 && strcmp(value,"no")!=0) { usage(); exit(EXIT_FAILURE); }
+    if (value!=NULL) { ts->quiet=(strcmp(value,"no")==0); }
+    value=read_option(argc,argv,"--console-interval=");
+    if (value!=NULL && atof(value)<0.0) { usage(); exit(EXIT_FAILURE); }
+    if (value!=NULL) { ts->interval=atof(value); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_generator() reads the settings of a synthetic
+ * dataset from the command line arguments.The shape is mandatory,the rest
+ * default to the dimensions of the bundled dataset the shape mimics.If a
+ * value is invalid the usage() function is invoked and the program
+ * execution is terminated.
+ *
+ * @param:  int             argc
+ * @param:  char            **argv
+ * @param:  generator_t     *g
+ * @return: void
+ *
+ */
+
+void read_generator(int argc,char **argv,generator_t *g)
+{
+    char *value=read_option(argc,argv,"--shape=");
+    if (value==NULL) { usage(); exit(EXIT_FAILURE); }
+    if      (strcmp(value,"thyroid")==0) { g->shape=GENERATE_THYROID; g->rows=215; g->signals=5; g->noise=0.1; }
+    else if (strcmp(value,"circle")==0)  { g->shape=GENERATE_CIRCLE;  g->rows=315; g->signals=1; g->noise=0.0; }
+    else if (strcmp(value,"sin")==0)     { g->shape=GENERATE_SIN;     g->rows=629; g->signals=1; g->noise=0.0; }
+    else { usage(); exit(EXIT_FAILURE); }
+    g->classes=3; g->seed=1;
+    if ((value=read_option(argc,argv,"--rows="))!=NULL)    { g->rows=atoll(value); }
+    if ((value=read_option(argc,argv,"--signals="))!=NULL) { g->signals=atoll(value); }
+    if ((value=read_option(argc,argv,"--classes="))!=NULL) { g->classes=atoll(value); }
+    if ((value=read_option(argc,argv,"--noise="))!=NULL)   { g->noise=atof(value); }
+    if ((value=read_option(argc,argv,"--seed="))!=NULL)    { g->seed=strtoul(value,NULL,10); }
+    if (g->rows<1 || g->signals<1 || g->classes<2 || g->noise<0.0) { usage(); exit(EXIT_FAILURE); }
+    return;
+}
+
+
+
+/*
+ * @COMPLEXITY: O(r*c)      Where ( r x c ) are the dimensions of
+ *                          the generated dataset.
+ *
+ * The function dataset_generate() reads the settings of a synthetic
+ * dataset and the name of the output file from the command line arguments
+ * and streams the dataset into it,or into the standard output stream if
+ * the file name is "stdout".The output goes through a large buffer since
+ * the rows are written one at a time.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: void
+ *
+ */
+
+void dataset_generate(int argc,char **argv)
+{
+    generator_t g; FILE *f=stdout;
+    char *filename=read_option(argc,argv,"--out-file=");
+    read_generator(argc,argv,&g);
+    if (filename==NULL) { usage(); exit(EXIT_FAILURE); }
+    if (strcmp(filename,"stdout")!=0 && (f=fopen(filename,"w"))==NULL)
+    {
+        fprintf(stderr,"Could not open the file %s.\n",filename);
+        exit(EXIT_FAILURE);
+    }
+    setvbuf(f,NULL,_IOFBF,1<<20);
+    generator_write(f,&g);
+    if (fflush(f)!=0) { fprintf(stderr,"Could not write the file %s.\n",filename); exit(EXIT_FAILURE); }
+    if (f!=stdout) { fclose(f); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_precision() reads the "--precision" flag
+ * from the command line arguments and returns PRECISION_F32 for "f32"
+ * and PRECISION_F64 for "f64" or if the flag has not been given.If the
+ * value is invalid the usage() function is invoked and the program
+ * execution is terminated.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: int
+ *
+ */
+
+int read_precision(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--precision=");
+    if (value==NULL || strcmp(value,"f64")==0) { return PRECISION_F64; }
+    if (strcmp(value,"f32")==0) { return PRECISION_F32; }
+    usage(); exit(EXIT_FAILURE);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_storage() reads the "--storage" flag from
+ * the command line arguments and returns STORAGE_FP16 for "fp16",
+ * STORAGE_BF16 for "bf16" and STORAGE_NATIVE for "native" or if the
+ * flag has not been given.If the value is invalid the usage() function
+ * is invoked and the program execution is terminated.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: int
+ *
+ */
+
+int read_storage(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--storage=");
+    if (value==NULL || strcmp(value,"native")==0) { return STORAGE_NATIVE; }
+    if (strcmp(value,"fp16")==0) { return STORAGE_FP16; }
+    if (strcmp(value,"bf16")==0) { return STORAGE_BF16; }
+    usage(); exit(EXIT_FAILURE);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_backend() reads the "--backend" flag from
+ * the command line arguments and returns the compute backend of that
+ * name,or NULL for "auto" or if the flag has not been given.If there
+ * is no such backend or it is not available on this host the usage()
+ * function is invoked and the program execution is terminated.
+ *
+ * @param:  int                 argc
+ * @param:  char                **argv
+ * @return: neural_backend_t    *
+ *
+ */
+
+neural_backend_t *read_backend(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--backend="); neural_backend_t *backend=NULL;
+    if (value==NULL || strcmp(value,"auto")==0) { return NULL; }
+    if ((backend=neural_backend_find(value))!=NULL) { return backend; }
+    usage(); exit(EXIT_FAILURE);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_threads() reads the "--threads" flag from
+ * the command line arguments and returns the number of threads the
+ * neurons of the wide layers of a trained or loaded network are split
+ * across.If the flag was not specified zero is returned,one thread
+ * per online processor,as it is for zero itself.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: size_t
+ *
+ */
+
+size_t read_threads(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--threads=");
+    if (value==NULL) { return 0; }
+    if (atoll(value)<0) { usage(); exit(EXIT_FAILURE); }
+    return (size_t )atoll(value);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_seed() reads the "--seed" flag from the
+ * command line arguments and returns it as the seed of the initial
+ * synaptic weights.If the flag was not specified zero is returned and
+ * the weights are seeded with the current time.
+ *
+ * @param:  int             argc
+ * @param:  char            **argv
+ * @return: unsigned long
+ *
+ */
+
+unsigned long read_seed(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--seed=");
+    return (value!=NULL ? strtoul(value,NULL,10) : 0);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the length of the execution type.
+ *
+ * The helper function read_fraction() reads the fraction given to the
+ * "--prune" or "--shrink" execution type,the fraction of the synaptic
+ * weights or of the hidden neurons to prune,which has to lie within
+ * [0,1).If it does not the usage() function is invoked and the program
+ * execution is terminated.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: double
+ *
+ */
+
+double read_fraction(int argc,char **argv)
+{
+    char *value=NULL,*end=NULL; double fraction=0.0;
+    if (argc<2 || (value=strchr(argv[1],'='))==NULL) { usage(); exit(EXIT_FAILURE); }
+    value++; fraction=strtod(value,&end);
+    if (end==value || *end!='\0' || fraction<0.0 || fraction>=1.0) { usage(); exit(EXIT_FAILURE); }
+    return fraction;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_fine_tune() reads the number of epochs
+ * a pruned network is fine-tuned for from the "--fine-tune" flag.
+ * If the flag has not been given zero is returned.If the value is
+ * negative the usage() function is invoked and the program execution
+ * is terminated.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: llint
+ *
+ */
+
+llint read_fine_tune(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--fine-tune=");
+    if (value==NULL) { return 0; }
+    if (atoll(value)<0) { usage(); exit(EXIT_FAILURE); }
+    return atoll(value);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_rank() reads the "--rank" flag from the
+ * command line arguments and returns RANK_NORM for "norm" or if the
+ * flag has not been given and RANK_VARIANCE for "variance".If the value
+ * is invalid the usage() function is invoked and the program execution
+ * is terminated.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: int
+ *
+ */
+
+int read_rank(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--rank=");
+    if (value==NULL || strcmp(value,"norm")==0) { return RANK_NORM; }
+    if (strcmp(value,"variance")==0) { return RANK_VARIANCE; }
+    usage(); exit(EXIT_FAILURE);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_budget() reads the accuracy budget of the
+ * "--factorize" execution type from the "--budget" flag.It is the drop
+ * of the accuracy for classification and the relative growth of the
+ * root mean square error for curve fitting the factorised network may
+ * show.If the flag has not been given 0.01 is returned.If the value is
+ * negative the usage() function is invoked and the program execution
+ * is terminated.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: double
+ *
+ */
+
+double read_budget(int argc,char **argv)
+{
+    char *value=read_option(argc,argv,"--budget="),*end=NULL;
+    double budget=0.01;
+    if (value==NULL) { return budget; }
+    budget=strtod(value,&end);
+    if (end==value || *end!='\0' || budget<0.0) { usage(); exit(EXIT_FAILURE); }
+    return budget;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_distill() reads the augmentation settings of
+ * a distillation,the number of noisy copies of the training rows from the
+ * "--augment" flag,none by default,the standard deviation of the noise as
+ * a fraction of the one of every column from the "--noise" flag,0.1 by
+ * default,and its seed from the "--seed" flag,1 by default.If a value is
+ * negative the usage() function is invoked and the program execution is
+ * terminated.
+ *
+ * @param:  int             argc
+ * @param:  char            **argv
+ * @param:  llint           *copies
+ * @param:  double          *noise
+ * @param:  unsigned long   *seed
+ * @return: void
+ *
+ */
+
+void read_distill(int argc,char **argv,llint *copies,double *noise,unsigned long *seed)
+{
+    char *value=NULL;
+    *copies=0; *noise=0.1; *seed=1;
+    if ((value=read_option(argc,argv,"--augment="))!=NULL) { *copies=atoll(value); }
+    if ((value=read_option(argc,argv,"--noise="))!=NULL)   { *noise=atof(value); }
+    if ((value=read_option(argc,argv,"--seed="))!=NULL)    { *seed=strtoul(value,NULL,10); }
+    if (*copies<0 || *noise<0.0) { usage(); exit(EXIT_FAILURE); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions of the
+ *                      largest synaptic weights matrix.
+ *
+ * The helper function model_convert() loads the model saved in the
+ * "--load-dir" directory,converts its synaptic weights into the given
+ * "--precision" and saves it into the "--dump-dir" directory,in the
+ * given "--storage" format,together with the min max values of the
+ * normalization,if there are any.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: void
+ *
+ */
+
+void model_convert(int argc,char **argv)
+{
+    neural_config_t config; neural_net_t *ann=NULL;
+    char *loadDir=read_option(argc,argv,"--load-dir=");
+    char *dumpDir=read_option(argc,argv,"--dump-dir=");
+    char path[4096]; struct stat st={0};
+
+    if (loadDir==NULL || dumpDir==NULL) { usage(); exit(EXIT_FAILURE); }
+    snprintf(path,sizeof(path),"%s/config.bin",loadDir);
+    if (stat(path,&st)==-1) { fprintf(stderr,"Could not find a saved model in %s.\n",loadDir); exit(EXIT_FAILURE); }
+    if (stat(dumpDir,&st)==-1) { mkdir(dumpDir,0700); }
+
+    // Loading the model in the asked precision and saving
+    // it back into the new directory in the asked format.
+    config.precision=read_precision(argc,argv);
+    ann=neural_net_load(&config,loadDir);
+    config.storage=read_storage(argc,argv);
+    neural_net_dump(ann,dumpDir);
+    neural_net_free(ann); free(config.neurons);
+
+    // Copying the min max values of the normalization.
+    minmax_copy(loadDir,dumpDir);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The helper function model_export() loads the model saved in the
+ * "--load-dir" directory and writes it as standalone C source into
+ * the file given to the "--export-c" execution type,or into the
+ * standard output stream if the file name is "stdout".If the directory
+ * holds the min max values of a normalization they are folded into the
+ * exported model.The identifiers of the source start with the value of
+ * the "--prefix" flag,"model" by default,which has to be a valid C
+ * identifier.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @return: void
+ *
+ */
+
+void model_export(int argc,char **argv)
+{
+    neural_config_t config; neural_net_t *ann=NULL;
+    dataset_t minmax={0}; FILE *out=stdout; size_t i;
+    char *loadDir=read_option(argc,argv,"--load-dir=");
+    char *prefix=read_option(argc,argv,"--prefix=");
+    char *filename=strchr(argv[1],'=')+1,path[4096];
+    struct stat st={0}; int mode=read_training_mode(argc,argv);
+
+    if (loadDir==NULL || *filename=='\0') { usage(); exit(EXIT_FAILURE); }
+    if (prefix==NULL) { prefix="model"; }
+    for (i=0;prefix[i]!='\0';i++)
+    {
+        if (!isalnum((unsigned char )prefix[i]) && prefix[i]!='_') { break; }
+    }
+    if (prefix[i]!='\0' || i==0 || isdigit((unsigned char )prefix[0])) { usage(); exit(EXIT_FAILURE); }
+    snprintf(path,sizeof(path),"%s/config.bin",loadDir);
+    if (stat(path,&st)==-1) { fprintf(stderr,"Could not find a saved model in %s.\n",loadDir); exit(EXIT_FAILURE); }
+
+    // Loading the model and the min max values of the
+    // normalization,if there are any,and writing both
+    // out as C source.
+    config.precision=PRECISION_F64;
+    ann=neural_net_load(&config,loadDir);
+    snprintf(path,sizeof(path),"%s/minmax.bin",loadDir);
+    if (stat(path,&st)==0) { dataset_load_minmax(&minmax,loadDir); }
+    if (strcmp(filename,"stdout")!=0 && (out=fopen(filename,"w"))==NULL)
+    {
+        fprintf(stderr,"Could not write %s.\n",filename);
+        exit(EXIT_FAILURE);
+    }
+    neural_export_c(ann,minmax.minimums,minmax.maximums,mode==MODE_CLASSIFICATION ? DATASET_CLASSIFY : DATASET_PREDICT,prefix,out);
+    if (out!=stdout) { fclose(out); }
+
+    if (minmax.minimums!=NULL) { gsl_vector_free(minmax.minimums); gsl_vector_free(minmax.maximums); }
+    neural_net_free(ann); free(config.neurons);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the size of the min max file.
+ *
+ * The helper function minmax_copy() copies the min max values of the
+ * normalization saved in the first directory into the second one.If
+ * the first directory holds none nothing is copied.
+ *
+ * @param:  char    *from
+ * @param:  char    *to
+ * @return: void
+ *
+ */
+
+void minmax_copy(char *from,char *to)
+{
+    char path[4096],target[4096],buffer[4096];
+    FILE *in=NULL,*out=NULL; size_t n;
+    snprintf(path,sizeof(path),"%s/minmax.bin",from);
+    snprintf(target,sizeof(target),"%s/minmax.bin",to);
+    if ((in=fopen(path,"rb"))==NULL) { return; }
+    if ((out=fopen(target,"wb"))==NULL) { fprintf(stderr,"Could not write %s.\n",target); fclose(in); exit(EXIT_FAILURE); }
+    while ((n=fread(buffer,1,sizeof(buffer),in))>0) { fwrite(buffer,1,n,out); }
+    fclose(in); fclose(out);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The helper functions phase_begin() and phase_end() surround a phase
+ * of the program that is measured by the hardware performance counters.
+ * The second one prints the counts of the phase into the standard error
+ * stream,divided by the given number of samples.Both do nothing unless
+ * the counters have been opened.
+ *
+ * @param:  char    *phase
+ * @param:  double  samples
+ * @return: void
+ *
+ */
+
+void phase_begin(void)
+{
+    if (counters!=NULL) { perf_counters_start(counters); }
+    return;
+}
+
+void phase_end(char *phase,double samples)
+{
+    if (counters==NULL) { return; }
+    perf_counters_stop(counters);
+    perf_counters_print(stderr,counters,phase,samples);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_range() reads a hyperparameter range of
+ * the form "<lo>:<hi>",or a single value "<x>" that fixes it,for the
+ * given flag.If the flag was not specified the given defaults are used.
+ * If the range is reversed the usage() function is invoked and the
+ * program execution is terminated.
+ *
+ * @param:  int             argc
+ * @param:  char            **argv
+ * @param:  char            *flag
+ * @param:  double          lo
+ * @param:  double          hi
+ * @param:  search_range_t  *r
+ * @return: void
+ *
+ */
+
+void read_range(int argc,char **argv,char *flag,double lo,double hi,search_range_t *r)
+{
+    char *value=read_option(argc,argv,flag),*colon=NULL;
+    r->lo=lo; r->hi=hi;
+    if (value==NULL) { return; }
+    r->lo=atof(value); r->hi=r->lo;
+    if ((colon=strchr(value,':'))!=NULL) { r->hi=atof(colon+1); }
+    if (r->hi<r->lo) { usage(); exit(EXIT_FAILURE); }
+    return;
+}
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_activations() reads a comma separated list
+ * of activation function types,e.g "lgst,htan",into the given array
+ * and returns their number.If the "--activation" flag was not specified
+ * the logistic function is used.
+ *
+ * @param:  int     argc
+ * @param:  char    **argv
+ * @param:  int     *activations
+ * @return: int
+ *
+ */
+
+int read_activations(int argc,char **argv,int *activations)
+{
+    int n=0; char *value=read_option(argc,argv,"--activation=");
+    if (value==NULL) { activations[0]=ACTIVATION_LGST; return 1; }
+    while (value!=NULL && *value!='\0' && n<3)
+    {
+        if (strncmp(value,"lgst",4)==0)      { activations[n++]=ACTIVATION_LGST; }
+        else if (strncmp(value,"lnr",3)==0)  { activations[n++]=ACTIVATION_LNR;  }
+        else if (strncmp(value,"htan",4)==0) { activations[n++]=ACTIVATION_HTAN; }
+        else { usage(); exit(EXIT_FAILURE); }
+        value=strchr(value,',');
+        if (value!=NULL) { value++; }
+    } return n;
+}
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of command line arguments.
+ *
+ * The helper function read_search_space() reads the hyperparameter
+ * ranges and the search settings of the "--search" execution type
+ * into the given search space.The signals and outputs fields must
+ * have been set by the caller.Every flag is optional and may appear
+ * in any order after the "--signals" flag.An unknown strategy or
+ * scheduler or a setting out of range invokes the usage() function
+ * and terminates the program execution.
+ *
+ * @param:  int             argc
+ * @param:  char            **argv
+ * @param:  search_space_t  *space
+ * @return: void
+ *
+ */
+
+void read_search_space(int argc,char **argv,search_space_t *space)
+{
+    char *value=NULL;
+    read_range(argc,argv,"--nlayers=",2.0,2.0,&space->nlayers);
+    read_range(argc,argv,"--neurons-per-layer=",2.0,32.0,&space->neurons);
+    read_range(argc,argv,"--eta=",0.1,0.9,&space->eta);
+    read_range(argc,argv,"--momentum=",0.0,0.05,&space->momentum);
+    read_range(argc,argv,"--alpha=",1.0,1.0,&space->alpha);
+    read_range(argc,argv,"--beta=",0.0,0.0,&space->beta);
+    if (space->nlayers.lo<1.0 || space->neurons.lo<1.0) { usage(); exit(EXIT_FAILURE); }
+    space->nactivations=read_activations(argc,argv,space->activations);
+
+    value=read_option(argc,argv,"--epochs=");
+    space->epochs=(value!=NULL ? atoll(value) : 200);
+    value=read_option(argc,argv,"--epsilon=");
+    space->epsilon=(value!=NULL ? atof(value) : 1e-08);
+    value=read_option(argc,argv,"--strategy=");
+    space->strategy=SEARCH_RANDOM;
+    if (value!=NULL && strcmp(value,"grid")==0)        { space->strategy=SEARCH_GRID; }
+    else if (value!=NULL && strcmp(value,"random")!=0) { usage(); exit(EXIT_FAILURE); }
+    value=read_option(argc,argv,"--trials=");
+    space->trials=(value!=NULL ? atoll(value) : 32);
+    value=read_option(argc,argv,"--grid-steps=");
+    space->steps=(value!=NULL ? atoll(value) : 3);
+    value=read_option(argc,argv,"--holdout=");
+    space->holdout=(value!=NULL ? atof(value) : 0.2);
+    value=read_option(argc,argv,"--seed=");
+    space->seed=(value!=NULL ? strtoul(value,NULL,10) : 1);
+    value=read_option(argc,argv,"--threads=");
+    space->threads=(value!=NULL ? (size_t )atoll(value) : 0);
+    value=read_option(argc,argv,"--scheduler=");
+    space->scheduler=SCHEDULE_NONE;
+    if (value!=NULL && strcmp(value,"halving")==0)        { space->scheduler=SCHEDULE_HALVING;   }
+    else if (value!=NULL && strcmp(value,"hyperband")==0) { space->scheduler=SCHEDULE_HYPERBAND; }
+    else if (value!=NULL) { usage(); exit(EXIT_FAILURE); }
+    value=read_option(argc,argv,"--reduction=");
+    space->reduction=(value!=NULL ? atoll(value) : 3);
+    value=read_option(argc,argv,"--min-epochs=");
+    space->min_epochs=(value!=NULL ? atoll(value) : space->epochs/(space->reduction*space->reduction*space->reduction));
+    if (space->min_epochs<1) { space->min_epochs=1; }
+    if (space->reduction<2 || space->min_epochs>space->epochs) { usage(); exit(EXIT_FAILURE); }
+    if (space->trials<1 || space->steps<1 || space->holdout<=0.0 || space->holdout>=1.0) { usage(); exit(EXIT_FAILURE); }
+    return;
+}
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)      Where ( m x n ) are the dimensions
+ *                          of the read dataset values.
+ *
+ * The function training_dataset_load() takes three arguments as
+ * parameters,namely the name of the file that contains the training
+ * dataset ( or "stdin" ),the dataset type and the normalization flag.
+ * It loads the dataset and scales it when normalization was requested.
+ * If the file cannot be opened the program execution is terminated.
+ *
+ * @param:  char        *filename
+ * @param:  int         ds_type
+ * @param:  int         norm
+ * @return: dataset_t   *
+ *
+ */
+
+dataset_t *training_dataset_load(char *filename,int ds_type,int norm)
+{
+    FILE *stream=stdin;
+    dataset_t *dataset=NULL;
+    if (strcmp(filename,"stdin")!=0) { stream=fopen(filename,"r"); }
+    if (stream==NULL) { fprintf(stderr,"Could not open the file %s.\n",filename); exit(EXIT_FAILURE); }
+    phase_begin(); dataset=dataset_create(stream,ds_type,minmax_scaler,minmax_descaler);
+    phase_end("parse",(double )dataset->rows);
+    if (stream!=stdin) { fclose(stream); }
+    if (norm==NORMALIZE_YES) { phase_begin(); dataset_scale(dataset); phase_end("scale",(double )dataset->rows); }
+    return dataset;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function minmax_scaler() takes five arguments as parameters.
+ * The first two are the minimum and maximum values of some column j.
+ * The third parameter is an element of the i of the column and a,b
+ * are the values that specify the range of scaling e,g [0,1] or [-1,-1].
+ * This function returns the new normalized value of x.
+ *
+ * @param:  double      min
+ * @param:  double      max
+ * @param:  double      x
+ * @param:  double      a
+ * @param:  double      b
+ * @return: double
+ *
+ */
+double minmax_scaler(double min,double max,double x,double a,double b)
+{
+    double result=a*((x-min)/(max-min))-b;
+    return result;
+}
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function minimax_descaler() is the opposite function of the
+ * minmax_scaler function.Instead of normalizing the given data it
+ * denormalizes it back to it's original form.
+ *
+ * @param:  double      min
+ * @param:  double      max
+ * @param:  double      x
+ * @param:  double      a
+ * @param:  double      b
+ * @return: double
+ *
+ */
+
+double minmax_descaler(double min,double max,double x,double a,double b)
+{
+    double result=(((x+b)*(max-min))/a)+min;
+    return result;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)      Where ( m x n ) are th dimensions
+ *                          of the given matrix data structure.
+ * 
+ * The function predictions_print() takes three arguments as
+ * parameters.The first argument is a file stream data structure
+ * and the second argument is a gsl_matrix data structure.This
+ * function prints the values of the matrix in a user-friendly
+ * format.
+ *
+ * @param:  FILE            *stream
+ * @param:  gsl_matrix      *m
+ * @return: void
+ *
+ */
+
+void predictions_print(FILE *stream,gsl_matrix *m)
+{
+    // variable declarations.
+    size_t i,j; double data;
+
+    // Iterating over the rows and
+    // columns of the matrix and
+    // printing it's values into the
+    // specified stream.
+    for (i=0;i<m->size1;i++)
+    {
+        for (j=0;j<m->size2;j++)
+        {
+            data=gsl_matrix_get(m,i,j);
+            fprintf(stream,"%g ",data);
+        } fprintf(stream,"\n");
+    }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)      Where ( m x n ) are the dimensions
+ *                          of the loaded dataset.
+ *
+ * The function model_dataset_load() loads the dataset in the given
+ * file and,if normalization has been asked for,scales it with the min
+ * max values saved next to the model in the given directory,the way
+ * the rows the model was trained on were scaled.
+ *
+ * @param:  char        *filename
+ * @param:  int         ds_type
+ * @param:  int         norm
+ * @param:  char        *directory
+ * @return: dataset_t   *
+ *
+ */
+
+dataset_t *model_dataset_load(char *filename,int ds_type,int norm,char *directory)
+{
+    FILE *stream=stdin; dataset_t *dataset=NULL;
+    if (strcmp(filename,"stdin")!=0) { stream=fopen(filename,"r"); }
+    if (stream==NULL) { fprintf(stderr,"Could not open the file %s.\n",filename); exit(EXIT_FAILURE); }
+    phase_begin(); dataset=dataset_create(stream,ds_type,minmax_scaler,minmax_descaler);
+    phase_end("parse",(double )dataset->rows);
+    if (stream!=stdin) { fclose(stream); }
+    if (norm==NORMALIZE_YES)
+    {
+        dataset_load_minmax(dataset,directory);
+        phase_begin(); dataset_scale(dataset); phase_end("scale",(double )dataset->rows);
+    }
+    return dataset;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function quantization_testing() compares the quantised network
+ * with the one it has been quantised from on the rows of the given
+ * dataset and prints the size of their weights,how often they agree
+ * and,if the rows hold the desired outputs,the score of either one.
+ *
+ * @param:  neural_quant_t  *nq
+ * @param:  neural_net_t    *nn
+ * @param:  dataset_t       *ds
+ * @param:  int             mode
+ * @return: void
+ *
+ */
+
+void quantization_testing(neural_quant_t *nq,neural_net_t *nn,dataset_t *ds,int mode)
+{
+    quant_report_t report;
+    assert(nq!=NULL && nn!=NULL && ds!=NULL);
+    neural_quant_compare(nq,nn,ds,&report);
+    printf(WHT"QUANTISED WEIGHTS:"RESET" %zu bytes,%zu bytes before ( %.1fx smaller )\n",report.bytes,
+        report.reference_bytes,report.bytes>0 ? (double )report.reference_bytes/(double )report.bytes : 0.0);
+    printf(WHT"QUANTISED OUTPUTS:"RESET" AGREEMENT = %g, MAX DELTA = %g, MEAN DELTA = %g, ROWS = %zu\n",
+        report.agreement,report.max_delta,report.mean_delta,report.rows);
+    if (!report.targets) { return; }
+    if (mode==MODE_CLASSIFICATION)
+    {
+        printf(WHT"TESTING VIA QUANTISATION:"RESET" "GRN"ACCURACY"RESET" = %g ( %g before ), "RED"ERROR"RESET" = %g\n",
+            report.quantised.accuracy,report.reference.accuracy,1.0-report.quantised.accuracy);
+    }
+    else if (mode==MODE_CURVEFITTING)
+    {
+        printf(WHT"TESTING VIA QUANTISATION:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g ( %g before )\n",
+            report.quantised.rmse,report.reference.rmse);
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function pruning_testing() compares the pruned network with the
+ * one it has been pruned from on the rows of the given dataset and
+ * prints the number of weights left,the size of the compressed sparse
+ * rows,how often the two networks agree and,if the rows hold the
+ * desired outputs,the score of either one.
+ *
+ * @param:  neural_sparse_t *ns
+ * @param:  neural_net_t    *nn
+ * @param:  dataset_t       *ds
+ * @param:  int             mode
+ * @return: void
+ *
+ */
+
+void pruning_testing(neural_sparse_t *ns,neural_net_t *nn,dataset_t *ds,int mode)
+{
+    sparse_report_t report;
+    assert(ns!=NULL && nn!=NULL && ds!=NULL);
+    neural_sparse_compare(ns,nn,ds,&report);
+    printf(WHT"PRUNED WEIGHTS:"RESET" %zu of %zu left ( density %g ), %zu of %lld layers sparse\n",report.nonzeros,
+        report.weights,report.weights>0 ? (double )report.nonzeros/(double )report.weights : 0.0,report.sparse_layers,ns->config->nlayers);
+    printf(WHT"SPARSE ROWS:"RESET" %zu bytes,%zu bytes before ( %.1fx smaller )\n",report.bytes,
+        report.reference_bytes,report.bytes>0 ? (double )report.reference_bytes/(double )report.bytes : 0.0);
+    printf(WHT"PRUNED OUTPUTS:"RESET" AGREEMENT = %g, MAX DELTA = %g, MEAN DELTA = %g, ROWS = %zu\n",
+        report.agreement,report.max_delta,report.mean_delta,report.rows);
+    if (!report.targets) { return; }
+    if (mode==MODE_CLASSIFICATION)
+    {
+        printf(WHT"TESTING VIA PRUNING:"RESET" "GRN"ACCURACY"RESET" = %g ( %g before ), "RED"ERROR"RESET" = %g\n",
+            report.pruned.accuracy,report.reference.accuracy,1.0-report.pruned.accuracy);
+    }
+    else if (mode==MODE_CURVEFITTING)
+    {
+        printf(WHT"TESTING VIA PRUNING:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g ( %g before )\n",
+            report.pruned.rmse,report.reference.rmse);
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function shrinking_testing() prints the neurons per layer and
+ * the number of synaptic weights of the network that has had neurons
+ * removed and of the one it comes from and,if the rows of the given
+ * dataset hold the desired outputs,the score of either one on them.
+ *
+ * @param:  neural_net_t    *small
+ * @param:  neural_net_t    *nn
+ * @param:  dataset_t       *ds
+ * @param:  int             mode
+ * @return: void
+ *
+ */
+
+void shrinking_testing(neural_net_t *small,neural_net_t *nn,dataset_t *ds,int mode)
+{
+    evaluation_t before,after; llint l;
+    size_t weights=0,reference=0,s,n;
+    assert(small!=NULL && nn!=NULL && ds!=NULL);
+    printf(WHT"SHRUNK NEURONS:"RESET" ");
+    for (l=0;l<small->config->nlayers;l++) { printf("%lld%s",small->config->neurons[l],l+1<small->config->nlayers ? "," : ""); }
+    printf(" ( ");
+    for (l=0;l<nn->config->nlayers;l++) { printf("%lld%s",nn->config->neurons[l],l+1<nn->config->nlayers ? "," : ""); }
+    printf(" before )\n");
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        weights+=(size_t )(small->config->neurons[l]*(l==0 ? small->config->signals : small->config->neurons[l-1]+1));
+        reference+=(size_t )(nn->config->neurons[l]*(l==0 ? nn->config->signals : nn->config->neurons[l-1]+1));
+    }
+    printf(WHT"SHRUNK WEIGHTS:"RESET" %zu,%zu before ( %.1fx smaller )\n",weights,reference,weights>0 ? (double )reference/(double )weights : 0.0);
+    s=(size_t )nn->config->signals; n=(size_t )nn->config->neurons[nn->config->nlayers-1];
+    if (ds->data->size2!=s+n || ds->rows==0) { return; }
+    evaluation_score(nn,ds,NULL,ds->data->size1,&before);
+    evaluation_score(small,ds,NULL,ds->data->size1,&after);
+    if (mode==MODE_CLASSIFICATION)
+    {
+        printf(WHT"TESTING VIA SHRINKING:"RESET" "GRN"ACCURACY"RESET" = %g ( %g before ), "RED"ERROR"RESET" = %g\n",
+            after.accuracy,before.accuracy,1.0-after.accuracy);
+    }
+    else if (mode==MODE_CURVEFITTING)
+    {
+        printf(WHT"TESTING VIA SHRINKING:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g ( %g before )\n",after.rmse,before.rmse);
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function factorization_testing() prints the rank of every layer
+ * of the factorised network,its number of weights and the one of the
+ * network it has been factorised from and the scores of either one on
+ * the rows the ranks have been fitted on.If a hold-out dataset that
+ * holds the desired outputs is given both are scored on it as well.
+ *
+ * @param:  neural_lowrank_t    *nl
+ * @param:  neural_net_t        *nn
+ * @param:  dataset_t           *ds
+ * @param:  lowrank_report_t    *report
+ * @param:  int                 mode
+ * @return: void
+ *
+ */
+
+void factorization_testing(neural_lowrank_t *nl,neural_net_t *nn,dataset_t *ds,lowrank_report_t *report,int mode)
+{
+    evaluation_t before,after; llint l;
+    size_t s,n; char *label="FITTING";
+    assert(nl!=NULL && nn!=NULL && report!=NULL);
+    printf(WHT"FACTORIZED RANKS:"RESET" ");
+    for (l=0;l<nl->config->nlayers;l++)
+    {
+        if (nl->layers[l].rank>0) { printf("%lld",nl->layers[l].rank); }
+        else                      { printf("dense"); }
+        printf("%s",l+1<nl->config->nlayers ? "," : "\n");
+    }
+    printf(WHT"FACTORIZED WEIGHTS:"RESET" %zu,%zu before ( %.1fx fewer multiplications )\n",report->weights,
+        report->reference_weights,report->weights>0 ? (double )report->reference_weights/(double )report->weights : 0.0);
+    before=report->reference; after=report->factorised;
+    s=(size_t )nn->config->signals; n=(size_t )nn->config->neurons[nn->config->nlayers-1];
+    if (ds!=NULL && ds->data->size2==s+n && ds->rows>0)
+    {
+        evaluation_score(nn,ds,NULL,ds->data->size1,&before);
+        neural_lowrank_score(nl,ds,&after);
+        label="TESTING";
+    }
+    if (mode==MODE_CLASSIFICATION)
+    {
+        printf(WHT"%s VIA FACTORIZATION:"RESET" "GRN"ACCURACY"RESET" = %g ( %g before ), "RED"ERROR"RESET" = %g\n",
+            label,after.accuracy,before.accuracy,1.0-after.accuracy);
+    }
+    else if (mode==MODE_CURVEFITTING)
+    {
+        printf(WHT"%s VIA FACTORIZATION:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g ( %g before )\n",label,after.rmse,before.rmse);
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(p*r*l*m*n)   Where p is the number of timed passes,r
+ *                             the number of rows,l the number of layers
+ *                             and ( m x n ) the dimensions of the largest
+ *                             synaptic weights matrix of the teacher.
+ *
+ * The function distillation_testing() compares the distilled network
+ * with its teacher on the rows of the given dataset and prints the
+ * number of weights of either one,the time either one takes to predict
+ * a row,how often they agree and,if the rows hold the desired outputs,
+ * the score of either one.
+ *
+ * @param:  neural_net_t    *student
+ * @param:  neural_net_t    *teacher
+ * @param:  dataset_t       *ds
+ * @param:  int             mode
+ * @return: void
+ *
+ */
+
+void distillation_testing(neural_net_t *student,neural_net_t *teacher,dataset_t *ds,int mode)
+{
+    distill_report_t report;
+    assert(student!=NULL && teacher!=NULL && ds!=NULL);
+    neural_distill_compare(student,teacher,ds,&report);
+    printf(WHT"DISTILLED WEIGHTS:"RESET" %zu,%zu in the teacher ( %.1fx smaller )\n",report.weights,
+        report.teacher_weights,report.weights>0 ? (double )report.teacher_weights/(double )report.weights : 0.0);
+    printf(WHT"DISTILLED LATENCY:"RESET" %.3g us per row,%.3g us in the teacher ( %.1fx faster ), ROWS = %zu\n",report.seconds*1e6,
+        report.teacher_seconds*1e6,report.seconds>0.0 ? report.teacher_seconds/report.seconds : 0.0,report.rows);
+    if (mode==MODE_CLASSIFICATION) { printf(WHT"DISTILLED OUTPUTS:"RESET" AGREEMENT = %g\n",report.agreement); }
+    if (!report.targets) { return; }
+    if (mode==MODE_CLASSIFICATION)
+    {
+        printf(WHT"TESTING VIA DISTILLATION:"RESET" "GRN"ACCURACY"RESET" = %g ( %g in the teacher ), "RED"ERROR"RESET" = %g\n",
+            report.student.accuracy,report.teacher.accuracy,1.0-report.student.accuracy);
+    }
+    else if (mode==MODE_CURVEFITTING)
+    {
+        printf(WHT"TESTING VIA DISTILLATION:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g ( %g in the teacher )\n",
+            report.student.rmse,report.teacher.rmse);
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function storage_testing() loads the model that has just been
+ * saved into the given directory in a half precision format back into
+ * a second network and prints the size of the saved weights,the largest
+ * error the rounding has caused in a weight and the score of both the
+ * trained and the loaded network on the rows of the given dataset.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  dataset_t       *ds
+ * @param:  char            *directory
+ * @param:  int             mode
+ * @return: void
+ *
+ */
+
+void storage_testing(neural_net_t *nn,dataset_t *ds,char *directory,int mode)
+{
+    // Variable declarations
+    // and type assertions.
+    neural_config_t saved; neural_net_t *other=NULL;
+    evaluation_t before,after; char path[4096];
+    struct stat st={0}; size_t l,i,j,cells=0;
+    double error=0.0,delta; gsl_matrix *W=NULL,*O=NULL;
+    gsl_matrix_float *Wf=NULL,*Of=NULL;
+    assert(nn!=NULL && ds!=NULL && directory!=NULL);
+
+    // Loading the saved model in the precision
+    // of the trained network.
+    saved.precision=nn->config->precision;
+    other=neural_net_load(&saved,directory);
+    activation_assign(&saved);
+
+    // Measuring the largest rounding error of a weight.
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        W=neural_layer_getW(nn->layers[l]); O=neural_layer_getW(other->layers[l]);
+        Wf=neural_layer_getW_float(nn->layers[l]); Of=neural_layer_getW_float(other->layers[l]);
+        for (i=0;i<(Wf!=NULL ? Wf->size1 : W->size1);i++)
+        {
+            for (j=0;j<(Wf!=NULL ? Wf->size2 : W->size2);j++)
+            {
+                if (Wf!=NULL) { delta=fabs((double )gsl_matrix_float_get(Wf,i,j)-(double )gsl_matrix_float_get(Of,i,j)); }
+                else          { delta=fabs(gsl_matrix_get(W,i,j)-gsl_matrix_get(O,i,j)); }
+                if (delta>error) { error=delta; } cells++;
+            }
+        }
+    }
+
+    // Scoring both networks on the same rows.
+    evaluation_score(nn,ds,NULL,ds->data->size1,&before);
+    evaluation_score(other,ds,NULL,ds->data->size1,&after);
+    snprintf(path,sizeof(path),"%s/weights.bin",directory); stat(path,&st);
+    printf(WHT"STORED WEIGHTS:"RESET" %s, %lld bytes,%zu bytes before, MAX WEIGHT ERROR = %g\n",
+        nn->config->storage==STORAGE_FP16 ? "fp16" : "bf16",(long long int )st.st_size,
+        cells*(nn->config->precision==PRECISION_F32 ? sizeof(float ) : sizeof(double )),error);
+    if (mode==MODE_CLASSIFICATION)
+    {
+        printf(WHT"TESTING VIA STORED WEIGHTS:"RESET" "GRN"ACCURACY"RESET" = %g ( %g before ), "RED"ERROR"RESET" = %g\n",
+            after.accuracy,before.accuracy,1.0-after.accuracy);
+    }
+    else if (mode==MODE_CURVEFITTING)
+    {
+        printf(WHT"TESTING VIA STORED WEIGHTS:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g ( %g before )\n",after.rmse,before.rmse);
+    }
+    neural_net_free(other); free(saved.neurons);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)      Where ( m x n ) are the dimensions of the given matrix.
+ *                          
+ * 
+ * The function predictions_format() takes five arguments as parameters.
+ * The first argument is a gsl_matrix data structure that contains the
+ * output signals of the neural network.The second argument is a dataset_t
+ * data structure.The third argument is the starting index of the output
+ * targets in the dataset.The last two are the execution type and training
+ * mode of the program.This function formats the output signals of the given
+ * predictions matrix based on the neural net configurations.
+ *
+ * @param:  gsl_matrix      *m
+ * @param:  dataset_t       *ds
+ * @param:  size_t          ycol
+ * @param:  int             mode
+ * @param:  int             norm
+ * @return: void
+ *
+ */
+
+void predictions_format(gsl_matrix *m,dataset_t *ds,size_t ycol,int mode,int norm)
+{
+    // Variable declarastions,type assertions.
+    assert(m!=NULL && ds!=NULL);
+    assert(mode==MODE_CLASSIFICATION || mode==MODE_CURVEFITTING);
+    gsl_vector_view v; size_t i,j,index; double min,max,data;
+    
+    // Iterating over rows the given matrix data structure.
+    for (i=0;i<m->size1;i++)
+    {
+        // Because the neural network program supports
+        // two types of training,namely pattern classification
+        // and curve fitting, we have to format the output signals
+        // accordingly.
+        
+
+        // Checking if the training mode is classification.
+        if (mode==MODE_CLASSIFICATION)
+        {
+            // If so,we want to find the cell in the
             // current row with the maximum value and
             // set that one to 1 and the rest of the cells
             // in the current row to zero.
@@ -1042,6 +2725,169 @@ void resubstitution_testing(neural_net_t *nn,dataset_t *ds,int mode,int norm)
 
 
 
+/*
+ * @COMPLEXITY: O(k*f(n))   Where k is the number of folds and f(n) the
+ *                          time complexity of training a single fold.
+ *
+ * The function cross_validation_testing() takes five arguments as
+ * parameters,namely the neural configuration of the trained model,
+ * the training dataset,the rows the model has been trained on,which
+ * are NULL unless it has been distilled from a teacher,the number of
+ * folds and the training mode.It runs the k-fold cross validation and
+ * prints the held-out score of every fold followed by the mean and
+ * standard deviation.
+ *
+ * @param:  neural_config_t     *config
+ * @param:  dataset_t           *ds
+ * @param:  gsl_matrix          *targets
+ * @param:  llint               k
+ * @param:  int                 mode
+ * @return: void
+ *
+ */
+
+void cross_validation_testing(neural_config_t *config,dataset_t *ds,gsl_matrix *targets,llint k,int mode)
+{
+    llint f;
+    evaluation_t *results=NULL;
+    evaluation_t mean,stddev;
+    assert(config!=NULL && ds!=NULL);
+    if ((size_t )k>ds->data->size1) { k=ds->data->size1; }
+    results=cross_validation_run(config,ds,targets,k,(unsigned long )k);
+    evaluation_aggregate(results,k,&mean,&stddev);
+
+    for (f=0;f<k;f++)
+    {
+        if (mode==MODE_CLASSIFICATION)
+        {
+            printf(WHT"CROSS VALIDATION FOLD %lld/%lld:"RESET" "GRN"ACCURACY"RESET" = %g, "RED"ERROR"RESET" = %g, EPOCHS = %lld, ROWS = %zu/%zu\n",
+                f+1,k,results[f].accuracy,1.0-results[f].accuracy,results[f].epochs,results[f].train_rows,results[f].test_rows);
+        }
+        else if (mode==MODE_CURVEFITTING)
+        {
+            printf(WHT"CROSS VALIDATION FOLD %lld/%lld:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g, EPOCHS = %lld, ROWS = %zu/%zu\n",
+                f+1,k,results[f].rmse,results[f].epochs,results[f].train_rows,results[f].test_rows);
+        }
+    }
+
+    if (mode==MODE_CLASSIFICATION)
+    {
+        printf(WHT"CROSS VALIDATION %lld-FOLD:"RESET" "GRN"ACCURACY"RESET" = %g (+/- %g), "RED"ERROR"RESET" = %g\n",
+            k,mean.accuracy,stddev.accuracy,1.0-mean.accuracy);
+    }
+    else if (mode==MODE_CURVEFITTING)
+    {
+        printf(WHT"CROSS VALIDATION %lld-FOLD:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g (+/- %g)\n",
+            k,mean.rmse,stddev.rmse);
+    }
+
+    free(results);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows in the test
+ *                              file,l the number of layers and ( m x n )
+ *                              the dimensions of the largest weights matrix.
+ *
+ * The function holdout_testing() takes six arguments as parameters.
+ * The first argument is the trained neural network,the second one
+ * the training dataset,the third one the name of the hold-out file,
+ * the next two the training mode and normalization flag and the last
+ * one the dumping directory.The hold-out file has the same format as
+ * the training file and is scaled with the training minimum and maximum
+ * values.If it contains the desired outputs the network is scored on it,
+ * otherwise,like the *_test.data files,the formatted predictions are
+ * written into the file "test_predictions.data" of the dumping directory.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  dataset_t       *ds
+ * @param:  char            *filename
+ * @param:  int             mode
+ * @param:  int             norm
+ * @param:  char            *directory
+ * @return: void
+ *
+ */
+
+void holdout_testing(neural_net_t *nn,dataset_t *ds,char *filename,int mode,int norm,char *directory)
+{
+    // Variable declarations
+    // and type assertions.
+    FILE *stream=NULL; char *filepath=NULL;
+    dataset_t *test=NULL; evaluation_t ev;
+    gsl_matrix *results=NULL;
+    llint signals,outputs;
+    assert(nn!=NULL && ds!=NULL && filename!=NULL && directory!=NULL);
+    signals=nn->config->signals;
+    outputs=nn->config->neurons[nn->config->nlayers-1];
+
+    // Loading the hold-out dataset and checking that it
+    // contains either the input signals only or the input
+    // signals together with the desired outputs.
+    stream=fopen(filename,"r");
+    if (stream==NULL) { fprintf(stderr,"Could not open the test file %s.\n",filename); return; }
+    test=dataset_create(stream,ds->type,ds->scaler,ds->descaler);
+    fclose(stream); stream=NULL;
+    if (test->columns!=signals && test->columns!=signals+outputs)
+    {
+        fprintf(stderr,"The test file %s has %lld columns,expected %lld or %lld.\n",
+            filename,test->columns-1,signals-1,signals+outputs-1);
+        dataset_free(test); return;
+    }
+
+    // Scaling the hold-out rows with the minimum and
+    // maximum values of the training dataset.
+    if (norm==NORMALIZE_YES)
+    {
+        test->minimums=gsl_vector_alloc(ds->columns);
+        test->maximums=gsl_vector_alloc(ds->columns);
+        gsl_vector_memcpy(test->minimums,ds->minimums);
+        gsl_vector_memcpy(test->maximums,ds->maximums);
+        dataset_scale(test);
+    }
+
+    if (test->columns==signals+outputs)
+    {
+        // The desired outputs are available so
+        // we score the network on the hold-out rows.
+        evaluation_score(nn,test,NULL,test->data->size1,&ev);
+        if (mode==MODE_CLASSIFICATION)
+        {
+            printf(WHT"TESTING VIA HOLD-OUT:"RESET" "GRN"ACCURACY"RESET" = %g, "RED"ERROR"RESET" = %g, ROWS = %zu\n",
+                ev.accuracy,1.0-ev.accuracy,ev.test_rows);
+        }
+        else if (mode==MODE_CURVEFITTING)
+        {
+            printf(WHT"TESTING VIA HOLD-OUT:"RESET" "RED"ROOT MEAN SQUARE ERROR"RESET" = %g, ROWS = %zu\n",ev.rmse,ev.test_rows);
+        }
+    }
+    else
+    {
+        // There are no desired outputs in the file,so we
+        // save the formatted predictions next to the model.
+        filepath=(char *)malloc((strlen(directory)+strlen("/test_predictions.data")+1)*sizeof(char ));
+        assert(filepath!=NULL);
+        strcpy(filepath,directory);
+        strcat(filepath,"/test_predictions.data");
+        results=neural_net_predict(nn,test->data);
+        predictions_format(results,test,signals,mode,norm);
+        stream=fopen(filepath,"w");
+        if (stream!=NULL) { predictions_print(stream,results); fclose(stream); }
+        printf(WHT"TESTING VIA HOLD-OUT:"RESET" no desired outputs in %s, predictions written to %s\n",filename,filepath);
+        gsl_matrix_free(results); free(filepath);
+    }
+
+    dataset_free(test);
+    return;
+}
+
+
+
+
 /*
  * @COMPLEXITY: Theta(1)
  *
@@ -1063,14 +2909,68 @@ void usage(void)
         "\n"
         "       ./neuralnet --train ( --curve-fitting | --pattern-classification ) --normalization=<yes|no> --in-file=<filepath> --dump-dir=<filepath> --signals=<number> --nlayers=<number>\n"
         "           --neurons-per-layer=<[ number, .. ]> --activation=<lnr|lgst|htan>  [--epsilon=<number>] [--eta=<number>] [--momentum=<number>] [--epochs=<number>] [--alpha=<number>] [--beta=<number>]\n"
+        "           [--cross-validate=<number>] [--test-file=<filepath>] [--checkpoint-every=<number>] [--resume-from=<filepath>]\n"
+        "           [--telemetry=<filepath|fd:number>] [--telemetry-every=<number>] [--console=<yes|no>] [--console-interval=<seconds>]\n"
+        "           [--profile] [--profile-trace=<filepath>] [--perf-counters] [--precision=<f64|f32>] [--storage=<native|fp16|bf16>]\n"
+        "           [--distill-from=<filepath>] [--augment=<number>] [--noise=<number>] [--seed=<number>] [--backend=<naive|cblas|simd|blas>]\n"
+        "           [--threads=<number>]\n"
         "\n"
         "   For the prediction process of the neural network:\n"
         "\n"
         "       ./neuralnet --predict ( --curve-fitting | --pattern-classification ) --normalization=<yes|no>  --in-file=<filepath> --load-dir=<filepath>\n"
+        "           [--precision=<f64|f32>] [--backend=<auto|naive|cblas|simd|blas>] [--threads=<number>]\n"
+        "\n"
+        "   For the hyperparameter search of the neural network:\n"
+        "\n"
+        "       ./neuralnet --search ( --curve-fitting | --pattern-classification ) --normalization=<yes|no> --in-file=<filepath> --dump-dir=<filepath> --signals=<number>\n"
+        "           [--nlayers=<lo:hi>] [--neurons-per-layer=<lo:hi>] [--activation=<lnr,lgst,htan>] [--eta=<lo:hi>] [--momentum=<lo:hi>] [--alpha=<lo:hi>] [--beta=<lo:hi>]\n"
+        "           [--epsilon=<number>] [--epochs=<number>] [--strategy=<grid|random>] [--trials=<number>] [--grid-steps=<number>] [--holdout=<fraction>] [--seed=<number>] [--threads=<number>]\n"
+        "           [--scheduler=<halving|hyperband>] [--min-epochs=<number>] [--reduction=<number>]\n"
+        "\n"
+        "   For the generation of a synthetic dataset:\n"
+        "\n"
+        "       ./neuralnet --generate --shape=<thyroid|circle|sin> --out-file=<filepath|stdout> [--rows=<number>] [--signals=<number>] [--classes=<number>]\n"
+        "           [--noise=<number>] [--seed=<number>]\n"
+        "\n"
+        "   For the conversion of a saved model into another precision:\n"
+        "\n"
+        "       ./neuralnet --convert --load-dir=<filepath> --dump-dir=<filepath> --precision=<f64|f32> [--storage=<native|fp16|bf16>]\n"
+        "\n"
+        "   For the export of a saved model into standalone C source:\n"
+        "\n"
+        "       ./neuralnet --export-c=<filepath|stdout> ( --curve-fitting | --pattern-classification ) --load-dir=<filepath> [--prefix=<name>]\n"
+        "\n"
+        "   For the int8 quantisation of a saved model:\n"
+        "\n"
+        "       ./neuralnet --quantize ( --curve-fitting | --pattern-classification ) --normalization=<yes|no> --in-file=<filepath> --load-dir=<filepath> --dump-dir=<filepath>\n"
+        "           [--test-file=<filepath>] [--precision=<f64|f32>]\n"
+        "\n"
+        "   For the magnitude pruning of a saved model:\n"
+        "\n"
+        "       ./neuralnet --prune=<sparsity> ( --curve-fitting | --pattern-classification ) --normalization=<yes|no> --in-file=<filepath> --load-dir=<filepath> --dump-dir=<filepath>\n"
+        "           [--fine-tune=<epochs>] [--momentum=<number>] [--test-file=<filepath>] [--precision=<f64|f32>] [--console=<yes|no>]\n"
+        "\n"
+        "   For the removal of the weakest hidden neurons of a saved model:\n"
+        "\n"
+        "       ./neuralnet --shrink=<fraction> ( --curve-fitting | --pattern-classification ) --normalization=<yes|no> --in-file=<filepath> --load-dir=<filepath> --dump-dir=<filepath>\n"
+        "           [--rank=<norm|variance>] [--fine-tune=<epochs>] [--momentum=<number>] [--test-file=<filepath>] [--precision=<f64|f32>] [--console=<yes|no>]\n"
+        "\n"
+        "   For the low-rank factorisation of a saved model:\n"
+        "\n"
+        "       ./neuralnet --factorize ( --curve-fitting | --pattern-classification ) --normalization=<yes|no> --in-file=<filepath> --load-dir=<filepath> --dump-dir=<filepath>\n"
+        "           [--budget=<number>] [--test-file=<filepath>] [--precision=<f64|f32>]\n"
         "\n"
         "Available options:\n"
         "   --train                             This flag sets the execution mode to training.\n"
         "   --predict                           This flag sets the execution mode to predicting.\n"
+        "   --search                            This flag sets the execution mode to hyperparameter search.\n"
+        "   --generate                          This flag sets the execution mode to synthetic dataset generation.\n"
+        "   --convert                           This flag sets the execution mode to model precision conversion.\n"
+        "   --quantize                          This flag sets the execution mode to int8 model quantisation.\n"
+        "   --prune=<sparsity>                  This flag sets the execution mode to pruning that fraction of the weights.\n"
+        "   --shrink=<fraction>                 This flag sets the execution mode to removing that fraction of the hidden neurons.\n"
+        "   --factorize                         This flag sets the execution mode to low-rank factorisation of the weights.\n"
+        "   --export-c=<filepath|stdout>        This flag sets the execution mode to writing a saved model as C source.\n"
         "   --curve-fitting                     This flag sets the training process to curve fitting.\n"
         "   --pattern-classification            This flag sets the training process to pattern classification..\n"
         "   --normalization=<yes|no>            This flag sets the normalization of the given data to on/off.\n"
@@ -1087,14 +2987,64 @@ void usage(void)
         "   [--epochs=<number>]                 This flag sets the number of epochs for the training process.       ( optional ).\n"
         "   [--alpha=<number>]                  This flag sets the first coefficient for the activation function.   ( optional ).\n"
         "   [--beta=<number>]                   This flag sets the second coefficient of the activation function.   ( optional ).\n"
+        "   [--cross-validate=<number>]         This flag runs a concurrent k-fold cross validation after training.  ( optional ).\n"
+        "   [--test-file=<filepath>]            This flag scores the trained model on a hold-out dataset file.      ( optional ).\n"
+        "   [--checkpoint-every=<number>]       This flag writes a resumable checkpoint every that many epochs.     ( optional ).\n"
+        "   [--resume-from=<filepath>]          This flag resumes training from the checkpoint in that directory.   ( optional ).\n"
+        "   [--telemetry=<filepath|fd:number>]  This flag writes the metrics of every epoch as JSON lines.          ( optional ).\n"
+        "   [--telemetry-every=<number>]        This flag sets the number of epochs buffered between two writes.    ( optional ).\n"
+        "   [--console=<yes|no>]                This flag turns the per-epoch progress line on/off.                 ( optional ).\n"
+        "   [--console-interval=<seconds>]      This flag sets the minimum time between two progress lines.         ( optional ).\n"
+        "   [--profile]                         This flag prints the time spent per layer and phase at exit.        ( optional ).\n"
+        "   [--profile-trace=<filepath>]        This flag also writes the profiled regions as a chrome trace.       ( optional ).\n"
+        "   [--perf-counters]                   This flag prints hardware counters of the parse,scale,train phases. ( optional ).\n"
+        "   [--precision=<f64|f32>]             This flag stores and computes the network in doubles or floats.     ( optional ).\n"
+        "   [--storage=<native|fp16|bf16>]      This flag saves the trained weights in half precision.              ( optional ).\n"
+        "   [--backend=<auto|naive|..>]         This flag picks the dense kernels,tuned per host when predicting by default. ( optional ).\n"
+        "   [--distill-from=<filepath>]         This flag trains against the soft outputs of the model in that directory. ( optional ).\n"
+        "   [--augment=<number>]                This flag adds that many noisy copies of the rows labelled by the teacher. ( distill ).\n"
+        "   [--strategy=<grid|random>]          This flag sets the search strategy,random by default.             ( search ).\n"
+        "   [--trials=<number>]                 This flag sets the number of random search trials.                  ( search ).\n"
+        "   [--grid-steps=<number>]             This flag sets the number of grid points per range.                 ( search ).\n"
+        "   [--holdout=<fraction>]              This flag sets the fraction of rows used for validation.            ( search ).\n"
+        "   [--seed=<number>]                   This flag sets the seed of the weights,sampling,split or noise.     ( train/search/generate ).\n"
+        "   [--threads=<number>]                This flag sets the number of worker threads,one per cpu by default. ( search/train/predict ).\n"
+        "   [--scheduler=<halving|hyperband>]   This flag stops weak trials early with successive halving/hyperband.( search ).\n"
+        "   [--min-epochs=<number>]             This flag sets the epoch budget of the first scheduler rung.        ( search ).\n"
+        "   [--reduction=<number>]              This flag sets the factor by which every rung shrinks the trials.   ( search ).\n"
+        "   --shape=<thyroid|circle|sin>        This flag sets the bundled dataset the generated one mimics.        ( generate ).\n"
+        "   --out-file=<filepath|stdout>        This flag sets the file the generated dataset is streamed into.     ( generate ).\n"
+        "   [--rows=<number>]                   This flag sets the number of generated rows.                        ( generate ).\n"
+        "   [--classes=<number>]                This flag sets the number of classes of the thyroid shape.          ( generate ).\n"
+        "   [--noise=<number>]                  This flag sets the standard deviation of the added noise.           ( generate/distill ).\n"
+        "   [--fine-tune=<epochs>]              This flag fine-tunes the pruned network for that many epochs.       ( prune/shrink ).\n"
+        "   [--rank=<norm|variance>]            This flag ranks the hidden neurons by weight norm or output variance. ( shrink ).\n"
+        "   [--budget=<number>]                 This flag sets the accuracy drop or relative rmse growth allowed.   ( factorize ).\n"
+        "   [--prefix=<name>]                   This flag sets the prefix of the identifiers of the exported source. ( export-c ).\n"
         "   --help                              Print the help message and quit program execution.\n"
         "\n"
         "   **  The files containing the training dataset must have the total number of\n"
         "       rows and columns in the first line and second line respectively\n"
         "\n"
+        "   **  The flags in square brackets after --beta may be given in any order after the positional ones.\n"
+        "\n"
         "   **  The files containing the newly unseen dataset mut have the total number of\n"
         "       rows and columns in the first line and second line respectively and have no target column.\n"
         "\n"
+        "   **  The --quantize execution type calibrates on the rows of --in-file,with or without target columns,and\n"
+        "       saves a model that --predict loads into the int8 engine.\n"
+        "\n"
+        "   **  The --prune execution type fine-tunes on the rows of --in-file,which then need the target columns,and\n"
+        "       saves a model that --predict loads into the sparse engine.\n"
+        "\n"
+        "   **  The --shrink execution type saves an ordinary model with fewer neurons,--fine-tune trains it on --in-file.\n"
+        "\n"
+        "   **  The --factorize execution type fits the ranks on the rows of --in-file,which need the target columns,and\n"
+        "       saves a model that --predict loads into the low-rank engine.\n"
+        "\n"
+        "   **  A model saved with --storage=fp16 or bf16 is loaded by --predict into the half precision engine,\n"
+        "       which keeps the weights in two bytes,unless --precision=f32 is given.\n"
+        "\n"
         "author: (c), Endri Kastrati, email: endriau@gmail.com\n";
     fprintf(stderr,"%s",content);
     return;
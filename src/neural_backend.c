@@ -0,0 +1,763 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * compute backends of the dense kernels
+ * and the autotuner that picks among them.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,the
+ * standard input output library,the standard
+ * assertions library,the string manipulation
+ * library,the mathematics library,the unix
+ * standard library for the name of the host,the
+ * dynamic linking library for the system BLAS,the
+ * reference cblas of the gsl,the header file
+ * "neural_backend.h" that contains datatype definitions
+ * and function prototypings regarding the backends,
+ * the header file "neural_gemm.h" for the in-tree matrix
+ * multiply and "profiler.h" for its monotonic clock.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <gsl/gsl_cblas.h>
+#include "neural_backend.h"
+#include "neural_gemm.h"
+#include "neural_utils.h"
+#include "profiler.h"
+
+
+
+
+/*
+ * The naive kernels add up every sum one term after the
+ * other,in the order of the loops they replace,so a network
+ * on the naive backend computes exactly what it always did.
+ *
+ */
+
+static double naive_dot(size_t n,const double *x,size_t incx,const double *y,size_t incy)
+{
+    size_t i; double sum=0.0;
+    for (i=0;i<n;i++) { sum+=x[i*incx]*y[i*incy]; }
+    return sum;
+}
+
+static void naive_gemv(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y)
+{
+    size_t j,i; double sum;
+    for (j=0;j<m;j++)
+    {
+        sum=0.0;
+        for (i=0;i<n;i++) { sum+=W[j*ldw+i]*x[i*incx]; }
+        y[j]=sum;
+    } return;
+}
+
+static void naive_gemtv(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y)
+{
+    size_t j,i; double scale; const double *w;
+    for (i=0;i<n;i++) { y[i]=0.0; }
+    for (j=0;j<m;j++)
+    {
+        scale=x[j*incx]; w=W+j*ldw;
+        for (i=0;i<n;i++) { y[i]+=w[i]*scale; }
+    } return;
+}
+
+static void naive_gemm(size_t r,size_t m,size_t n,const double *X,size_t ldx,const double *W,size_t ldw,double *C,size_t ldc,void **packed)
+{
+    size_t k;
+    for (k=0;k<r;k++) { naive_gemv(m,n,W,ldw,X+k*ldx,1,C+k*ldc); }
+    return;
+}
+
+static void naive_ger(size_t m,size_t n,double alpha,const double *x,const double *y,size_t incy,double *W,size_t ldw)
+{
+    size_t j,i; double scale,*w;
+    for (j=0;j<m;j++)
+    {
+        scale=alpha*x[j]; w=W+j*ldw;
+        for (i=0;i<n;i++) { w[i]+=scale*y[i*incy]; }
+    } return;
+}
+
+static void naive_momentum(size_t m,size_t n,double alpha,double mu,const double *x,const double *y,size_t incy,double *W,size_t ldw,double *V,size_t ldv)
+{
+    size_t j,i; double scale,*w,*v;
+    for (j=0;j<m;j++)
+    {
+        scale=alpha*x[j]; w=W+j*ldw; v=V+j*ldv;
+        for (i=0;i<n;i++)
+        {
+            v[i]=mu*v[i]+scale*y[i*incy];
+            w[i]+=v[i];
+        }
+    } return;
+}
+
+static void naive_apply(neural_config_t *config,size_t n,const double *x,double *y)
+{
+    size_t i; double value;
+    for (i=0;i<n;i++) { value=x[i]; y[i]=config->activate(&value,&config->alpha,&config->beta); }
+    return;
+}
+
+
+
+
+/*
+ * The cblas kernels call the reference cblas the program
+ * is linked with.It has no activation,so the naive one is
+ * used instead.The velocity step is a scaling and a rank one
+ * update of the velocity followed by its addition to the weights.
+ *
+ */
+
+static double reference_dot(size_t n,const double *x,size_t incx,const double *y,size_t incy)
+{
+    return cblas_ddot((int )n,x,(int )incx,y,(int )incy);
+}
+
+static void reference_gemv(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y)
+{
+    cblas_dgemv(CblasRowMajor,CblasNoTrans,(int )m,(int )n,1.0,W,(int )ldw,x,(int )incx,0.0,y,1);
+    return;
+}
+
+static void reference_gemtv(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y)
+{
+    cblas_dgemv(CblasRowMajor,CblasTrans,(int )m,(int )n,1.0,W,(int )ldw,x,(int )incx,0.0,y,1);
+    return;
+}
+
+static void reference_gemm(size_t r,size_t m,size_t n,const double *X,size_t ldx,const double *W,size_t ldw,double *C,size_t ldc,void **packed)
+{
+    cblas_dgemm(CblasRowMajor,CblasNoTrans,CblasTrans,(int )r,(int )m,(int )n,1.0,X,(int )ldx,W,(int )ldw,0.0,C,(int )ldc);
+    return;
+}
+
+static void reference_ger(size_t m,size_t n,double alpha,const double *x,const double *y,size_t incy,double *W,size_t ldw)
+{
+    cblas_dger(CblasRowMajor,(int )m,(int )n,alpha,x,1,y,(int )incy,W,(int )ldw);
+    return;
+}
+
+static void reference_momentum(size_t m,size_t n,double alpha,double mu,const double *x,const double *y,size_t incy,double *W,size_t ldw,double *V,size_t ldv)
+{
+    size_t j;
+    for (j=0;j<m;j++) { cblas_dscal((int )n,mu,V+j*ldv,1); }
+    cblas_dger(CblasRowMajor,(int )m,(int )n,alpha,x,1,y,(int )incy,V,(int )ldv);
+    for (j=0;j<m;j++) { cblas_daxpy((int )n,1.0,V+j*ldv,1,W+j*ldw,1); }
+    return;
+}
+
+
+
+
+/*
+ * The simd kernels are the in-tree ones.The dot product keeps
+ * four partial sums,the matrix vector products go through four
+ * neurons side by side,the matrix multiply is neural_gemm() and
+ * the activation is evaluated inline,all of them written so that
+ * the compiler keeps them in vector registers.All but the dot
+ * product still add up every sum in order and evaluate the same
+ * expressions as the naive kernels.
+ *
+ */
+
+static double simd_dot(size_t n,const double *x,size_t incx,const double *y,size_t incy)
+{
+    size_t i; double s0=0.0,s1=0.0,s2=0.0,s3=0.0;
+    if (incx!=1 || incy!=1) { return naive_dot(n,x,incx,y,incy); }
+    for (i=0;i+4<=n;i+=4)
+    {
+        s0+=x[i]*y[i];     s1+=x[i+1]*y[i+1];
+        s2+=x[i+2]*y[i+2]; s3+=x[i+3]*y[i+3];
+    }
+    for (;i<n;i++) { s0+=x[i]*y[i]; }
+    return (s0+s1)+(s2+s3);
+}
+
+static void simd_gemv(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y)
+{
+    size_t j,i; double s0,s1,s2,s3,v;
+    const double *w0,*w1,*w2,*w3;
+    for (j=0;j+4<=m;j+=4)
+    {
+        w0=W+j*ldw; w1=w0+ldw; w2=w1+ldw; w3=w2+ldw;
+        s0=0.0; s1=0.0; s2=0.0; s3=0.0;
+        for (i=0;i<n;i++)
+        {
+            v=x[i*incx];
+            s0+=w0[i]*v; s1+=w1[i]*v;
+            s2+=w2[i]*v; s3+=w3[i]*v;
+        }
+        y[j]=s0; y[j+1]=s1; y[j+2]=s2; y[j+3]=s3;
+    }
+    if (j<m) { naive_gemv(m-j,n,W+j*ldw,ldw,x,incx,y+j); }
+    return;
+}
+
+static void simd_gemtv(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *restrict y)
+{
+    size_t j,i; double x0,x1,x2,x3;
+    const double *w0,*w1,*w2,*w3;
+    for (i=0;i<n;i++) { y[i]=0.0; }
+    for (j=0;j+4<=m;j+=4)
+    {
+        w0=W+j*ldw; w1=w0+ldw; w2=w1+ldw; w3=w2+ldw;
+        x0=x[j*incx]; x1=x[(j+1)*incx];
+        x2=x[(j+2)*incx]; x3=x[(j+3)*incx];
+        for (i=0;i<n;i++) { y[i]=(((y[i]+w0[i]*x0)+w1[i]*x1)+w2[i]*x2)+w3[i]*x3; }
+    }
+    for (;j<m;j++)
+    {
+        w0=W+j*ldw; x0=x[j*incx];
+        for (i=0;i<n;i++) { y[i]+=w0[i]*x0; }
+    } return;
+}
+
+static void simd_gemm(size_t r,size_t m,size_t n,const double *X,size_t ldx,const double *W,size_t ldw,double *C,size_t ldc,void **packed)
+{
+    gemm_panels_t *P=NULL;
+    if (packed!=NULL && *packed!=NULL) { neural_gemm(X,r,ldx,(gemm_panels_t *)*packed,C,ldc); return; }
+    P=neural_gemm_pack(W,m,n,ldw);
+    neural_gemm(X,r,ldx,P,C,ldc);
+    if (packed!=NULL) { *packed=P; }
+    else { neural_gemm_free(P); }
+    return;
+}
+
+static void simd_ger(size_t m,size_t n,double alpha,const double *x,const double *restrict y,size_t incy,double *W,size_t ldw)
+{
+    size_t j,i; double scale,*restrict w;
+    if (incy!=1) { naive_ger(m,n,alpha,x,y,incy,W,ldw); return; }
+    for (j=0;j<m;j++)
+    {
+        scale=alpha*x[j]; w=W+j*ldw;
+        for (i=0;i<n;i++) { w[i]+=scale*y[i]; }
+    } return;
+}
+
+static void simd_momentum(size_t m,size_t n,double alpha,double mu,const double *x,const double *restrict y,size_t incy,double *W,size_t ldw,double *V,size_t ldv)
+{
+    size_t j,i; double scale,*restrict w,*restrict v;
+    if (incy!=1) { naive_momentum(m,n,alpha,mu,x,y,incy,W,ldw,V,ldv); return; }
+    for (j=0;j<m;j++)
+    {
+        scale=alpha*x[j]; w=W+j*ldw; v=V+j*ldv;
+        for (i=0;i<n;i++) { v[i]=mu*v[i]+scale*y[i]; w[i]+=v[i]; }
+    } return;
+}
+
+static void simd_apply(neural_config_t *config,size_t n,const double *x,double *y)
+{
+    size_t i; double a=config->alpha,b=config->beta,e;
+    switch (config->atype)
+    {
+        case ACTIVATION_LGST: for (i=0;i<n;i++) { y[i]=1.0/(1.0+exp(-(a*x[i]+b))); } break;
+        case ACTIVATION_LNR:  for (i=0;i<n;i++) { y[i]=a*x[i]+b; } break;
+        case ACTIVATION_HTAN: for (i=0;i<n;i++) { e=exp(-(a*x[i]+b)); y[i]=(1.0-e)/(1.0+e); } break;
+        default: naive_apply(config,n,x,y); break;
+    } return;
+}
+
+
+
+
+/*
+ * The blas kernels call the system BLAS whose shared library
+ * NEURAL_BLAS names.The Makefile defines it when it finds one
+ * at build time.The library is opened on first use,privately,
+ * so that its cblas symbols do not take the place of the ones
+ * of the reference cblas.Without a library the blas backend
+ * is not available.
+ *
+ */
+
+typedef double      (*BlasDotFn)(const int,const double *,const int,const double *,const int);
+typedef void        (*BlasGemvFn)(const enum CBLAS_ORDER,const enum CBLAS_TRANSPOSE,const int,const int,const double,const double *,const int,const double *,const int,const double,double *,const int);
+typedef void        (*BlasGemmFn)(const enum CBLAS_ORDER,const enum CBLAS_TRANSPOSE,const enum CBLAS_TRANSPOSE,const int,const int,const int,const double,const double *,const int,const double *,const int,const double,double *,const int);
+typedef void        (*BlasGerFn)(const enum CBLAS_ORDER,const int,const int,const double,const double *,const int,const double *,const int,double *,const int);
+typedef void        (*BlasScalFn)(const int,const double,double *,const int);
+typedef void        (*BlasAxpyFn)(const int,const double,const double *,const int,double *,const int);
+
+static struct
+{
+    void                *handle;        // The opened library,NULL if it is not.
+    int                 tried;          // Set once the library has been looked for.
+    BlasDotFn           ddot;
+    BlasGemvFn          dgemv;
+    BlasGemmFn          dgemm;
+    BlasGerFn           dger;
+    BlasScalFn          dscal;
+    BlasAxpyFn          daxpy;
+} blas;
+
+static int blas_open(void)
+{
+    if (blas.tried) { return blas.handle!=NULL; }
+    blas.tried=1;
+#ifdef NEURAL_BLAS
+    blas.handle=dlopen(NEURAL_BLAS,RTLD_NOW | RTLD_LOCAL);
+    if (blas.handle==NULL) { return 0; }
+    *(void **)&blas.ddot=dlsym(blas.handle,"cblas_ddot");
+    *(void **)&blas.dgemv=dlsym(blas.handle,"cblas_dgemv");
+    *(void **)&blas.dgemm=dlsym(blas.handle,"cblas_dgemm");
+    *(void **)&blas.dger=dlsym(blas.handle,"cblas_dger");
+    *(void **)&blas.dscal=dlsym(blas.handle,"cblas_dscal");
+    *(void **)&blas.daxpy=dlsym(blas.handle,"cblas_daxpy");
+    if (blas.ddot==NULL || blas.dgemv==NULL || blas.dgemm==NULL || blas.dger==NULL || blas.dscal==NULL || blas.daxpy==NULL)
+    {
+        dlclose(blas.handle); blas.handle=NULL;
+    }
+#endif
+    return blas.handle!=NULL;
+}
+
+static double blas_dot(size_t n,const double *x,size_t incx,const double *y,size_t incy)
+{
+    return blas.ddot((int )n,x,(int )incx,y,(int )incy);
+}
+
+static void blas_gemv(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y)
+{
+    blas.dgemv(CblasRowMajor,CblasNoTrans,(int )m,(int )n,1.0,W,(int )ldw,x,(int )incx,0.0,y,1);
+    return;
+}
+
+static void blas_gemtv(size_t m,size_t n,const double *W,size_t ldw,const double *x,size_t incx,double *y)
+{
+    blas.dgemv(CblasRowMajor,CblasTrans,(int )m,(int )n,1.0,W,(int )ldw,x,(int )incx,0.0,y,1);
+    return;
+}
+
+static void blas_gemm(size_t r,size_t m,size_t n,const double *X,size_t ldx,const double *W,size_t ldw,double *C,size_t ldc,void **packed)
+{
+    blas.dgemm(CblasRowMajor,CblasNoTrans,CblasTrans,(int )r,(int )m,(int )n,1.0,X,(int )ldx,W,(int )ldw,0.0,C,(int )ldc);
+    return;
+}
+
+static void blas_ger(size_t m,size_t n,double alpha,const double *x,const double *y,size_t incy,double *W,size_t ldw)
+{
+    blas.dger(CblasRowMajor,(int )m,(int )n,alpha,x,1,y,(int )incy,W,(int )ldw);
+    return;
+}
+
+static void blas_momentum(size_t m,size_t n,double alpha,double mu,const double *x,const double *y,size_t incy,double *W,size_t ldw,double *V,size_t ldv)
+{
+    size_t j;
+    for (j=0;j<m;j++) { blas.dscal((int )n,mu,V+j*ldv,1); }
+    blas.dger(CblasRowMajor,(int )m,(int )n,alpha,x,1,y,(int )incy,V,(int )ldv);
+    for (j=0;j<m;j++) { blas.daxpy((int )n,1.0,V+j*ldv,1,W+j*ldw,1); }
+    return;
+}
+
+
+
+
+/*
+ * Defining the backends,in the order the autotuner tries
+ * them,and the global one the network loops call.It starts
+ * out with the in-tree kernels,but for the dot product of the
+ * naive backend,so that every sum is added up in order and the
+ * network computes exactly what the naive loops always did.
+ *
+ */
+
+#define BACKEND_COUNT       4
+
+static neural_backend_t backends[BACKEND_COUNT]=
+{
+    { "naive",naive_dot,naive_gemv,naive_gemtv,naive_gemm,naive_ger,naive_momentum,naive_apply },
+    { "cblas",reference_dot,reference_gemv,reference_gemtv,reference_gemm,reference_ger,reference_momentum,naive_apply },
+    { "simd",simd_dot,simd_gemv,simd_gemtv,simd_gemm,simd_ger,simd_momentum,simd_apply },
+    { "blas",blas_dot,blas_gemv,blas_gemtv,blas_gemm,blas_ger,blas_momentum,naive_apply }
+};
+
+static char *kernels[BACKEND_KERNELS]={ "dot","gemv","gemtv","gemm","ger","momentum","apply" };
+
+neural_backend_t neural_backend={ "default",naive_dot,simd_gemv,simd_gemtv,simd_gemm,simd_ger,simd_momentum,simd_apply };
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_backend_find() returns the backend of the
+ * given name,or NULL if there is no such backend or if it is not
+ * available on this host,as the blas one without a system BLAS.
+ *
+ * @param:  char                *name
+ * @return: neural_backend_t    *
+ *
+ */
+
+neural_backend_t *neural_backend_find(char *name)
+{
+    size_t b; assert(name!=NULL);
+    for (b=0;b<BACKEND_COUNT;b++)
+    {
+        if (strcmp(backends[b].name,name)!=0) { continue; }
+        if (strcmp(name,"blas")==0 && !blas_open()) { return NULL; }
+        return &backends[b];
+    } return NULL;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_backend_use() makes the given
+ * backend the one the network loops call.
+ *
+ * @param:  neural_backend_t    *backend
+ * @return: void
+ *
+ */
+
+void neural_backend_use(neural_backend_t *backend)
+{
+    assert(backend!=NULL);
+    neural_backend=*backend;
+    return;
+}
+
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_backend_release() deallocates the
+ * weights a matrix multiply has packed into a slot,if any.
+ *
+ * @param:  void    *packed
+ * @return: void
+ *
+ */
+
+void neural_backend_release(void *packed)
+{
+    if (packed!=NULL) { neural_gemm_free((gemm_panels_t *)packed); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function kernel_set() copies the k-th kernel of
+ * a backend into another one,in the order of the names of the
+ * kernels.
+ *
+ */
+
+static void kernel_set(neural_backend_t *to,neural_backend_t *from,size_t k)
+{
+    if (k==0) { to->dot=from->dot; }
+    else if (k==1) { to->gemv=from->gemv; }
+    else if (k==2) { to->gemtv=from->gemtv; }
+    else if (k==3) { to->gemm=from->gemm; }
+    else if (k==4) { to->ger=from->ger; }
+    else if (k==5) { to->momentum=from->momentum; }
+    else { to->apply=from->apply; }
+    return;
+}
+
+
+
+
+/*
+ * Defining a new data structure called tune_layer_t that holds
+ * the operands every kernel is timed on for a single layer,its
+ * synaptic weights,a copy of them and a velocity for the rank one
+ * updates and a batch of input signals and of linear aggregators.
+ *
+ */
+
+typedef struct
+{
+    neural_config_t     *config;
+    size_t              m;          // The neurons of the layer.
+    size_t              n;          // The synaptic weights per neuron.
+    size_t              r;          // The rows of a batch.
+    const double        *W;         // The synaptic weights,ld of n.
+    double              *copy;      // A copy of the synaptic weights.
+    double              *velocity;  // A velocity of the synaptic weights.
+    double              *X;         // A batch of input signals.
+    double              *C;         // A batch of linear aggregators.
+} tune_layer_t;
+
+
+
+
+/*
+ * @COMPLEXITY: O(w)    Where w is BACKEND_WORK.
+ *
+ * The static function kernel_time() returns the nanoseconds the k-th
+ * kernel of the given backend takes on the operands of the given layer,
+ * repeated until about BACKEND_WORK multiply-adds have been done,the
+ * fastest of BACKEND_PASSES passes.The matrix multiplies share one slot
+ * of packed weights,as the ones of a prediction do.
+ *
+ */
+
+static uint64_t kernel_time(neural_backend_t *b,size_t k,tune_layer_t *t)
+{
+    size_t p,i,work,reps; uint64_t start,elapsed,best=0;
+    volatile double sink=0.0; void *packed=NULL;
+    if (k==0 || k==6) { work=t->n; }
+    else if (k==3) { work=t->r*t->m*t->n; }
+    else { work=t->m*t->n; }
+    reps=BACKEND_WORK/(work>0 ? work : 1); if (reps==0) { reps=1; }
+    for (p=0;p<BACKEND_PASSES;p++)
+    {
+        start=profiler_clock();
+        for (i=0;i<reps;i++)
+        {
+            if (k==0) { sink+=b->dot(t->n,t->W,1,t->X,1); }
+            else if (k==1) { b->gemv(t->m,t->n,t->W,t->n,t->X,1,t->C); }
+            else if (k==2) { b->gemtv(t->m,t->n,t->W,t->n,t->X,1,t->C); }
+            else if (k==3) { b->gemm(t->r,t->m,t->n,t->X,t->n,t->W,t->n,t->C,t->m,&packed); }
+            else if (k==4) { b->ger(t->m,t->n,1e-12,t->C,t->X,1,t->copy,t->n); }
+            else if (k==5) { b->momentum(t->m,t->n,1e-12,0.5,t->C,t->X,1,t->copy,t->n,t->velocity,t->n); }
+            else { b->apply(t->config,t->n,t->X,t->C); }
+        }
+        elapsed=profiler_clock()-start;
+        if (p==0 || elapsed<best) { best=elapsed; }
+    }
+    neural_backend_release(packed);
+    return best;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*b*k*w)     Where l is the number of layers,b the
+ *                             number of backends,k the number of kernels
+ *                             and w is BACKEND_WORK.
+ *
+ * The function neural_backend_tune() times every kernel of every available
+ * backend on the shapes of the layers of the given network,the batched
+ * products on batches of the given number of rows,at most NEURAL_BATCH_ROWS,
+ * and fills in the given backend with the fastest implementation of every
+ * kernel over all the layers.Its name lists the backend every kernel has
+ * been taken from.
+ *
+ * @param:  neural_net_t        *nn
+ * @param:  size_t              rows
+ * @param:  neural_backend_t    *tuned
+ * @return: void
+ *
+ */
+
+void neural_backend_tune(neural_net_t *nn,size_t rows,neural_backend_t *tuned)
+{
+    // Variable declarations,type assertions
+    // and the backends available on this host.
+    size_t l,b,k,i,best,width,available[BACKEND_COUNT],count=0;
+    uint64_t totals[BACKEND_KERNELS][BACKEND_COUNT];
+    gsl_matrix *W=NULL; tune_layer_t t; size_t used=0;
+    assert(nn!=NULL && tuned!=NULL && nn->config->precision==PRECISION_F64);
+    for (b=0;b<BACKEND_COUNT;b++)
+    {
+        if (neural_backend_find(backends[b].name)!=NULL) { available[count++]=b; }
+    }
+    memset(totals,0,sizeof(totals));
+    t.config=nn->config;
+    t.r=(rows<1 ? 1 : rows>NEURAL_BATCH_ROWS ? NEURAL_BATCH_ROWS : rows);
+
+    for (l=0;l<(size_t )nn->config->nlayers;l++)
+    {
+        // Laying out the operands of the layer,the
+        // input signals are kept within the range of
+        // the activation functions.
+        W=neural_layer_getW(nn->layers[l]);
+        t.m=W->size1; t.n=W->size2;
+        width=(t.m>t.n ? t.m : t.n);
+        t.copy=(double *)malloc(t.m*t.n*sizeof(double ));
+        t.velocity=(double *)calloc(t.m*t.n,sizeof(double ));
+        t.X=(double *)malloc(t.r*width*sizeof(double ));
+        t.C=(double *)malloc(t.r*width*sizeof(double ));
+        assert(t.copy!=NULL && t.velocity!=NULL && t.X!=NULL && t.C!=NULL);
+        for (i=0;i<t.m;i++) { memcpy(t.copy+i*t.n,W->data+i*W->tda,t.n*sizeof(double )); }
+        for (i=0;i<t.r*width;i++) { t.X[i]=(double )(i%7)/7.0-0.5; t.C[i]=0.0; }
+        t.W=t.copy;
+        for (b=0;b<count;b++)
+        {
+            for (k=0;k<BACKEND_KERNELS;k++) { totals[k][b]+=kernel_time(&backends[available[b]],k,&t); }
+        }
+        free(t.copy); free(t.velocity); free(t.X); free(t.C);
+    }
+
+    // Taking every kernel from the backend
+    // that ran it fastest over all layers.
+    *tuned=backends[0]; tuned->name[0]='\0';
+    for (k=0;k<BACKEND_KERNELS;k++)
+    {
+        for (b=1,best=0;b<count;b++) { if (totals[k][b]<totals[k][best]) { best=b; } }
+        kernel_set(tuned,&backends[available[best]],k);
+        used+=snprintf(tuned->name+used,sizeof(tuned->name)-used,"%s%s=%s",k>0 ? " " : "",kernels[k],backends[available[best]].name);
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The static function cache_key() writes the key of the cached choices
+ * of the given network on this host,the name of the host followed by
+ * the shape of the network and the rows of a batch.
+ *
+ */
+
+static void cache_key(neural_net_t *nn,size_t rows,char *key,size_t size)
+{
+    char host[64]; size_t used; llint l;
+    if (gethostname(host,sizeof(host))!=0) { strcpy(host,"localhost"); }
+    host[sizeof(host)-1]='\0';
+    if (rows>NEURAL_BATCH_ROWS) { rows=NEURAL_BATCH_ROWS; }
+    used=snprintf(key,size,"%s %lld",host,nn->config->signals);
+    for (l=0;l<nn->config->nlayers && used<size;l++) { used+=snprintf(key+used,size-used,":%lld",nn->config->neurons[l]); }
+    if (used<size) { snprintf(key+used,size-used,"@%zu",rows); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(c)    Where c is the size of the cache.
+ *
+ * The static function backend_lookup() looks up the choices cached for
+ * the given network on this host in the given model directory,for the
+ * given rows of a batch,and fills in the given backend with them.It
+ * returns one on success and zero if there are no such choices or if
+ * one of their backends is not available anymore.
+ *
+ */
+
+static int backend_lookup(neural_net_t *nn,char *directory,size_t rows,neural_backend_t *tuned)
+{
+    char path[4096],key[512],line[1024],names[BACKEND_KERNELS][16];
+    FILE *f=NULL; size_t k,len; int found=0; neural_backend_t *b=NULL;
+    snprintf(path,sizeof(path),"%s"BACKEND_CACHE,directory);
+    cache_key(nn,rows,key,sizeof(key)); len=strlen(key);
+    if ((f=fopen(path,"r"))==NULL) { return 0; }
+    while (!found && fgets(line,sizeof(line),f)!=NULL)
+    {
+        if (strncmp(line,key,len)!=0 || line[len]!=' ') { continue; }
+        if (sscanf(line+len," dot=%15s gemv=%15s gemtv=%15s gemm=%15s ger=%15s momentum=%15s apply=%15s",
+                   names[0],names[1],names[2],names[3],names[4],names[5],names[6])!=BACKEND_KERNELS) { continue; }
+        found=1; *tuned=backends[0]; tuned->name[0]='\0';
+        for (k=0;k<BACKEND_KERNELS && found;k++)
+        {
+            if ((b=neural_backend_find(names[k]))==NULL) { found=0; break; }
+            kernel_set(tuned,b,k);
+        }
+        if (found) { snprintf(tuned->name,sizeof(tuned->name),"%s",line+len+1); tuned->name[strcspn(tuned->name,"\n")]='\0'; }
+    }
+    fclose(f); return found;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(c)    Where c is the size of the cache.
+ *
+ * The static function backend_store() caches the choices of the given
+ * tuned backend for the given network on this host,for the given rows
+ * of a batch,into the given model directory,replacing any earlier ones
+ * of the same key and keeping the ones of the other hosts.A directory
+ * that cannot be written leaves the cache as it was.
+ *
+ */
+
+static void backend_store(neural_net_t *nn,char *directory,size_t rows,neural_backend_t *tuned)
+{
+    char path[4096],key[512],line[1024],*kept=NULL;
+    size_t len,size=0,capacity=0,n; FILE *f=NULL;
+    snprintf(path,sizeof(path),"%s"BACKEND_CACHE,directory);
+    cache_key(nn,rows,key,sizeof(key)); len=strlen(key);
+    if ((f=fopen(path,"r"))!=NULL)
+    {
+        while (fgets(line,sizeof(line),f)!=NULL)
+        {
+            if (strncmp(line,key,len)==0 && line[len]==' ') { continue; }
+            n=strlen(line);
+            if (size+n+1>capacity) { capacity=2*(size+n+1); kept=(char *)realloc(kept,capacity); assert(kept!=NULL); }
+            memcpy(kept+size,line,n+1); size+=n;
+        } fclose(f);
+    }
+    if ((f=fopen(path,"w"))!=NULL)
+    {
+        if (size>0) { fwrite(kept,1,size,f); }
+        fprintf(f,"%s %s\n",key,tuned->name);
+        fclose(f);
+    }
+    free(kept); return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*b*k*w)     Where l is the number of layers,b the
+ *                             number of backends,k the number of kernels
+ *                             and w is BACKEND_WORK,unless the choices
+ *                             are cached.
+ *
+ * The function neural_backend_select() switches to the backend tuned for
+ * the given network on this host and for batches of the given number of
+ * rows.The choices cached in the given model directory are used if there
+ * are any,otherwise the network is tuned and its choices are cached.A tiny
+ * or single precision network never calls the kernels on the hot path,so
+ * it is left on the default backend,the naive dot product and the in-tree
+ * kernels for the rest.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  char            *directory
+ * @param:  size_t          rows
+ * @return: void
+ *
+ */
+
+void neural_backend_select(neural_net_t *nn,char *directory,size_t rows)
+{
+    neural_backend_t tuned;
+    assert(nn!=NULL && directory!=NULL);
+    if (nn->tiny || nn->config->precision!=PRECISION_F64) { return; }
+    if (rows>NEURAL_BATCH_ROWS) { rows=NEURAL_BATCH_ROWS; }
+    if (!backend_lookup(nn,directory,rows,&tuned))
+    {
+        neural_backend_tune(nn,rows,&tuned);
+        backend_store(nn,directory,rows,&tuned);
+    }
+    neural_backend_use(&tuned); return;
+}
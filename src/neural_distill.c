@@ -0,0 +1,251 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * distillation of a large teacher
+ * network into a small student network.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the string
+ * manipulation library,the mathematics library,
+ * the gsl random number generators and distributions,
+ * the header file "neural_distill.h" that contains
+ * datatype definitions and function prototypings
+ * regarding the distillation and the header file
+ * "profiler.h" for its monotonic clock.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include "neural_distill.h"
+#include "profiler.h"
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*n)      Where r is the number of rows and n
+ *                          the number of input signals.
+ *
+ * The static function signal_deviations() returns the standard
+ * deviation of every input signal of the given rows.The bias
+ * column is left at zero,so it is never perturbed.
+ *
+ */
+
+static double *signal_deviations(gsl_matrix *data,size_t signals)
+{
+    size_t i,j; double *means=NULL,*deviations=NULL,delta;
+    means=(double *)calloc(signals,sizeof(double ));
+    deviations=(double *)calloc(signals,sizeof(double ));
+    assert(means!=NULL && deviations!=NULL);
+    if (data->size1==0) { free(means); return deviations; }
+    for (i=0;i<data->size1;i++)
+    {
+        for (j=1;j<signals;j++) { means[j]+=gsl_matrix_get(data,i,j); }
+    }
+    for (j=1;j<signals;j++) { means[j]/=(double )data->size1; }
+    for (i=0;i<data->size1;i++)
+    {
+        for (j=1;j<signals;j++) { delta=gsl_matrix_get(data,i,j)-means[j]; deviations[j]+=delta*delta; }
+    }
+    for (j=1;j<signals;j++) { deviations[j]=sqrt(deviations[j]/(double )data->size1); }
+    free(means); return deviations;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(c*r*l*m*n)   Where c is the number of copies,r the
+ *                             number of rows,l the number of layers and
+ *                             ( m x n ) the dimensions of the largest
+ *                             synaptic weights matrix of the teacher.
+ *
+ * The function neural_distill_label() returns a newly allocated matrix
+ * that holds the input signals of the given rows followed by the output
+ * signals the teacher network propagates them to,its soft outputs,which
+ * a student network is then trained against.The given rows come first,
+ * followed by the given number of augmented copies of them,in which every
+ * input signal is perturbed by gaussian noise whose standard deviation is
+ * the given fraction of the one of its column.The noise is drawn from a
+ * generator seeded with the given seed.Any column of the given rows past
+ * the input signals is ignored.
+ *
+ * @param:  neural_net_t    *teacher
+ * @param:  gsl_matrix      *data
+ * @param:  llint           copies
+ * @param:  double          noise
+ * @param:  unsigned long   seed
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_distill_label(neural_net_t *teacher,gsl_matrix *data,llint copies,double noise,unsigned long seed)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t i,j,k,c,s,n,rows; double *deviations=NULL;
+    gsl_matrix *labelled=NULL,*Y=NULL; gsl_rng *r=NULL;
+    gsl_vector_view row;
+    assert(teacher!=NULL && data!=NULL && copies>=0 && noise>=0.0);
+    s=(size_t )teacher->config->signals;
+    n=(size_t )teacher->config->neurons[teacher->config->nlayers-1];
+    rows=data->size1; assert(data->size2>=s);
+
+    labelled=gsl_matrix_alloc(rows*(size_t )(copies+1),s+n);
+    assert(labelled!=NULL);
+    deviations=signal_deviations(data,s);
+    r=gsl_rng_alloc(gsl_rng_taus); gsl_rng_set(r,seed);
+
+    for (c=0;c<=(size_t )copies;c++)
+    {
+        for (i=0;i<rows;i++)
+        {
+            // Copying the input signals of the row,perturbed
+            // unless it is the original one,and appending the
+            // output signals of the teacher as the targets.
+            k=c*rows+i;
+            for (j=0;j<s;j++) { gsl_matrix_set(labelled,k,j,gsl_matrix_get(data,i,j)); }
+            for (j=1;c>0 && j<s;j++) { gsl_matrix_set(labelled,k,j,gsl_matrix_get(labelled,k,j)+gsl_ran_gaussian(r,noise*deviations[j])); }
+            row=gsl_matrix_subrow(labelled,k,0,s);
+            Y=neural_net_activate(teacher,&row.vector);
+            for (j=0;j<n;j++) { gsl_matrix_set(labelled,k,s+j,gsl_matrix_get(Y,j,0)); }
+        }
+    }
+    gsl_rng_free(r); free(deviations);
+    return labelled;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The static function network_weights() returns the number of
+ * synaptic weights of the given network,the bias ones included.
+ *
+ */
+
+static size_t network_weights(neural_net_t *nn)
+{
+    size_t weights=0; llint l;
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        weights+=(size_t )(nn->config->neurons[l]*(l==0 ? nn->config->signals : nn->config->neurons[l-1]+1));
+    } return weights;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(p*r*l*m*n)   Where p is the number of timed passes,r
+ *                             the number of rows,l the number of layers
+ *                             and ( m x n ) the dimensions of the largest
+ *                             synaptic weights matrix.
+ *
+ * The static function prediction_seconds() returns the seconds the
+ * given network takes to predict a single one of the given rows,the
+ * fastest of DISTILL_PASSES passes of neural_net_predict() over them.
+ *
+ */
+
+static double prediction_seconds(neural_net_t *nn,gsl_matrix *data)
+{
+    size_t p; uint64_t start,elapsed,best=0;
+    gsl_matrix *results=NULL;
+    if (data->size1==0) { return 0.0; }
+    for (p=0;p<DISTILL_PASSES;p++)
+    {
+        start=profiler_clock();
+        results=neural_net_predict(nn,data);
+        elapsed=profiler_clock()-start;
+        gsl_matrix_free(results);
+        if (p==0 || elapsed<best) { best=elapsed; }
+    } return (double )best*1e-9/(double )data->size1;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(p*r*l*m*n)   Where p is the number of timed passes,r
+ *                             the number of rows,l the number of layers
+ *                             and ( m x n ) the dimensions of the largest
+ *                             synaptic weights matrix of the teacher.
+ *
+ * The function neural_distill_compare() propagates every row of the given
+ * dataset through both the student and its teacher and fills in the report
+ * with how often their strongest output signals agree,the number of weights
+ * of either network and the seconds either one takes to predict a row.If the
+ * dataset holds the desired output signals both networks are also scored
+ * on it.
+ *
+ * @param:  neural_net_t        *student
+ * @param:  neural_net_t        *teacher
+ * @param:  dataset_t           *ds
+ * @param:  distill_report_t    *report
+ * @return: void
+ *
+ */
+
+void neural_distill_compare(neural_net_t *student,neural_net_t *teacher,dataset_t *ds,distill_report_t *report)
+{
+    // Variable declarations,type
+    // assertions and default values.
+    size_t i,j,s,n,best_p,best_y,agree=0;
+    gsl_vector_view row; gsl_matrix_view inputs;
+    gsl_matrix *Y=NULL,*P=NULL;
+    assert(student!=NULL && teacher!=NULL && ds!=NULL && report!=NULL);
+    assert(student->config->signals==teacher->config->signals);
+    s=(size_t )teacher->config->signals;
+    n=(size_t )teacher->config->neurons[teacher->config->nlayers-1];
+    memset(report,0,sizeof(*report));
+    report->rows=ds->data->size1;
+    report->targets=(ds->data->size2==s+n);
+    report->weights=network_weights(student);
+    report->teacher_weights=network_weights(teacher);
+    if (report->rows==0) { return; }
+
+    for (i=0;i<report->rows;i++)
+    {
+        // Propagating the row through both networks,each
+        // one keeps its output signals in a matrix of its own.
+        row=gsl_matrix_subrow(ds->data,i,0,s);
+        P=neural_net_activate(student,&row.vector);
+        Y=neural_net_activate(teacher,&row.vector);
+        best_p=0; best_y=0;
+        for (j=1;j<n;j++)
+        {
+            if (gsl_matrix_get(P,j,0)>gsl_matrix_get(P,best_p,0)) { best_p=j; }
+            if (gsl_matrix_get(Y,j,0)>gsl_matrix_get(Y,best_y,0)) { best_y=j; }
+        }
+        if (best_p==best_y) { agree++; }
+    }
+    report->agreement=(double )agree/(double )report->rows;
+
+    // Timing both networks on the input signals only,so
+    // that the rows propagated are the ones of predicting.
+    inputs=gsl_matrix_submatrix(ds->data,0,0,report->rows,s);
+    report->seconds=prediction_seconds(student,&inputs.matrix);
+    report->teacher_seconds=prediction_seconds(teacher,&inputs.matrix);
+    if (!report->targets) { return; }
+    evaluation_score(teacher,ds,NULL,report->rows,&report->teacher);
+    evaluation_score(student,ds,NULL,report->rows,&report->student);
+    return;
+}
@@ -0,0 +1,363 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * evaluation of neural networks.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,the
+ * standard assertions library,the standard string
+ * manipulation library,the standard mathematics
+ * library,the gnu random number generation library,
+ * the header file "neural_eval.h" that contains the
+ * prototypings of the evaluation procedures,the
+ * header file "neural_utils.h" that contains the
+ * training procedures and the header file
+ * "thread_pool.h" that runs the folds concurrently.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_rng.h>
+#include "neural_eval.h"
+#include "neural_utils.h"
+#include "thread_pool.h"
+
+
+
+
+/*
+ * Defining a new data structure called fold_task_t that
+ * carries everything a worker thread needs to train and
+ * score one fold.Every fold owns a private copy of the
+ * neural configuration while the dataset matrix and the
+ * matrix of training rows are shared read-only between
+ * all of them.
+ *
+ */
+
+typedef struct
+{
+    neural_config_t     config;                 // A private copy of the configuration.
+    dataset_t           *ds;                    // The shared dataset.
+    gsl_matrix          *targets;               // The shared rows the folds are trained on.
+    size_t              *train;                 // The row indices of the training view.
+    size_t              ntrain;                 // The number of training rows.
+    size_t              *test;                  // The row indices of the held-out view.
+    size_t              ntest;                  // The number of held-out rows.
+    evaluation_t        *result;                // Where the scores of the fold are written.
+} fold_task_t;
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of indices.
+ *
+ * The function evaluation_permutation() takes two arguments
+ * as parameters,namely the number of rows and a seed for the
+ * random number generator,and returns a newly allocated array
+ * holding a uniformly random permutation of 0..n-1 produced by
+ * the Fisher-Yates shuffle.The same seed always yields the same
+ * permutation so that fold assignments are reproducible.
+ *
+ * @param:  size_t          n
+ * @param:  unsigned long   seed
+ * @return: size_t          *
+ *
+ */
+
+size_t *evaluation_permutation(size_t n,unsigned long seed)
+{
+    size_t i,j,temp;
+    size_t *perm=NULL;
+    gsl_rng *random_gen=NULL;
+
+    perm=(size_t *)malloc(n*sizeof(size_t ));
+    assert(perm!=NULL);
+    for (i=0;i<n;i++) { perm[i]=i; }
+
+    random_gen=gsl_rng_alloc(gsl_rng_taus);
+    gsl_rng_set(random_gen,seed);
+    for (i=n;i>1;i--)
+    {
+        j=gsl_rng_uniform_int(random_gen,i);
+        temp=perm[i-1]; perm[i-1]=perm[j]; perm[j]=temp;
+    }
+
+    gsl_rng_free(random_gen);
+    random_gen=NULL;
+    return perm;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of scored rows,l the
+ *                              number of layers and ( m x n ) the dimensions
+ *                              of the largest synaptic weights matrix.
+ *
+ * The function evaluation_score() takes five arguments as parameters.
+ * The first argument is a trained neural network,the second one the
+ * dataset whose matrix holds the bias,signals and desired outputs,the
+ * third one an array of row indices ( NULL for every row ),the fourth
+ * one the number of rows to score and the last one the evaluation data
+ * structure that receives the scores.Classification rows are counted as
+ * correct when the largest output signal and the largest desired output
+ * share the same index.Curve fitting outputs and targets are descaled
+ * with the dataset's minimum and maximum values before the error is
+ * accumulated,provided that the dataset has been normalized.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  dataset_t       *ds
+ * @param:  size_t          *index
+ * @param:  size_t          rows
+ * @param:  evaluation_t    *ev
+ * @return: void
+ *
+ */
+
+void evaluation_score(neural_net_t *nn,dataset_t *ds,size_t *index,size_t rows,evaluation_t *ev)
+{
+    // Variable declarations,type
+    // assertions and default values.
+    size_t i,j,r,s,best_y,best_d;
+    double y,d,min,max,sum=0.0;
+    gsl_vector_view input_row;
+    gsl_matrix *Y=NULL;
+    assert(nn!=NULL && ds!=NULL && ev!=NULL);
+    s=nn->config->signals;
+    ev->test_rows=rows; ev->correct=0;
+    ev->accuracy=0.0; ev->rmse=0.0;
+    if (rows==0) { return; }
+
+    for (i=0;i<rows;i++)
+    {
+        // Forward propagating the signals of the current
+        // row through the network.The returned matrix is
+        // the output layer's signals matrix.
+        r=(index==NULL ? i : index[i]);
+        input_row=gsl_matrix_subrow(ds->data,r,0,s);
+        Y=neural_net_activate(nn,(gsl_vector *)&input_row);
+
+        // For classification we compare the index of the
+        // strongest output signal with the desired class.
+        if (ds->type==DATASET_CLASSIFY)
+        {
+            best_y=0; best_d=0;
+            for (j=1;j<Y->size1;j++)
+            {
+                if (gsl_matrix_get(Y,j,0)>gsl_matrix_get(Y,best_y,0))           { best_y=j; }
+                if (gsl_matrix_get(ds->data,r,s+j)>gsl_matrix_get(ds->data,r,s+best_d)) { best_d=j; }
+            }
+            if (best_y==best_d) { ev->correct++; }
+            continue;
+        }
+
+        // For curve fitting we accumulate the squared error
+        // of every output signal in the original units.
+        for (j=0;j<Y->size1;j++)
+        {
+            y=gsl_matrix_get(Y,j,0);
+            d=gsl_matrix_get(ds->data,r,s+j);
+            if (ds->minimums!=NULL && ds->maximums!=NULL)
+            {
+                min=gsl_vector_get(ds->minimums,s+j);
+                max=gsl_vector_get(ds->maximums,s+j);
+                y=ds->descaler(min,max,y,2.0,1.0);
+                d=ds->descaler(min,max,d,2.0,1.0);
+            } sum+=(d-y)*(d-y);
+        }
+    }
+
+    ev->accuracy=(double )ev->correct/(double )rows;
+    if (ds->type==DATASET_PREDICT) { ev->rmse=sqrt(sum/(double )(rows*Y->size1)); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(f(n))     Where f(n) is the time complexity of
+ *                          training the network of the fold.
+ *
+ * The static function fold_run() is the task executed by the
+ * worker threads.It creates a network from the private copy of
+ * the configuration,trains it quietly on the training view of
+ * the shared training rows and scores it on the held-out view of
+ * the shared dataset.
+ *
+ * @param:  void    *p
+ * @return: void
+ *
+ */
+
+static void fold_run(void *p)
+{
+    fold_task_t *fold=(fold_task_t *)p;
+    neural_net_t *nn=NULL;
+    training_session_t ts;
+
+    nn=neural_net_create(&fold->config);
+    neural_net_threads(nn,1);
+    training_session_init(&ts,nn,fold->targets);
+    ts.index=fold->train; ts.rows=fold->ntrain; ts.quiet=1;
+    backpropagation_session(nn,fold->targets,&ts);
+
+    evaluation_score(nn,fold->ds,fold->test,fold->ntest,fold->result);
+    fold->result->train_rows=fold->ntrain;
+    fold->result->epochs=ts.epoch;
+    neural_net_free(nn); nn=NULL;
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(k*f(n))   Where k is the number of folds and f(n) the
+ *                          time complexity of training a single fold,
+ *                          divided across the available processors.
+ *
+ * The function cross_validation_run() takes five arguments as
+ * parameters,namely a neural configuration,a loaded and optionally
+ * normalized dataset,the rows the folds are trained on,the number
+ * of folds and the seed that decides the fold assignment.The rows
+ * are shuffled once and split into k contiguous blocks of the
+ * permutation.Fold f is held out on block f and trained on the
+ * remaining blocks.The training rows are the rows of the dataset
+ * if NULL is given,otherwise a matrix such as the soft outputs of
+ * a teacher,whose row i and every further multiple of the number
+ * of rows of the dataset past it,its augmented copies,stand in for
+ * row i of the dataset when training.The held-out rows are always
+ * scored against the dataset.All folds are trained concurrently
+ * on a thread pool against the same dataset matrix,each fold only owning
+ * the index arrays of its views.An array of k evaluation data structures
+ * is returned and must be released by the caller.
+ *
+ * @param:  neural_config_t     *config
+ * @param:  dataset_t           *ds
+ * @param:  gsl_matrix          *targets
+ * @param:  llint               k
+ * @param:  unsigned long       seed
+ * @return: evaluation_t        *
+ *
+ */
+
+evaluation_t *cross_validation_run(neural_config_t *config,dataset_t *ds,gsl_matrix *targets,llint k,unsigned long seed)
+{
+    // Variable declarations
+    // and type assertions.
+    llint f; size_t n,lo,hi,c,copies;
+    size_t *perm=NULL,nworkers;
+    fold_task_t *folds=NULL;
+    evaluation_t *results=NULL;
+    thread_pool_t *pool=NULL;
+    assert(config!=NULL && ds!=NULL);
+    n=ds->data->size1;
+    assert(k>1 && (size_t )k<=n);
+    if (targets==NULL) { targets=ds->data; }
+    assert(targets->size1%n==0);
+    copies=targets->size1/n;
+
+    // Allocating the fold descriptors and
+    // the array that receives the results.
+    folds=(fold_task_t *)malloc(k*sizeof(fold_task_t ));
+    results=(evaluation_t *)calloc(k,sizeof(evaluation_t ));
+    assert(folds!=NULL && results!=NULL);
+    perm=evaluation_permutation(n,seed);
+
+    // Splitting the permutation into the held-out block
+    // and the training rows of every fold.The held-out
+    // view points straight into the permutation array,
+    // the training view is followed by the copies of its
+    // rows,so that no copy of a held-out row is trained on.
+    for (f=0;f<k;f++)
+    {
+        lo=(size_t )f*n/(size_t )k;
+        hi=(size_t )(f+1)*n/(size_t )k;
+        folds[f].config=*config;
+        folds[f].ds=ds;
+        folds[f].targets=targets;
+        folds[f].test=perm+lo;
+        folds[f].ntest=hi-lo;
+        folds[f].ntrain=copies*(n-(hi-lo));
+        folds[f].train=(size_t *)malloc(folds[f].ntrain*sizeof(size_t ));
+        assert(folds[f].train!=NULL);
+        memcpy(folds[f].train,perm,lo*sizeof(size_t ));
+        memcpy(folds[f].train+lo,perm+hi,(n-hi)*sizeof(size_t ));
+        for (c=n-(hi-lo);c<folds[f].ntrain;c++) { folds[f].train[c]=folds[f].train[c-(n-(hi-lo))]+n; }
+        folds[f].result=&results[f];
+    }
+
+    // Training and scoring the folds concurrently.
+    nworkers=thread_pool_cpus();
+    if (nworkers>(size_t )k) { nworkers=(size_t )k; }
+    pool=thread_pool_create(nworkers);
+    for (f=0;f<k;f++) { thread_pool_submit(pool,fold_run,&folds[f]); }
+    thread_pool_free(pool); pool=NULL;
+
+    for (f=0;f<k;f++) { free(folds[f].train); }
+    free(folds); free(perm);
+    return results;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(k)    Where k is the number of folds.
+ *
+ * The function evaluation_aggregate() takes four arguments as
+ * parameters,namely an array of per-fold evaluations,the number
+ * of folds and two evaluation data structures that receive the
+ * mean and the standard deviation of the accuracy and the root
+ * mean square error across the folds.
+ *
+ * @param:  evaluation_t    *folds
+ * @param:  llint           k
+ * @param:  evaluation_t    *mean
+ * @param:  evaluation_t    *stddev
+ * @return: void
+ *
+ */
+
+void evaluation_aggregate(evaluation_t *folds,llint k,evaluation_t *mean,evaluation_t *stddev)
+{
+    llint f;
+    assert(folds!=NULL && k>0 && mean!=NULL && stddev!=NULL);
+    memset(mean,0,sizeof(*mean));
+    memset(stddev,0,sizeof(*stddev));
+
+    for (f=0;f<k;f++)
+    {
+        mean->train_rows+=folds[f].train_rows;
+        mean->test_rows+=folds[f].test_rows;
+        mean->correct+=folds[f].correct;
+        mean->accuracy+=folds[f].accuracy/(double )k;
+        mean->rmse+=folds[f].rmse/(double )k;
+        mean->epochs+=folds[f].epochs;
+    }
+
+    for (f=0;f<k;f++)
+    {
+        stddev->accuracy+=pow(folds[f].accuracy-mean->accuracy,2)/(double )k;
+        stddev->rmse+=pow(folds[f].rmse-mean->rmse,2)/(double )k;
+    }
+
+    stddev->accuracy=sqrt(stddev->accuracy);
+    stddev->rmse=sqrt(stddev->rmse);
+    return;
+}
@@ -0,0 +1,259 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the export
+ * of a trained neural network into
+ * standalone C source code.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the header
+ * file "neural_export.h" that contains the
+ * function prototypings regarding the export,
+ * the header file "neural_utils.h" for the
+ * activation types and the header file
+ * "dataset.h" for the dataset types.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include "neural_export.h"
+#include "neural_utils.h"
+#include "dataset.h"
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the synaptic weights matrix.
+ *
+ * The static function layer_fold() returns the biases and the weights
+ * a layer is exported with,the biases first.The bias of a neuron is the
+ * weight of the constant input signal -1 negated.For the first layer the
+ * min max scaling of every input signal,a*(x-min)/(max-min)-b,is folded
+ * into its weights and the bias,so that the layer takes the raw signals.
+ * A constant input column,whose minimum equals its maximum,is taken to be
+ * scaled to -b.
+ *
+ */
+
+static double *layer_fold(neural_net_t *nn,size_t l,gsl_vector *minimums,gsl_vector *maximums,double a,double b)
+{
+    size_t j,i,m,n; double *folded=NULL,w,min,max,*bias=NULL;
+    m=(size_t )nn->config->neurons[l];
+    n=(size_t )(l==0 ? nn->config->signals : nn->config->neurons[l-1]+1)-1;
+    folded=(double *)malloc(m*(n+1)*sizeof(double ));
+    assert(folded!=NULL);
+    for (j=0;j<m;j++)
+    {
+        bias=&folded[j*(n+1)]; *bias=-neural_net_weight(nn,l,j,0);
+        for (i=0;i<n;i++)
+        {
+            w=neural_net_weight(nn,l,j,i+1); folded[j*(n+1)+i+1]=w;
+            if (l>0 || minimums==NULL || maximums==NULL) { continue; }
+            min=gsl_vector_get(minimums,i+1); max=gsl_vector_get(maximums,i+1);
+            if (max==min) { *bias-=w*b; folded[j*(n+1)+i+1]=0.0; continue; }
+            folded[j*(n+1)+i+1]=w*a/(max-min);
+            *bias-=w*(a*min/(max-min)+b);
+        }
+    } return folded;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the synaptic weights matrix.
+ *
+ * The static function emit_arrays() writes the biases and the weights
+ * of a layer as static const arrays named after the given prefix and
+ * the index of the layer,every value with enough digits to be read
+ * back into the same double.
+ *
+ */
+
+static void emit_arrays(FILE *f,char *prefix,size_t l,double *folded,size_t m,size_t n)
+{
+    size_t j,i;
+    fprintf(f,"static const double %s_B%zu[%zu]=\n{\n",prefix,l,m);
+    for (j=0;j<m;j++) { fprintf(f,"    %.17g%s\n",folded[j*(n+1)],j+1<m ? "," : ""); }
+    fprintf(f,"};\n\n");
+    fprintf(f,"static const double %s_W%zu[%zu][%zu]=\n{\n",prefix,l,m,n);
+    for (j=0;j<m;j++)
+    {
+        fprintf(f,"    { ");
+        for (i=0;i<n;i++) { fprintf(f,"%.17g%s",folded[j*(n+1)+i+1],i+1<n ? "," : ""); }
+        fprintf(f," }%s\n",j+1<m ? "," : "");
+    } fprintf(f,"};\n\n");
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the synaptic weights matrix.
+ *
+ * The static function emit_layer() writes the forward pass of a layer.
+ * Small layers are unrolled into one statement per neuron that sums a
+ * term per weight,larger ones into two nested loops of constant bounds.
+ * The output signals of the neurons are written into the given array,
+ * through the descaling arrays of the output signals if it is scaled.
+ *
+ */
+
+static void emit_layer(FILE *f,char *prefix,size_t l,size_t m,size_t n,char *in,char *out,int scaled)
+{
+    size_t j,i;
+    fprintf(f,"    // Layer %zu: %zu neurons of %zu input signals.\n",l,m,n);
+    if (m*n<=EXPORT_UNROLL)
+    {
+        for (j=0;j<m;j++)
+        {
+            fprintf(f,"    %s[%zu]=",out,j);
+            if (scaled) { fprintf(f,"%s_scales[%zu]*",prefix,j); }
+            fprintf(f,"%s_activate(%s_B%zu[%zu]",prefix,prefix,l,j);
+            for (i=0;i<n;i++) { fprintf(f,"+%s_W%zu[%zu][%zu]*%s[%zu]",prefix,l,j,i,in,i); }
+            fprintf(f,")");
+            if (scaled) { fprintf(f,"+%s_offsets[%zu]",prefix,j); }
+            fprintf(f,";\n");
+        } fprintf(f,"\n"); return;
+    }
+    fprintf(f,"    for (j=0;j<%zu;j++)\n    {\n",m);
+    fprintf(f,"        s=%s_B%zu[j];\n",prefix,l);
+    fprintf(f,"        for (i=0;i<%zu;i++) { s+=%s_W%zu[j][i]*%s[i]; }\n",n,prefix,l,in);
+    if (scaled) { fprintf(f,"        %s[j]=%s_scales[j]*%s_activate(s)+%s_offsets[j];\n",out,prefix,prefix,prefix); }
+    else        { fprintf(f,"        %s[j]=%s_activate(s);\n",out,prefix); }
+    fprintf(f,"    }\n\n");
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_export_c() writes the given network as a self
+ * contained C source file into the given stream.The sizes of the layers
+ * and their weights are hard-coded as static const arrays,the activation
+ * function with its coefficients as a static inline function,and the
+ * forward pass is specialised for the exact topology.If the min max values
+ * of the normalization are given they are folded into the first layer and,
+ * for curve fitting datasets,into the descaling of the output signals.The
+ * exported source defines the function <prefix>_predict(),which maps the
+ * raw input signals onto the output signals,and for classification datasets
+ * <prefix>_classify() as well,which returns the index of the strongest one.
+ * Every identifier it defines starts with the given prefix.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  gsl_vector      *minimums
+ * @param:  gsl_vector      *maximums
+ * @param:  int             type
+ * @param:  char            *prefix
+ * @param:  FILE            *f
+ * @return: void
+ *
+ */
+
+void neural_export_c(neural_net_t *nn,gsl_vector *minimums,gsl_vector *maximums,int type,char *prefix,FILE *f)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,j,m,n,last,outputs,loops=0;
+    double a,b,min,max,*folded=NULL,*scales=NULL,*offsets=NULL;
+    char in[64],out[64]; neural_config_t *config=NULL;
+    assert(nn!=NULL && prefix!=NULL && f!=NULL);
+    assert(type==DATASET_CLASSIFY || type==DATASET_PREDICT);
+    config=nn->config; last=(size_t )config->nlayers-1;
+    outputs=(size_t )config->neurons[last];
+    a=(type==DATASET_CLASSIFY ? 1.0 : 2.0);
+    b=(type==DATASET_CLASSIFY ? 0.0 : 1.0);
+
+    fprintf(f,"/*\n * Generated by neuralnet --export-c,do not edit.\n *\n * Topology: %lld input signals",config->signals-1);
+    for (l=0;l<=last;l++) { fprintf(f," -> %lld",config->neurons[l]); }
+    fprintf(f,",%s activation ( alpha %.17g,beta %.17g ).\n",config->atype==ACTIVATION_LGST ? "logistic" : (config->atype==ACTIVATION_HTAN ? "hyperbolic tangent" : "linear"),config->alpha,config->beta);
+    fprintf(f," * The input signals are %s.\n",minimums!=NULL ? "raw,the min max scaling is folded into the first layer" : "used as they are given");
+    fprintf(f," *\n */\n\n#include <stddef.h>\n#include <math.h>\n\n");
+    fprintf(f,"#define %s_INPUTS %lld\n#define %s_OUTPUTS %zu\n\n",prefix,config->signals-1,prefix,outputs);
+
+    // The weights of every layer,the first one
+    // with the min max scaling folded into it.
+    for (l=0;l<=last;l++)
+    {
+        m=(size_t )config->neurons[l];
+        n=(size_t )(l==0 ? config->signals : config->neurons[l-1]+1)-1;
+        if (m*n>EXPORT_UNROLL) { loops=1; }
+        folded=layer_fold(nn,l,minimums,maximums,a,b);
+        emit_arrays(f,prefix,l,folded,m,n);
+        free(folded);
+    }
+
+    // The descaling of the output signals of a curve
+    // fitting network,y*scale+offset per output signal.
+    if (type==DATASET_PREDICT && minimums!=NULL && maximums!=NULL)
+    {
+        scales=(double *)malloc(outputs*sizeof(double ));
+        offsets=(double *)malloc(outputs*sizeof(double ));
+        assert(scales!=NULL && offsets!=NULL);
+        for (j=0;j<outputs;j++)
+        {
+            min=gsl_vector_get(minimums,(size_t )config->signals+j);
+            max=gsl_vector_get(maximums,(size_t )config->signals+j);
+            scales[j]=(max-min)/a; offsets[j]=b*(max-min)/a+min;
+        }
+        fprintf(f,"static const double %s_scales[%zu]={ ",prefix,outputs);
+        for (j=0;j<outputs;j++) { fprintf(f,"%.17g%s",scales[j],j+1<outputs ? "," : ""); }
+        fprintf(f," };\nstatic const double %s_offsets[%zu]={ ",prefix,outputs);
+        for (j=0;j<outputs;j++) { fprintf(f,"%.17g%s",offsets[j],j+1<outputs ? "," : ""); }
+        fprintf(f," };\n\n");
+    }
+
+    fprintf(f,"static inline double %s_activate(double x)\n{\n",prefix);
+    if (config->atype==ACTIVATION_LGST)      { fprintf(f,"    return 1.0/(1.0+exp(-(%.17g*x+%.17g)));\n",config->alpha,config->beta); }
+    else if (config->atype==ACTIVATION_HTAN) { fprintf(f,"    double e=exp(-(%.17g*x+%.17g));\n    return (1.0-e)/(1.0+e);\n",config->alpha,config->beta); }
+    else                                     { fprintf(f,"    return %.17g*x+%.17g;\n",config->alpha,config->beta); }
+    fprintf(f,"}\n\n");
+
+    // The forward pass,the hidden layers writing into
+    // arrays of their own and the output layer into y.
+    fprintf(f,"void %s_predict(const double *restrict x,double *restrict y)\n{\n",prefix);
+    for (l=0;l<last;l++) { fprintf(f,"    double h%zu[%lld];\n",l,config->neurons[l]); }
+    if (loops) { fprintf(f,"    size_t j,i; double s;\n"); }
+    fprintf(f,"\n");
+    for (l=0;l<=last;l++)
+    {
+        m=(size_t )config->neurons[l];
+        n=(size_t )(l==0 ? config->signals : config->neurons[l-1]+1)-1;
+        if (l==0) { snprintf(in,sizeof(in),"x"); }
+        else      { snprintf(in,sizeof(in),"h%zu",l-1); }
+        if (l==last) { snprintf(out,sizeof(out),"y"); }
+        else         { snprintf(out,sizeof(out),"h%zu",l); }
+        emit_layer(f,prefix,l,m,n,in,out,l==last && scales!=NULL);
+    }
+    fprintf(f,"    return;\n}\n");
+
+    if (type==DATASET_CLASSIFY)
+    {
+        fprintf(f,"\nsize_t %s_classify(const double *restrict x)\n{\n",prefix);
+        fprintf(f,"    double y[%zu]; size_t j,best=0;\n",outputs);
+        fprintf(f,"    %s_predict(x,y);\n",prefix);
+        fprintf(f,"    for (j=1;j<%zu;j++) { if (y[j]>y[best]) { best=j; } }\n",outputs);
+        fprintf(f,"    return best;\n}\n");
+    }
+    free(scales); free(offsets);
+    return;
+}
@@ -0,0 +1,532 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the single
+ * precision training and predicting of
+ * the neural network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the string
+ * manipulation library,the header file
+ * "neural_float.h" that contains function
+ * prototypings regarding the single precision
+ * procedures,the header file "profiler.h" for
+ * the per-layer profiling hooks and the sse
+ * intrinsics for the floating point control.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "neural_float.h"
+#include "profiler.h"
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the given matrix.
+ *
+ * The function neural_float_narrow() takes a double matrix as
+ * argument and returns a newly allocated float copy of it.The
+ * caller has to release it with gsl_matrix_float_free().
+ *
+ * @param:  gsl_matrix          *m
+ * @return: gsl_matrix_float    *
+ *
+ */
+
+gsl_matrix_float *neural_float_narrow(gsl_matrix *m)
+{
+    size_t i,j; gsl_matrix_float *single=NULL;
+    assert(m!=NULL);
+    single=gsl_matrix_float_alloc(m->size1,m->size2);
+    assert(single!=NULL);
+    for (i=0;i<m->size1;i++)
+    {
+        for (j=0;j<m->size2;j++) { single->data[i*single->tda+j]=(float )gsl_matrix_get(m,i,j); }
+    } return single;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers
+ *                          in the neural network and ( m x n )
+ *                          the dimensions of the largest synaptic
+ *                          weights matrix.
+ *
+ * The function neural_float_forward() is the single precision
+ * counterpart of forward_propagate().It takes a neural network
+ * and a contiguous array of float input signals that starts with
+ * the bias value and propagates them layer by layer up to the
+ * output signals of the output layer.The linear aggregators are
+ * summed up in doubles and rounded to floats once per neuron.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  const float     *x
+ * @return: void
+ *
+ */
+
+void neural_float_forward(neural_net_t *nn,const float *x)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t i,j,l,s; double sum,temp,value;
+    const float *in=NULL,*row=NULL; uint64_t t;
+    gsl_matrix_float *W=NULL,*I=NULL,*Y=NULL;
+    assert(nn!=NULL && x!=NULL);
+
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        // Retrieving the matrices of the current layer and the
+        // input signals,which are the given ones at the first
+        // layer and the output signals of the previous layer
+        // otherwise.The column matrices of the arena are laid
+        // out with unit stride.
+        t=profiler_begin();
+        W=neural_layer_getW_float(nn->layers[l]);
+        I=neural_layer_getI_float(nn->layers[l]);
+        Y=neural_layer_getY_float(nn->layers[l]);
+        in=(l==0 ? x : neural_layer_getY_float(nn->layers[l-1])->data);
+
+        // Calculating the linear aggregator and the output
+        // signal of every neuron.The output signals of a
+        // hidden layer are shifted by one cell to make room
+        // for the bias factor.
+        for (i=0;i<W->size1;i++)
+        {
+            sum=0.0; row=W->data+i*W->tda;
+            for (j=0;j<W->size2;j++) { sum+=(double )row[j]*(double )in[j]; }
+            I->data[i*I->tda]=(float )sum; temp=(double )I->data[i*I->tda];
+            value=nn->config->activate(&temp,&nn->config->alpha,&nn->config->beta);
+            s=(nn->config->nlayers==l+1 ? i : i+1);
+            Y->data[s*Y->tda]=(float )value;
+        }
+        if (nn->config->nlayers>l+1) { Y->data[0]=-1.0f; }
+        profiler_end(PROFILE_FORWARD,l,t,(W->size1*W->size2+W->size2+2*W->size1)*sizeof(float ));
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers
+ *                          in the neural network and ( m x n )
+ *                          the dimensions of the largest synaptic
+ *                          weights matrix.
+ *
+ * The function neural_float_activate() narrows the given double
+ * input signals into the float input of the network,propagates
+ * them and widens the output signals into the double output matrix
+ * of the network,which is returned.Like neural_net_activate() the
+ * returned matrix belongs to the network.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  gsl_vector      *signals
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_float_activate(neural_net_t *nn,gsl_vector *signals)
+{
+    size_t j; gsl_matrix_float *Y=NULL;
+    assert(nn!=NULL && signals!=NULL && nn->input!=NULL);
+    assert(signals->size>=(size_t )nn->config->signals);
+    for (j=0;j<(size_t )nn->config->signals;j++) { nn->input[j]=(float )gsl_vector_get(signals,j); }
+    neural_float_forward(nn,nn->input);
+    Y=neural_layer_getY_float(nn->layers[nn->config->nlayers-1]);
+    for (j=0;j<Y->size1;j++) { gsl_matrix_set(&nn->output.matrix,j,0,(double )Y->data[j*Y->tda]); }
+    return &nn->output.matrix;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers
+ *                          in the neural network and ( m x n )
+ *                          the dimensions of the largest synaptic
+ *                          weights matrix.
+ *
+ * The static function backward_propagate() is the single precision
+ * counterpart of the double one in neural_utils.c.It computes the
+ * local gradients of every layer,from the output layer down to the
+ * first one,and adjusts the synaptic weights with the same formulas
+ * and in the same order:
+ *
+ *      delta(j) = ( target(j) - Y(j) ) * g'(I(j))                   ( output layer )
+ *      delta(j) = Sum ( posterior_W(k,j+1) * posterior_delta(k) ) * g'(I(j))
+ *      V(j,i) = momentum * V(j,i) + hta * delta(j) * Y(i),W(j,i) = W(j,i) + V(j,i)
+ *
+ * The first column of the posterior weights belongs to the bias
+ * factor,so the jth neuron feeds the column j+1.Without momentum
+ * the velocity is left out and the shift is added to the weights
+ * directly.
+ *
+ */
+
+static void backward_propagate(neural_net_t *nn,const float *x,const float *target)
+{
+    // Variable declarations
+    // and default values.
+    llint l; size_t i,j,k; uint64_t t;
+    double value,ij; const float *y=NULL;
+    float *d,*row,*w,*v,dk,scale;
+    float eta=(float )nn->config->eta,momentum=(float )nn->config->momentum;
+    gsl_matrix_float *W=NULL,*I=NULL,*Y=NULL,*D=NULL,*V=NULL;
+    gsl_matrix_float *postW=NULL,*postD=NULL;
+
+    for (l=nn->config->nlayers-1;l>=0;l--)
+    {
+        // Retrieving the matrices of the current layer and
+        // its input signals.
+        W=neural_layer_getW_float(nn->layers[l]);
+        I=neural_layer_getI_float(nn->layers[l]);
+        Y=neural_layer_getY_float(nn->layers[l]);
+        D=neural_layer_getD_float(nn->layers[l]);
+        V=neural_layer_getV_float(nn->layers[l]);
+        y=(l>0 ? neural_layer_getY_float(nn->layers[l-1])->data : x);
+        t=profiler_begin(); d=D->data;
+
+        // The local gradients of the output layer come from the
+        // desired output signals,the ones of the hidden layers
+        // are accumulated row by row over the posterior weights.
+        if (l+1==nn->config->nlayers)
+        {
+            for (j=0;j<D->size1;j++)
+            {
+                ij=(double )I->data[j*I->tda];
+                value=nn->config->derivative(&ij,&nn->config->alpha,&nn->config->beta);
+                d[j*D->tda]=(float )(((double )target[j]-(double )Y->data[j*Y->tda])*value);
+            }
+            profiler_end(PROFILE_DELTA,l,t,4*D->size1*sizeof(float ));
+        }
+        else
+        {
+            postW=neural_layer_getW_float(nn->layers[l+1]);
+            postD=neural_layer_getD_float(nn->layers[l+1]);
+            for (j=0;j<D->size1;j++) { d[j*D->tda]=0.0f; }
+            for (k=0;k<postW->size1;k++)
+            {
+                dk=postD->data[k*postD->tda];
+                row=postW->data+k*postW->tda+1;
+                for (j=0;j<D->size1;j++) { d[j*D->tda]+=row[j]*dk; }
+            }
+            for (j=0;j<D->size1;j++)
+            {
+                ij=(double )I->data[j*I->tda];
+                value=nn->config->derivative(&ij,&nn->config->alpha,&nn->config->beta);
+                d[j*D->tda]=(float )((double )d[j*D->tda]*value);
+            }
+            profiler_end(PROFILE_DELTA,l,t,(postW->size1*D->size1+postW->size1+2*D->size1)*sizeof(float ));
+        }
+
+        // Adjusting the synaptic weights in a single streaming
+        // pass per row,with or without the velocity.
+        t=profiler_begin();
+        if (V!=NULL)
+        {
+            for (j=0;j<W->size1;j++)
+            {
+                scale=eta*d[j*D->tda];
+                w=W->data+j*W->tda; v=V->data+j*V->tda;
+                for (i=0;i<W->size2;i++) { v[i]=momentum*v[i]+scale*y[i]; w[i]+=v[i]; }
+            }
+            profiler_end(PROFILE_UPDATE,l,t,(4*W->size1*W->size2+W->size1+W->size2)*sizeof(float ));
+        }
+        else
+        {
+            for (j=0;j<W->size1;j++)
+            {
+                scale=eta*d[j*D->tda];
+                w=W->data+j*W->tda;
+                for (i=0;i<W->size2;i++) { w[i]+=scale*y[i]; }
+            }
+            profiler_end(PROFILE_UPDATE,l,t,(2*W->size1*W->size2+W->size1+W->size2)*sizeof(float ));
+        }
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*n)      Where l is the number of layers and n
+ *                          the number of neurons of the widest layer.
+ *
+ * The static function gradient_calculate() is the single precision
+ * counterpart of the double one in neural_utils.c and returns the
+ * squared norm of the gradient of the last backward propagation.
+ *
+ */
+
+static double gradient_calculate(neural_net_t *nn,const float *x)
+{
+    size_t l,j; double value,dd,yy,total=0.0;
+    gsl_matrix_float *W=NULL,*D=NULL; const float *y=NULL;
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        W=neural_layer_getW_float(nn->layers[l]);
+        D=neural_layer_getD_float(nn->layers[l]);
+        y=(l>0 ? neural_layer_getY_float(nn->layers[l-1])->data : x);
+        dd=0.0; yy=0.0;
+        for (j=0;j<W->size1;j++) { value=(double )D->data[j*D->tda]; dd+=value*value; }
+        for (j=0;j<W->size2;j++) { value=(double )y[j]; yy+=value*value; }
+        total+=dd*yy;
+    } return total;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows in the
+ *                              training view,l the number of layers
+ *                              and ( m x n ) the dimensions of the
+ *                              largest synaptic weights matrix.
+ *
+ * The function neural_float_epoch() trains a single precision network
+ * for one epoch over the rows of the given float dataset listed in the
+ * index array of the training session,or over every row when it is NULL.
+ * Every row holds the input signals followed by the desired output signals.
+ * The row function of the session is invoked after every row and,if asked
+ * for,the squared gradient norms of the rows are summed up and returned.
+ *
+ * @param:  neural_net_t        *nn
+ * @param:  gsl_matrix_float    *data
+ * @param:  training_session_t  *ts
+ * @return: double
+ *
+ */
+
+double neural_float_epoch(neural_net_t *nn,gsl_matrix_float *data,training_session_t *ts)
+{
+    size_t i,r; const float *x=NULL; double gradient=0.0;
+#ifdef __SSE__
+    unsigned int csr=_mm_getcsr();
+#endif
+    assert(nn!=NULL && data!=NULL && ts!=NULL);
+
+    // The velocities decay by the momentum on every row and
+    // soon fall below the smallest normal float,where every
+    // operation takes a slow microcode path.They are flushed
+    // to zero for the epoch instead,in the calling thread only.
+#ifdef __SSE__
+    _mm_setcsr(csr|0x8040);
+#endif
+    for (i=0;i<ts->rows;i++)
+    {
+        r=(ts->index==NULL ? i : ts->index[i]);
+        x=data->data+r*data->tda;
+        neural_float_forward(nn,x);
+        backward_propagate(nn,x,x+nn->config->signals);
+        if (ts->on_row!=NULL) { ts->on_row(nn,ts,ts->row_arg); }
+        if (ts->gradients) { gradient+=gradient_calculate(nn,x); }
+    }
+#ifdef __SSE__
+    _mm_setcsr(csr);
+#endif
+    return gradient;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*n)      Where r is the number of rows in the
+ *                          training view and n the number of
+ *                          desired output signals.
+ *
+ * The function neural_float_error() is the single precision
+ * counterpart of view_error_calculate().It evaluates the same
+ * squared error expression,summed up in doubles,over the rows
+ * listed in the index array or over every row when it is NULL.
+ *
+ * @param:  neural_net_t        *nn
+ * @param:  gsl_matrix_float    *data
+ * @param:  size_t              *index
+ * @param:  size_t              rows
+ * @return: double
+ *
+ */
+
+double neural_float_error(neural_net_t *nn,gsl_matrix_float *data,size_t *index,size_t rows)
+{
+    size_t i,j,r,s,n; double di,yi,sum,total_error=0.0;
+    gsl_matrix_float *Y=NULL; uint64_t t=profiler_begin();
+    assert(nn!=NULL && data!=NULL && rows>0);
+    Y=neural_layer_getY_float(nn->layers[nn->config->nlayers-1]);
+    s=nn->config->signals; n=data->size2-s;
+    for (i=0;i<rows;i++)
+    {
+        r=(index==NULL ? i : index[i]); sum=0.0;
+        for (j=0;j<n;j++)
+        {
+            di=(double )data->data[r*data->tda+s+j];
+            yi=(double )Y->data[j*Y->tda];
+            sum+=(di-yi)*(di-yi);
+        } total_error+=sum/2.0;
+    }
+    profiler_end(PROFILE_ERROR,0,t,rows*n*sizeof(float ));
+    return total_error/(double )rows;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_float_to_half() narrows a float into an IEEE
+ * fp16 value,rounding to the nearest even one.Values beyond the range
+ * of fp16 become infinities,values below it subnormals or zeros,and
+ * not-a-number stays one.
+ *
+ * @param:  float       value
+ * @return: uint16_t
+ *
+ */
+
+uint16_t neural_float_to_half(float value)
+{
+    // The magic float adds the value to 0.5 in the units of
+    // the smallest fp16 subnormal,so that the hardware rounds
+    // the mantissa of a subnormal result to the nearest even.
+    uint32_t x,sign,odd,magic=(uint32_t )((127-15)+(23-10)+1)<<23;
+    float f,m; uint16_t half;
+    memcpy(&x,&value,sizeof(x));
+    sign=x&0x80000000u; x^=sign;
+
+    if (x>=(uint32_t )(127+16)<<23) { half=(x>0x7f800000u ? 0x7e00 : 0x7c00); }
+    else if (x<(uint32_t )113<<23)
+    {
+        memcpy(&f,&x,sizeof(f)); memcpy(&m,&magic,sizeof(m));
+        f+=m; memcpy(&x,&f,sizeof(x));
+        half=(uint16_t )(x-magic);
+    }
+    else
+    {
+        odd=(x>>13)&1;
+        x+=((uint32_t )(15-127)<<23)+0xfff+odd;
+        half=(uint16_t )(x>>13);
+    } return (uint16_t )(half|(sign>>16));
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_float_from_half() widens an IEEE fp16 value into
+ * the float of the same value.Every fp16 value is exactly a float.
+ *
+ * @param:  uint16_t    half
+ * @return: float
+ *
+ */
+
+float neural_float_from_half(uint16_t half)
+{
+    uint32_t x=((uint32_t )half&0x7fff)<<13,exponent=x&(0x7c00u<<13);
+    uint32_t magic=(uint32_t )113<<23; float f,m;
+    x+=(uint32_t )(127-15)<<23;
+    if (exponent==0x7c00u<<13) { x+=(uint32_t )(128-16)<<23; }
+    else if (exponent==0)
+    {
+        x+=1u<<23; memcpy(&f,&x,sizeof(f)); memcpy(&m,&magic,sizeof(m));
+        f-=m; memcpy(&x,&f,sizeof(x));
+    }
+    x|=((uint32_t )half&0x8000)<<16;
+    memcpy(&f,&x,sizeof(f)); return f;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_float_to_bfloat() narrows a float into a bf16
+ * value,the upper half of its bits,rounding to the nearest even one.
+ * Not-a-number is kept quiet so that rounding never turns it into an
+ * infinity.
+ *
+ * @param:  float       value
+ * @return: uint16_t
+ *
+ */
+
+uint16_t neural_float_to_bfloat(float value)
+{
+    uint32_t x; memcpy(&x,&value,sizeof(x));
+    if ((x&0x7fffffffu)>0x7f800000u) { return (uint16_t )((x>>16)|0x40); }
+    x+=0x7fff+((x>>16)&1);
+    return (uint16_t )(x>>16);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_float_from_bfloat() widens a bf16 value into
+ * the float of the same value.
+ *
+ * @param:  uint16_t    half
+ * @return: float
+ *
+ */
+
+float neural_float_from_bfloat(uint16_t half)
+{
+    uint32_t x=(uint32_t )half<<16; float f;
+    memcpy(&f,&x,sizeof(f)); return f;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of widened values.
+ *
+ * The function neural_float_widen() widens the given number of fp16
+ * or bf16 values,as the given storage format tells,into doubles.It
+ * serves the engines that keep the weights in half precision and
+ * widen a few rows of them at a time,which the conversions above are
+ * inlined into.
+ *
+ * @param:  int             storage
+ * @param:  const uint16_t  *half
+ * @param:  size_t          n
+ * @param:  double          *w
+ * @return: void
+ *
+ */
+
+void neural_float_widen(int storage,const uint16_t *restrict half,size_t n,double *restrict w)
+{
+    size_t i;
+    if (storage==STORAGE_FP16) { for (i=0;i<n;i++) { w[i]=(double )neural_float_from_half(half[i]); } return; }
+    for (i=0;i<n;i++) { w[i]=(double )neural_float_from_bfloat(half[i]); }
+    return;
+}
@@ -0,0 +1,251 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * cache-blocked matrix multiply that
+ * serves the batched forward propagation.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the string
+ * manipulation library and the header file
+ * "neural_gemm.h" that contains datatype
+ * definitions and function prototypings
+ * regarding the matrix multiply.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "neural_gemm.h"
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function gemm_alloc() returns a block of the given
+ * number of doubles that starts on a cache line,or aborts if
+ * there is not enough memory for it.
+ *
+ */
+
+static double *gemm_alloc(size_t n)
+{
+    void *p=NULL;
+    if (posix_memalign(&p,64,(n>0 ? n : 1)*sizeof(double ))!=0) { p=NULL; }
+    assert(p!=NULL); return (double *)p;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the synaptic weights matrix.
+ *
+ * The function neural_gemm_pack() takes a synaptic weights matrix
+ * of the given number of neurons and weights per neuron,whose rows
+ * are the given number of doubles apart,and returns a newly allocated
+ * copy of it packed into panels of GEMM_NR neurons.The weights only
+ * have to be packed again once they have been changed.
+ *
+ * @param:  const double    *W
+ * @param:  size_t          neurons
+ * @param:  size_t          weights
+ * @param:  size_t          tda
+ * @return: gemm_panels_t   *
+ *
+ */
+
+gemm_panels_t *neural_gemm_pack(const double *W,size_t neurons,size_t weights,size_t tda)
+{
+    size_t p,j,k,r; double *panel=NULL;
+    gemm_panels_t *P=NULL;
+    assert(W!=NULL && tda>=weights);
+    P=(gemm_panels_t *)malloc(sizeof(*P)); assert(P!=NULL);
+    P->neurons=neurons; P->weights=weights;
+    P->panels=(neurons+GEMM_NR-1)/GEMM_NR;
+    P->data=gemm_alloc(P->panels*GEMM_NR*weights);
+    for (p=0;p<P->panels;p++)
+    {
+        panel=P->data+p*GEMM_NR*weights;
+        for (k=0;k<weights;k++)
+        {
+            for (j=0;j<GEMM_NR;j++)
+            {
+                r=p*GEMM_NR+j;
+                panel[k*GEMM_NR+j]=(r<neurons ? W[r*tda+k] : 0.0);
+            }
+        }
+    } return P;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*k)  Where m is the number of rows and k
+ *                      the number of signals of the block.
+ *
+ * The static function block_pack() copies a block of the given
+ * rows and signals of the input signals into the given buffer,in
+ * strips of GEMM_MR rows whose signals are interleaved the same way
+ * as the weights of a panel.The last strip is padded with zeros.
+ *
+ */
+
+static void block_pack(const double *X,size_t ldx,size_t rows,size_t signals,double *buffer)
+{
+    size_t s,i,k; double *strip=NULL;
+    for (s=0;s<rows;s+=GEMM_MR)
+    {
+        strip=buffer+s*signals;
+        for (k=0;k<signals;k++)
+        {
+            for (i=0;i<GEMM_MR;i++)
+            {
+                strip[k*GEMM_MR+i]=(s+i<rows ? X[(s+i)*ldx+k] : 0.0);
+            }
+        }
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(k)    Where k is the number of signals
+ *                          of the pass.
+ *
+ * The static function gemm_kernel() accumulates a tile of GEMM_MR
+ * rows by GEMM_NR neurons over the given number of signals,reading
+ * a strip of packed input signals and a panel of packed weights.The
+ * tile is held in sixteen registers,it starts from zero on the first
+ * pass and from the cells of the output on the rest,so every cell still
+ * adds up its terms one after the other,in the order of the signals.Only
+ * the given number of rows and neurons of the tile are stored.
+ *
+ */
+
+static void gemm_kernel(size_t kc,const double *restrict a,const double *restrict b,double *restrict c,size_t ldc,size_t mr,size_t nr,int first)
+{
+    size_t i,j,k; double t[GEMM_MR][GEMM_NR];
+    double c00,c01,c02,c03,c10,c11,c12,c13;
+    double c20,c21,c22,c23,c30,c31,c32,c33;
+    double a0,a1,a2,a3,b0,b1,b2,b3;
+
+    for (i=0;i<GEMM_MR;i++)
+    {
+        for (j=0;j<GEMM_NR;j++) { t[i][j]=(!first && i<mr && j<nr ? c[i*ldc+j] : 0.0); }
+    }
+    c00=t[0][0]; c01=t[0][1]; c02=t[0][2]; c03=t[0][3];
+    c10=t[1][0]; c11=t[1][1]; c12=t[1][2]; c13=t[1][3];
+    c20=t[2][0]; c21=t[2][1]; c22=t[2][2]; c23=t[2][3];
+    c30=t[3][0]; c31=t[3][1]; c32=t[3][2]; c33=t[3][3];
+    for (k=0;k<kc;k++,a+=GEMM_MR,b+=GEMM_NR)
+    {
+        a0=a[0]; a1=a[1]; a2=a[2]; a3=a[3];
+        b0=b[0]; b1=b[1]; b2=b[2]; b3=b[3];
+        c00+=a0*b0; c01+=a0*b1; c02+=a0*b2; c03+=a0*b3;
+        c10+=a1*b0; c11+=a1*b1; c12+=a1*b2; c13+=a1*b3;
+        c20+=a2*b0; c21+=a2*b1; c22+=a2*b2; c23+=a2*b3;
+        c30+=a3*b0; c31+=a3*b1; c32+=a3*b2; c33+=a3*b3;
+    }
+    t[0][0]=c00; t[0][1]=c01; t[0][2]=c02; t[0][3]=c03;
+    t[1][0]=c10; t[1][1]=c11; t[1][2]=c12; t[1][3]=c13;
+    t[2][0]=c20; t[2][1]=c21; t[2][2]=c22; t[2][3]=c23;
+    t[3][0]=c30; t[3][1]=c31; t[3][2]=c32; t[3][3]=c33;
+    for (i=0;i<mr;i++)
+    {
+        for (j=0;j<nr;j++) { c[i*ldc+j]=t[i][j]; }
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*m*n)    Where r is the number of rows and ( m x n )
+ *                          the dimensions of the synaptic weights matrix.
+ *
+ * The function neural_gemm() multiplies the given rows of input signals,
+ * which are the given number of doubles apart,by the transpose of the
+ * packed synaptic weights and stores the linear aggregator of every row
+ * and neuron into the output,whose rows are ldc doubles apart.The signals
+ * are consumed GEMM_KC at a time and for each such pass the rows are packed
+ * GEMM_MC at a time and multiplied by every panel.Every linear aggregator
+ * is the same sum,added up in the same order,as the one of a dot product
+ * of the row with the weights of the neuron.
+ *
+ * @param:  const double    *X
+ * @param:  size_t          rows
+ * @param:  size_t          ldx
+ * @param:  gemm_panels_t   *P
+ * @param:  double          *C
+ * @param:  size_t          ldc
+ * @return: void
+ *
+ */
+
+void neural_gemm(const double *X,size_t rows,size_t ldx,gemm_panels_t *P,double *C,size_t ldc)
+{
+    // Variable declarations,type assertions
+    // and the buffer of a packed block.
+    size_t k0,i0,kc,mc,p,s,nr; double *buffer=NULL;
+    assert(X!=NULL && P!=NULL && C!=NULL && ldc>=P->neurons);
+    buffer=gemm_alloc(GEMM_MC*GEMM_KC);
+
+    for (k0=0;k0<P->weights;k0+=GEMM_KC)
+    {
+        kc=(P->weights-k0<GEMM_KC ? P->weights-k0 : GEMM_KC);
+        for (i0=0;i0<rows;i0+=GEMM_MC)
+        {
+            // Packing the block of rows for the current
+            // pass and sweeping every panel over it,one
+            // register tile at a time.
+            mc=(rows-i0<GEMM_MC ? rows-i0 : GEMM_MC);
+            block_pack(X+i0*ldx+k0,ldx,mc,kc,buffer);
+            for (p=0;p<P->panels;p++)
+            {
+                nr=P->neurons-p*GEMM_NR; if (nr>GEMM_NR) { nr=GEMM_NR; }
+                for (s=0;s<mc;s+=GEMM_MR)
+                {
+                    gemm_kernel(kc,buffer+s*kc,P->data+p*GEMM_NR*P->weights+k0*GEMM_NR,
+                                C+(i0+s)*ldc+p*GEMM_NR,ldc,(mc-s<GEMM_MR ? mc-s : GEMM_MR),nr,k0==0);
+                }
+            }
+        }
+    }
+    free(buffer); return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_gemm_free() deallocates
+ * the given packed synaptic weights.
+ *
+ * @param:  gemm_panels_t   *P
+ * @return: void
+ *
+ */
+
+void neural_gemm_free(gemm_panels_t *P)
+{
+    if (P==NULL) { return; }
+    free(P->data); free(P);
+    return;
+}
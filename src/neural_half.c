@@ -0,0 +1,357 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the half
+ * precision inference engine of the
+ * neural network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard input-output library,
+ * the standard utilities library,the standard
+ * assertions library,the string manipulation
+ * library,the header file "neural_half.h" that
+ * contains datatype definitions and function
+ * prototypings regarding the half precision
+ * network,the header file "neural_float.h" for
+ * the half precision conversions,the header file
+ * "neural_backend.h" for the compute kernels and
+ * the header file "profiler.h" for the per-layer
+ * profiling hooks.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "neural_half.h"
+#include "neural_float.h"
+#include "neural_backend.h"
+#include "profiler.h"
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The static function half_format() takes a configuration and the
+ * weights file saved with it and returns STORAGE_FP16 or STORAGE_BF16
+ * if the file holds one half precision value per synaptic weight of
+ * the configuration behind the four bytes of its format,and zero
+ * otherwise.The stream is left at the first weight.
+ *
+ */
+
+static int half_format(neural_config_t *config,FILE *f)
+{
+    llint l; size_t cells=0; long bytes; char tag[4];
+    for (l=0;l<config->nlayers;l++)
+    {
+        cells+=(size_t )config->neurons[l]*(size_t )(l==0 ? config->signals : config->neurons[l-1]+1);
+    }
+    fseek(f,0,SEEK_END); bytes=ftell(f); rewind(f);
+    if (bytes!=(long )(cells*sizeof(uint16_t )+4) || fread(tag,sizeof(char ),4,f)!=4) { return 0; }
+    if (memcmp(tag,"FP16",4)==0) { return STORAGE_FP16; }
+    if (memcmp(tag,"BF16",4)==0) { return STORAGE_BF16; }
+    return 0;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The static function half_alloc() allocates a half precision network
+ * for the given configuration.The weights of every layer are laid out
+ * in a single 64-byte aligned block,each layer starting on a cache line
+ * of its own.The tile holds HALF_TILE widened weights or a whole row of
+ * the widest layer,the buffers a batch of output signals of any layer.
+ *
+ */
+
+static neural_half_t *half_alloc(neural_config_t *config,int storage)
+{
+    neural_half_t *nh=NULL; llint l;
+    size_t size=0,cells,tile=HALF_TILE,width;
+    char *block=NULL; void *arena=NULL;
+
+    nh=(neural_half_t *)malloc(sizeof(*nh));
+    assert(nh!=NULL); nh->config=config; nh->storage=storage;
+    nh->layers=(half_layer_t *)malloc(config->nlayers*sizeof(half_layer_t ));
+    assert(nh->layers!=NULL);
+
+    // Measuring the block,the tile and the buffers,
+    // which hold the input signals of the first layer
+    // when a single row is not contiguous.
+    width=(size_t )config->signals;
+    for (l=0;l<config->nlayers;l++)
+    {
+        nh->layers[l].rows=config->neurons[l];
+        nh->layers[l].columns=(l==0 ? config->signals : config->neurons[l-1]+1);
+        cells=(size_t )(nh->layers[l].rows*nh->layers[l].columns)*sizeof(uint16_t );
+        size+=(cells+NEURAL_NET_ALIGN-1)/NEURAL_NET_ALIGN*NEURAL_NET_ALIGN;
+        if ((size_t )nh->layers[l].columns>tile) { tile=(size_t )nh->layers[l].columns; }
+        if ((size_t )nh->layers[l].rows+1>width) { width=(size_t )nh->layers[l].rows+1; }
+    }
+    if (posix_memalign(&arena,NEURAL_NET_ALIGN,size)!=0) { arena=NULL; }
+    assert(arena!=NULL); block=(char *)arena;
+
+    for (l=0;l<config->nlayers;l++)
+    {
+        cells=(size_t )(nh->layers[l].rows*nh->layers[l].columns)*sizeof(uint16_t );
+        nh->layers[l].H=(uint16_t *)block;
+        block+=(cells+NEURAL_NET_ALIGN-1)/NEURAL_NET_ALIGN*NEURAL_NET_ALIGN;
+    }
+
+    nh->tile=(double *)malloc(tile*sizeof(double ));
+    nh->buffer[0]=(double *)malloc(NEURAL_BATCH_ROWS*width*sizeof(double ));
+    nh->buffer[1]=(double *)malloc(NEURAL_BATCH_ROWS*width*sizeof(double ));
+    nh->output=gsl_matrix_alloc(config->neurons[config->nlayers-1],1);
+    assert(nh->tile!=NULL && nh->buffer[0]!=NULL && nh->buffer[1]!=NULL && nh->output!=NULL);
+    return nh;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The static function half_propagate() is the forward pass of a batch
+ * of at most NEURAL_BATCH_ROWS rows.Every layer is cut into tiles of
+ * whole rows of weights,each one widened into doubles and multiplied
+ * with the batch by the matrix multiply of the backend before the next
+ * one is widened,so the weights are streamed from memory in two bytes
+ * once per batch.A batch of a single row is multiplied by the matrix
+ * vector product of the backend instead.The output signals of a hidden
+ * layer are left in one of the buffers after a bias column,those of the
+ * output layer in the given rows.On the default backend every linear
+ * aggregator is the same sum as in the forward pass of a double precision
+ * network that has loaded the same weights,so are the results.
+ *
+ */
+
+static void half_propagate(neural_half_t *nh,const double *in,size_t ldx,size_t rows,double *out,size_t ldo)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,i,j,m,n,tm,tr,ldc,last;
+    double *y=NULL,*c=NULL; half_layer_t *hl=NULL; uint64_t t;
+    assert(rows<=NEURAL_BATCH_ROWS);
+    last=(size_t )nh->config->nlayers-1;
+
+    for (l=0;l<=last;l++)
+    {
+        t=profiler_begin(); hl=&nh->layers[l];
+        m=(size_t )hl->rows; n=(size_t )hl->columns;
+        if (l<last) { y=nh->buffer[l%2]; c=y+1; ldc=m+1; }
+        else        { y=NULL; c=out; ldc=ldo; }
+
+        // Widening a tile of rows of weights at a time
+        // and multiplying it with the whole batch into
+        // the columns of the output signals it feeds,a
+        // single row with the matrix-vector product.
+        tm=(n<HALF_TILE ? HALF_TILE/n : 1);
+        for (j=0;j<m;j+=tr)
+        {
+            tr=(m-j<tm ? m-j : tm);
+            neural_float_widen(nh->storage,hl->H+j*n,tr*n,nh->tile);
+            if (rows==1) { neural_backend.gemv(tr,n,nh->tile,n,in,1,c+j); }
+            else         { neural_backend.gemm(rows,tr,n,in,ldx,nh->tile,n,c+j,ldc,NULL); }
+        }
+        for (i=0;i<rows;i++)
+        {
+            neural_backend.apply(nh->config,m,c+i*ldc,c+i*ldc);
+            if (y!=NULL) { y[i*ldc]=-1.0; }
+        }
+        profiler_end(PROFILE_FORWARD,l,t,m*n*sizeof(uint16_t )+rows*(n+m)*sizeof(double ));
+        in=y; ldx=ldc;
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_half_activate() is the half precision counterpart
+ * of neural_net_activate().The given row is propagated as a batch of one
+ * and the returned matrix holds the output signals and belongs to the
+ * network.
+ *
+ * @param:  neural_half_t   *nh
+ * @param:  gsl_vector      *signals
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_half_activate(neural_half_t *nh,gsl_vector *signals)
+{
+    size_t i,n; double *x=NULL;
+    assert(nh!=NULL && signals!=NULL);
+    assert(signals->size>=(size_t )nh->config->signals);
+    n=(size_t )nh->config->signals; x=signals->data;
+
+    // The first layer writes into the first buffer
+    // only,the second one gathers a strided row.
+    if (signals->stride!=1)
+    {
+        x=nh->buffer[1];
+        for (i=0;i<n;i++) { x[i]=gsl_vector_get(signals,i); }
+    }
+    half_propagate(nh,x,n,1,nh->output->data,nh->output->tda);
+    return nh->output;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function neural_half_predict() is the half precision counterpart
+ * of neural_net_predict() and returns a newly allocated matrix that holds
+ * the output signals of every row of the given matrix.The rows are
+ * propagated NEURAL_BATCH_ROWS at a time.
+ *
+ * @param:  neural_half_t   *nh
+ * @param:  gsl_matrix      *data
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_half_predict(neural_half_t *nh,gsl_matrix *data)
+{
+    size_t r0,rows; gsl_matrix *results=NULL;
+    assert(nh!=NULL && data!=NULL);
+    results=gsl_matrix_alloc(data->size1,nh->output->size1);
+    assert(results!=NULL);
+    for (r0=0;r0<data->size1;r0+=NEURAL_BATCH_ROWS)
+    {
+        rows=(data->size1-r0<NEURAL_BATCH_ROWS ? data->size1-r0 : NEURAL_BATCH_ROWS);
+        half_propagate(nh,data->data+r0*data->tda,data->tda,rows,results->data+r0*results->tda,results->tda);
+    } return results;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_half_load() loads the configuration saved in
+ * the given directory into the given config data structure and the
+ * half precision weights saved next to it,without widening them.If
+ * the weights.bin file does not hold half precision weights for the
+ * configuration the program execution is terminated.
+ *
+ * @param:  neural_config_t     *config
+ * @param:  char                *directory
+ * @return: neural_half_t       *
+ *
+ */
+
+neural_half_t *neural_half_load(neural_config_t *config,char *directory)
+{
+    FILE *f=NULL; llint l; int storage,status=0;
+    char *filepath=NULL; neural_half_t *nh=NULL;
+    size_t cells;
+    assert(config!=NULL && directory!=NULL);
+
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"rb");
+    if (f==NULL) { fprintf(stderr,"Could not open %s.\n",filepath); exit(EXIT_FAILURE); }
+    neural_config_load(config,f);
+    fclose(f); free(filepath);
+
+    filepath=neural_net_path(directory,"/weights.bin");
+    f=fopen(filepath,"rb");
+    if (f==NULL) { fprintf(stderr,"Could not open %s.\n",filepath); exit(EXIT_FAILURE); }
+    storage=half_format(config,f);
+    if (storage==0) { fprintf(stderr,"The weights %s are not in half precision.\n",filepath); exit(EXIT_FAILURE); }
+    nh=half_alloc(config,storage);
+    for (l=0;status==0 && l<config->nlayers;l++)
+    {
+        cells=(size_t )(nh->layers[l].rows*nh->layers[l].columns);
+        status=(fread(nh->layers[l].H,sizeof(uint16_t ),cells,f)!=cells);
+    } fclose(f);
+    if (status) { fprintf(stderr,"The weights %s do not match their configuration.\n",filepath); exit(EXIT_FAILURE); }
+    free(filepath); return nh;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The function neural_half_exists() returns STORAGE_FP16 or STORAGE_BF16
+ * if the given directory holds a model whose weights have been saved in
+ * that half precision format and zero otherwise.
+ *
+ * @param:  char    *directory
+ * @return: int
+ *
+ */
+
+int neural_half_exists(char *directory)
+{
+    char *filepath=NULL; FILE *f=NULL;
+    neural_config_t config; int storage;
+    assert(directory!=NULL);
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"rb"); free(filepath);
+    if (f==NULL) { return 0; }
+    neural_config_load(&config,f); fclose(f);
+    filepath=neural_net_path(directory,"/weights.bin");
+    f=fopen(filepath,"rb"); free(filepath);
+    storage=(f!=NULL ? half_format(&config,f) : 0);
+    if (f!=NULL) { fclose(f); }
+    free(config.neurons); return storage;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_half_free() deallocates the half precision
+ * network.The configuration belongs to the caller and is left
+ * untouched.
+ *
+ * @param:  neural_half_t   *nh
+ * @return: void
+ *
+ */
+
+void neural_half_free(neural_half_t *nh)
+{
+    assert(nh!=NULL);
+    free(nh->layers[0].H);
+    free(nh->layers);
+    free(nh->tile);
+    free(nh->buffer[0]); free(nh->buffer[1]);
+    gsl_matrix_free(nh->output);
+    free(nh); return;
+}
@@ -13,8 +13,8 @@
 
 /*
  * Including the standard utilities library,
- * the standard assertions library,the standard
- * time manipulation library,the gnu matrix library,
+ * the standard assertions library,the string
+ * manipulation library,the gnu matrix library,
  * the gnu random number generation library and the
  * header file "neural_layer.h" that cotains datatype
  * definitions and function prototyping regarding the
@@ -24,7 +24,7 @@
 
 #include <stdlib.h>
 #include <assert.h>
-#include <time.h>
+#include <string.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_rng.h>
 #include "neural_layer.h"
@@ -32,112 +32,189 @@
 
 
 
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_layer_scratch() takes two arguments as
+ * parameters,namely the number of neurons of a layer and its
+ * type,and returns the number of cells the linear aggregators,
+ * the gradients and the output signals of the layer take up.
+ * The output signals of a hidden layer have an extra cell for
+ * the bias factor.
+ *
+ * @param:  llint       j
+ * @param:  int         layer_type
+ * @return: size_t
+ *
+ */
+
+size_t neural_layer_scratch(llint j,int layer_type)
+{
+    return 2*(size_t )j+(size_t )(layer_type==HIDDEN_NEURAL_LAYER ? j+1 : j);
+}
+
+
+
+
 /*
  * @COMPLEXITY: O(m*n) where  ( m x n ) are the dimensions
  *              of the weights matrix for the current layer.
  * 
- * The function neural_layer_create() takes three arguments
- * as parameters.The first argument is the number of neurons
- * the layer has.The second argument is the total number of
- * synaptic weights that are connected to each neuron in the
- * layer.The third argument is the type of the neural layer,
- * which can be either a hidden layer or an output layer.This
- * function instantiates an neural_layer_t data structure by
- * allocating memory for it and it's components.It returns a
- * newly created neural layer data structure.
+ * The function neural_layer_create() takes eight arguments
+ * as parameters.The first argument is the layer to set up.The
+ * second argument is the number of neurons the layer has.The
+ * third argument is the total number of synaptic weights that
+ * are connected to each neuron in the layer.The fourth argument
+ * is the type of the neural layer,which can be either a hidden
+ * layer or an output layer.The next three arguments point into
+ * the memory of the network,to room for the synaptic weights,
+ * for the velocity of the weights and for the scratch matrices
+ * of the layer respectively.The velocity is null when the network
+ * trains without momentum.The last argument is the seed of the
+ * random number generator.This function lays the matrices of the
+ * layer over that memory and fills the synaptic weights with random
+ * numbers,so the same seed always gives the same weights.The velocity
+ * starts as a copy of the weights,the shift the momentum term of the
+ * first update has always applied,since the weights of the previous
+ * epoch used to start from zero.
  *
+ * @param:  neural_layer_t      *nl
  * @param:  llint               j
  * @param:  llint               i
  * @param:  int                 layer_type
- * @return: neural_layer_t      *
+ * @param:  double              *weights
+ * @param:  double              *velocity
+ * @param:  double              *scratch
+ * @param:  unsigned long       seed
+ * @return: void
  *
  */
 
-neural_layer_t *neural_layer_create(llint j,llint i,int layer_type)
+void neural_layer_create(neural_layer_t *nl,llint j,llint i,int layer_type,double *weights,double *velocity,double *scratch,unsigned long seed)
 {
     // Variable declarations and
     // default instantiations.
-    size_t row,column,brow;
-    time_t seed; double random;
-    neural_layer_t *new_nl=NULL;
+    size_t row,column,brow; double random;
     gsl_rng *random_gen=NULL;
-
-
-    // Allocating memory for a new instance of
-    // the neural_layer_t data structure and
-    // checking whether allocation failed or not.
-    new_nl=(neural_layer_t *)malloc(sizeof(*new_nl));
-    assert(new_nl!=NULL);
+    assert(nl!=NULL && weights!=NULL && scratch!=NULL);
+    memset(nl,0,sizeof(*nl));
 
 
     // Creating a new gsl random number generator
-    // and seeding it using the time function.
+    // and seeding it with the given seed.
     random_gen=gsl_rng_alloc(gsl_rng_taus);
-    gsl_rng_set(random_gen,time(&seed));
+    gsl_rng_set(random_gen,seed);
 
     
-    // allocating a new matrix data structure that
-    // has j number of rows and i number of columns.
-    // the value of j represents the total number of
-    // neurons in the current layer, while the value
-    // of i represents the total number of synpatic
-    // weights connected to the jth neuron.
-    new_nl->W=gsl_matrix_alloc(j,i);
-
-
-    // allocating a new matrix data structure that
-    // has j number of rows and i number of columns.
-    // the value of j represents the total number of
-    // neurons in the current layer,while the value of
-    // i represents the total number of synaptic weights
-    // connected to the jth neuron.This matrix will contain
-    // the values of the synaptic weights from the previous
-    // training epoch.
-    new_nl->O=gsl_matrix_calloc(j,i);
+    // Laying a matrix that has j number of rows and i number
+    // of columns over the given weights.The value of j represents
+    // the total number of neurons in the current layer,while the
+    // value of i represents the total number of synpatic weights
+    // connected to the jth neuron.
+    nl->W=gsl_matrix_view_array(weights,j,i);
+
+
+    // Laying a matrix of the same dimensions over the given
+    // velocity,if any.This matrix will contain the last shift
+    // of the synaptic weights during the training process.
+    if (velocity!=NULL) { nl->V=gsl_matrix_view_array(velocity,j,i); }
     
 
-    // allocating a new matrix data structure that
-    // has j number of rows and one column.this matrix
-    // contains the linear aggregators for each neuron
+    // Laying the matrices that have j number of rows and one
+    // column over the scratch memory.They contain the linear
+    // aggregators and the gradient values for each neuron
     // in the current layer.
-    new_nl->I=gsl_matrix_calloc(j,1);
-
-    
-    // allocating a new matrix data structure that 
-    // has j number of rows and one column.This matrix
-    // contains the gradient values for each neuron
-    // in the current layer.
-    new_nl->D=gsl_matrix_calloc(j,1);
+    nl->I=gsl_matrix_view_array(scratch,j,1);
+    nl->D=gsl_matrix_view_array(scratch+j,j,1);
 
     
     // Depending on the type of the current layer
-    // we allcate a new matrix data structure that
-    // has brow number of rows and one column.This
-    // matrix contains the output signals for each
-    // neuron in the current layer.
+    // we lay a matrix that has brow number of rows
+    // and one column after them.This matrix contains
+    // the output signals for each neuron in the
+    // current layer.
     brow=(layer_type==HIDDEN_NEURAL_LAYER ? j+1 : j);
-    new_nl->Y=gsl_matrix_calloc(brow,1);
+    nl->Y=gsl_matrix_view_array(scratch+2*j,brow,1);
 
     
     // Popullating the cells of the weights matrix
     // with uniform random numbers between (0,1).
-    for (row=0;row<new_nl->W->size1;row++)
+    for (row=0;row<nl->W.matrix.size1;row++)
     {
-        for (column=0;column<new_nl->W->size2;column++)
+        for (column=0;column<nl->W.matrix.size2;column++)
         {
             random=gsl_rng_uniform_pos(random_gen);
-            gsl_matrix_set(new_nl->W,row,column,random);
+            gsl_matrix_set(&nl->W.matrix,row,column,random);
         }
     }
+    if (velocity!=NULL) { gsl_matrix_memcpy(&nl->V.matrix,&nl->W.matrix); }
     
 
 
-    // Deallocating memory for the random number
-    // generator and returning the newly created
-    // neural layer data structure.
+    // Deallocating memory for the random
+    // number generator.
     gsl_rng_free(random_gen);
     random_gen=NULL;
-    return new_nl;
+    return;
+}
+
+
+
+/*
+ * @COMPLEXITY: O(m*n) where  ( m x n ) are the dimensions
+ *              of the weights matrix for the current layer.
+ *
+ * The function neural_layer_create_float() is the single
+ * precision counterpart of neural_layer_create().It takes the
+ * same arguments,but the memory of the network holds floats and
+ * the matrices of the layer are laid over it as float views.The
+ * double views of the layer are left empty.The synaptic weights
+ * are drawn from the same generator and then rounded to floats.
+ *
+ * @param:  neural_layer_t      *nl
+ * @param:  llint               j
+ * @param:  llint               i
+ * @param:  int                 layer_type
+ * @param:  float               *weights
+ * @param:  float               *velocity
+ * @param:  float               *scratch
+ * @param:  unsigned long       seed
+ * @return: void
+ *
+ */
+
+void neural_layer_create_float(neural_layer_t *nl,llint j,llint i,int layer_type,float *weights,float *velocity,float *scratch,unsigned long seed)
+{
+    // Variable declarations and
+    // default instantiations.
+    size_t row,column,brow;
+    gsl_rng *random_gen=NULL;
+    assert(nl!=NULL && weights!=NULL && scratch!=NULL);
+    memset(nl,0,sizeof(*nl));
+    random_gen=gsl_rng_alloc(gsl_rng_taus);
+    gsl_rng_set(random_gen,seed);
+
+    // Laying the float matrices over the given memory in
+    // the same way as their double counterparts.
+    brow=(layer_type==HIDDEN_NEURAL_LAYER ? j+1 : j);
+    nl->Wf=gsl_matrix_float_view_array(weights,j,i);
+    if (velocity!=NULL) { nl->Vf=gsl_matrix_float_view_array(velocity,j,i); }
+    nl->If=gsl_matrix_float_view_array(scratch,j,1);
+    nl->Df=gsl_matrix_float_view_array(scratch+j,j,1);
+    nl->Yf=gsl_matrix_float_view_array(scratch+2*j,brow,1);
+
+    // Popullating the cells of the weights matrix
+    // with uniform random numbers between (0,1).
+    for (row=0;row<nl->Wf.matrix.size1;row++)
+    {
+        for (column=0;column<nl->Wf.matrix.size2;column++)
+        {
+            gsl_matrix_float_set(&nl->Wf.matrix,row,column,(float )gsl_rng_uniform_pos(random_gen));
+        }
+    }
+    if (velocity!=NULL) { gsl_matrix_float_memcpy(&nl->Vf.matrix,&nl->Wf.matrix); }
+    gsl_rng_free(random_gen);
+    return;
 }
 
 
@@ -157,7 +234,7 @@ neural_layer_t *neural_layer_create(llint j,llint i,int layer_type)
 gsl_matrix *neural_layer_getW(neural_layer_t *nl)
 {
     assert(nl!=NULL);
-    return nl->W;
+    return &nl->W.matrix;
 }
 
 
@@ -177,7 +254,7 @@ gsl_matrix *neural_layer_getW(neural_layer_t *nl)
 gsl_matrix *neural_layer_getI(neural_layer_t *nl)
 {
     assert(nl!=NULL);
-    return nl->I;
+    return &nl->I.matrix;
 }
 
 
@@ -197,7 +274,7 @@ gsl_matrix *neural_layer_getI(neural_layer_t *nl)
 gsl_matrix *neural_layer_getY(neural_layer_t *nl)
 {
     assert(nl!=NULL);
-    return nl->Y;
+    return &nl->Y.matrix;
 }
 
 
@@ -218,7 +295,7 @@ gsl_matrix *neural_layer_getY(neural_layer_t *nl)
 gsl_matrix *neural_layer_getD(neural_layer_t *nl)
 {
     assert(nl!=NULL);
-    return nl->D;
+    return &nl->D.matrix;
 }
 
 
@@ -226,46 +303,118 @@ gsl_matrix *neural_layer_getD(neural_layer_t *nl)
 /*
  * @COMPLEXITY: Theta(1)
  *
- * The function neural_layer_getO() takes one argument
+ * The function neural_layer_getV() takes one argument
  * as parameter,namely a neural layer data structure
- * and returns the address of it's synaptic weights
- * matrix from the previous epoch.
+ * and returns the address of it's velocity matrix,or
+ * NULL if the layer trains without momentum.
  *
  * @param:  neural_layer_t      *nl
  * @return: gsl_matrix          *
  *
  */
 
-gsl_matrix *neural_layer_getO(neural_layer_t *nl)
+gsl_matrix *neural_layer_getV(neural_layer_t *nl)
 {
     assert(nl!=NULL);
-    return nl->O;
+    return (nl->V.matrix.data!=NULL ? &nl->V.matrix : NULL);
 }
 
 
 
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_layer_getW_float() returns the address
+ * of the float synaptic weights matrix of the given layer,or NULL if
+ * the layer has been laid out in double precision.
+ *
+ * @param:  neural_layer_t      *nl
+ * @return: gsl_matrix_float    *
+ *
+ */
+
+gsl_matrix_float *neural_layer_getW_float(neural_layer_t *nl)
+{
+    assert(nl!=NULL);
+    return (nl->Wf.matrix.data!=NULL ? &nl->Wf.matrix : NULL);
+}
+
+
 
 /*
  * @COMPLEXITY: Theta(1)
  *
- * The function neural_layer_free() takes one argument
- * as parameter,namely a neural layer data structure
- * and deallocates memory for it and it's components.
+ * The function neural_layer_getI_float() returns the address
+ * of the float linear aggregators matrix of the given layer,or NULL if
+ * the layer has been laid out in double precision.
  *
  * @param:  neural_layer_t      *nl
- * @return: void
+ * @return: gsl_matrix_float    *
  *
  */
 
-void neural_layer_free(neural_layer_t *nl)
+gsl_matrix_float *neural_layer_getI_float(neural_layer_t *nl)
 {
     assert(nl!=NULL);
-    gsl_matrix_free(nl->W);
-    gsl_matrix_free(nl->I);
-    gsl_matrix_free(nl->Y);
-    gsl_matrix_free(nl->D);
-    gsl_matrix_free(nl->O);
-    free(nl); nl=NULL;
-    return;
+    return (nl->If.matrix.data!=NULL ? &nl->If.matrix : NULL);
+}
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_layer_getY_float() returns the address
+ * of the float output signals matrix of the given layer,or NULL if
+ * the layer has been laid out in double precision.
+ *
+ * @param:  neural_layer_t      *nl
+ * @return: gsl_matrix_float    *
+ *
+ */
+
+gsl_matrix_float *neural_layer_getY_float(neural_layer_t *nl)
+{
+    assert(nl!=NULL);
+    return (nl->Yf.matrix.data!=NULL ? &nl->Yf.matrix : NULL);
+}
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_layer_getD_float() returns the address
+ * of the float gradient matrix of the given layer,or NULL if
+ * the layer has been laid out in double precision.
+ *
+ * @param:  neural_layer_t      *nl
+ * @return: gsl_matrix_float    *
+ *
+ */
+
+gsl_matrix_float *neural_layer_getD_float(neural_layer_t *nl)
+{
+    assert(nl!=NULL);
+    return (nl->Df.matrix.data!=NULL ? &nl->Df.matrix : NULL);
 }
 
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_layer_getV_float() returns the address
+ * of the float velocity matrix of the given layer,or NULL if
+ * the layer trains without momentum or in double precision.
+ *
+ * @param:  neural_layer_t      *nl
+ * @return: gsl_matrix_float    *
+ *
+ */
+
+gsl_matrix_float *neural_layer_getV_float(neural_layer_t *nl)
+{
+    assert(nl!=NULL);
+    return (nl->Vf.matrix.data!=NULL ? &nl->Vf.matrix : NULL);
+}
@@ -0,0 +1,619 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * low-rank factorised inference engine
+ * of the neural network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the string
+ * manipulation library,the mathematics library,
+ * the gsl linear algebra library for the singular
+ * value decomposition,the header file "neural_lowrank.h"
+ * that contains datatype definitions and function
+ * prototypings regarding the factorised network and
+ * the header file "profiler.h" for the per-layer
+ * profiling hooks.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_linalg.h>
+#include "neural_lowrank.h"
+#include "profiler.h"
+
+
+
+
+/*
+ * Defining the four bytes that open every
+ * file of factorised synaptic weights.
+ *
+ */
+
+#define LOWRANK_MAGIC       "NNLR"
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The static function lowrank_alloc() allocates a factorised network
+ * for the given configuration with empty layers.The scratch arrays
+ * hold the input and the output signals of any layer and the products
+ * of any right factor with them.
+ *
+ */
+
+static neural_lowrank_t *lowrank_alloc(neural_config_t *config)
+{
+    neural_lowrank_t *nl=NULL; llint l;
+    size_t widest=0;
+
+    nl=(neural_lowrank_t *)malloc(sizeof(*nl));
+    assert(nl!=NULL); nl->config=config;
+    nl->layers=(lowrank_layer_t *)calloc(config->nlayers,sizeof(lowrank_layer_t ));
+    assert(nl->layers!=NULL);
+    for (l=0;l<config->nlayers;l++)
+    {
+        nl->layers[l].rows=config->neurons[l];
+        nl->layers[l].columns=(l==0 ? config->signals : config->neurons[l-1]+1);
+        if ((size_t )nl->layers[l].columns>widest) { widest=(size_t )nl->layers[l].columns; }
+        if ((size_t )nl->layers[l].rows+1>widest)  { widest=(size_t )nl->layers[l].rows+1;  }
+    }
+    nl->X=(double *)malloc(widest*sizeof(double ));
+    nl->Y=(double *)malloc(widest*sizeof(double ));
+    nl->T=(double *)malloc(widest*sizeof(double ));
+    nl->output=gsl_matrix_alloc(config->neurons[config->nlayers-1],1);
+    assert(nl->X!=NULL && nl->Y!=NULL && nl->T!=NULL && nl->output!=NULL);
+    return nl;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n*min(m,n))     Where ( m x n ) are the dimensions
+ *                                  of the synaptic weights matrix.
+ *
+ * The static function layer_decompose() fills in the left and the right
+ * factor of a layer at full rank from the singular value decomposition
+ * of its synaptic weights.The decomposition of gsl needs at least as
+ * many rows as columns,so a layer with fewer neurons than input signals
+ * decomposes the transposed weights and swaps the roles of U and V.The
+ * singular values come in decreasing order,so the leading r columns of
+ * the left factor and rows of the right one are the best rank r product.
+ *
+ */
+
+static void layer_decompose(lowrank_layer_t *ll)
+{
+    size_t m,n,k,j,i,s; int tall;
+    gsl_matrix *U=NULL,*V=NULL; gsl_vector *S=NULL,*work=NULL;
+    m=(size_t )ll->rows; n=(size_t )ll->columns;
+    tall=(m>=n); k=(tall ? n : m);
+
+    U=gsl_matrix_alloc(tall ? m : n,k);
+    V=gsl_matrix_alloc(k,k);
+    S=gsl_vector_alloc(k); work=gsl_vector_alloc(k);
+    assert(U!=NULL && V!=NULL && S!=NULL && work!=NULL);
+    for (j=0;j<m;j++)
+    {
+        for (i=0;i<n;i++)
+        {
+            if (tall) { gsl_matrix_set(U,j,i,ll->W[j*n+i]); }
+            else      { gsl_matrix_set(U,i,j,ll->W[j*n+i]); }
+        }
+    }
+    gsl_linalg_SV_decomp(U,V,S,work);
+
+    // W = U * S * V' for a tall layer and W = V * S * U'
+    // otherwise,the singular values being folded into
+    // the left factor.
+    ll->stride=(llint )k;
+    ll->A=(double *)malloc(m*k*sizeof(double ));
+    ll->B=(double *)malloc(k*n*sizeof(double ));
+    assert(ll->A!=NULL && ll->B!=NULL);
+    for (s=0;s<k;s++)
+    {
+        for (j=0;j<m;j++) { ll->A[j*k+s]=gsl_vector_get(S,s)*(tall ? gsl_matrix_get(U,j,s) : gsl_matrix_get(V,j,s)); }
+        for (i=0;i<n;i++) { ll->B[s*n+i]=(tall ? gsl_matrix_get(V,i,s) : gsl_matrix_get(U,i,s)); }
+    }
+    gsl_matrix_free(U); gsl_matrix_free(V);
+    gsl_vector_free(S); gsl_vector_free(work);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n*min(m,n))   Where l is the number of layers and
+ *                                  ( m x n ) the dimensions of the largest
+ *                                  synaptic weights matrix.
+ *
+ * The function neural_lowrank_create() copies the synaptic weights of
+ * every layer of the given network and decomposes them into a left and
+ * a right factor at full rank.Every layer starts out dense,with a rank
+ * of zero,until neural_lowrank_fit() picks the ranks.The factorised
+ * network shares the configuration of the given one,which has to
+ * outlive it.
+ *
+ * @param:  neural_net_t        *nn
+ * @return: neural_lowrank_t    *
+ *
+ */
+
+neural_lowrank_t *neural_lowrank_create(neural_net_t *nn)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,j,i; neural_lowrank_t *nl=NULL;
+    lowrank_layer_t *ll=NULL;
+    assert(nn!=NULL);
+    nl=lowrank_alloc(nn->config);
+
+    for (l=0;l<(size_t )nn->config->nlayers;l++)
+    {
+        ll=&nl->layers[l]; ll->rank=0;
+        ll->W=(double *)malloc((size_t )(ll->rows*ll->columns)*sizeof(double ));
+        assert(ll->W!=NULL);
+        for (j=0;j<(size_t )ll->rows;j++)
+        {
+            for (i=0;i<(size_t )ll->columns;i++) { ll->W[j*ll->columns+i]=neural_net_weight(nn,l,j,i); }
+        }
+        layer_decompose(ll);
+    } return nl;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of input signals.
+ *
+ * The static function lowrank_dot() returns the dot product of a row
+ * of weights and the input signals,summed up in four interleaved
+ * partial sums,so that the additions do not wait on each other.
+ *
+ */
+
+static double lowrank_dot(const double *restrict w,const double *restrict x,size_t n)
+{
+    size_t i; double s0=0.0,s1=0.0,s2=0.0,s3=0.0;
+    for (i=0;i+4<=n;i+=4)
+    {
+        s0+=w[i]*x[i];     s1+=w[i+1]*x[i+1];
+        s2+=w[i+2]*x[i+2]; s3+=w[i+3]*x[i+3];
+    }
+    for (;i<n;i++) { s0+=w[i]*x[i]; }
+    return (s0+s1)+(s2+s3);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*r*(m+n))   Where l is the number of layers in the
+ *                             neural network,( m x n ) the dimensions of
+ *                             the largest synaptic weights matrix and r
+ *                             the largest rank in use.
+ *
+ * The function neural_lowrank_activate() is the factorised counterpart
+ * of neural_net_activate().A factorised layer first projects its input
+ * signals onto the rows of the right factor and then aggregates every
+ * neuron over the projections:
+ *
+ *      T(s) = Sum ( B(s,i) * X(i) )    I(j) = Sum ( A(j,s) * T(s) )
+ *
+ * which takes r*(m+n) multiplications instead of m*n.The dense layers
+ * use a plain dot product.The returned matrix holds the output signals
+ * and belongs to the network.
+ *
+ * @param:  neural_lowrank_t    *nl
+ * @param:  gsl_vector          *signals
+ * @return: gsl_matrix          *
+ *
+ */
+
+gsl_matrix *neural_lowrank_activate(neural_lowrank_t *nl,gsl_vector *signals)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,i,j,s,r,n,last; double value,*x=NULL,*y=NULL,*swap=NULL;
+    lowrank_layer_t *ll=NULL; uint64_t t;
+    assert(nl!=NULL && signals!=NULL);
+    assert(signals->size>=(size_t )nl->config->signals);
+    last=nl->config->nlayers-1; x=nl->X; y=nl->Y;
+
+    // The output signals of a layer are the input
+    // signals of the next one,so the two scratch
+    // arrays swap their roles.
+    for (i=0;i<(size_t )nl->config->signals;i++) { x[i]=gsl_vector_get(signals,i); }
+    for (l=0;l<=last;l++)
+    {
+        t=profiler_begin(); ll=&nl->layers[l];
+        r=(size_t )ll->rank; n=(size_t )ll->columns;
+        for (s=0;s<r;s++) { nl->T[s]=lowrank_dot(ll->B+s*n,x,n); }
+        for (j=0;j<(size_t )ll->rows;j++)
+        {
+            if (r>0) { value=lowrank_dot(ll->A+j*ll->stride,nl->T,r); }
+            else     { value=lowrank_dot(ll->W+j*n,x,n); }
+            value=nl->config->activate(&value,&nl->config->alpha,&nl->config->beta);
+            if (l==last) { gsl_matrix_set(nl->output,j,0,value); }
+            else         { y[j+1]=value; }
+        }
+        if (l<last) { y[0]=-1.0; swap=x; x=y; y=swap; }
+        if (r>0) { profiler_end(PROFILE_FORWARD,l,t,(size_t )(r*(ll->rows+ll->columns)+ll->columns+2*ll->rows)*sizeof(double )); }
+        else     { profiler_end(PROFILE_FORWARD,l,t,(size_t )(ll->rows*ll->columns+ll->columns+2*ll->rows)*sizeof(double )); }
+    } return nl->output;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(t*l*r*(m+n))     Where t is the number of rows,l the
+ *                                 number of layers,( m x n ) the dimensions
+ *                                 of the largest synaptic weights matrix
+ *                                 and r the largest rank in use.
+ *
+ * The function neural_lowrank_predict() is the factorised counterpart
+ * of neural_net_predict() and returns a newly allocated matrix that
+ * holds the output signals of every row of the given matrix.
+ *
+ * @param:  neural_lowrank_t    *nl
+ * @param:  gsl_matrix          *data
+ * @return: gsl_matrix          *
+ *
+ */
+
+gsl_matrix *neural_lowrank_predict(neural_lowrank_t *nl,gsl_matrix *data)
+{
+    size_t i; gsl_matrix *results=NULL;
+    gsl_vector_view row,destination,source;
+    assert(nl!=NULL && data!=NULL);
+    results=gsl_matrix_alloc(data->size1,nl->output->size1);
+    assert(results!=NULL);
+    for (i=0;i<data->size1;i++)
+    {
+        row=gsl_matrix_row(data,i);
+        neural_lowrank_activate(nl,&row.vector);
+        source=gsl_matrix_column(nl->output,0);
+        destination=gsl_matrix_row(results,i);
+        gsl_vector_memcpy(&destination.vector,&source.vector);
+    } return results;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(t*l*r*(m+n))     Where t is the number of rows,l the
+ *                                 number of layers,( m x n ) the dimensions
+ *                                 of the largest synaptic weights matrix
+ *                                 and r the largest rank in use.
+ *
+ * The function neural_lowrank_score() is the factorised counterpart of
+ * evaluation_score() and scores the factorised network on every row of
+ * the given dataset,which has to hold the desired output signals.
+ *
+ * @param:  neural_lowrank_t    *nl
+ * @param:  dataset_t           *ds
+ * @param:  evaluation_t        *ev
+ * @return: void
+ *
+ */
+
+void neural_lowrank_score(neural_lowrank_t *nl,dataset_t *ds,evaluation_t *ev)
+{
+    // Variable declarations,type
+    // assertions and default values.
+    size_t i,j,s,rows,best_y,best_d;
+    double y,d,min,max,sum=0.0;
+    gsl_vector_view row; gsl_matrix *Y=NULL;
+    assert(nl!=NULL && ds!=NULL && ev!=NULL);
+    s=(size_t )nl->config->signals; rows=ds->data->size1;
+    assert(ds->data->size2==s+nl->output->size1);
+    ev->test_rows=rows; ev->correct=0;
+    ev->accuracy=0.0; ev->rmse=0.0;
+    if (rows==0) { return; }
+
+    for (i=0;i<rows;i++)
+    {
+        row=gsl_matrix_subrow(ds->data,i,0,s);
+        Y=neural_lowrank_activate(nl,&row.vector);
+        if (ds->type==DATASET_CLASSIFY)
+        {
+            best_y=0; best_d=0;
+            for (j=1;j<Y->size1;j++)
+            {
+                if (gsl_matrix_get(Y,j,0)>gsl_matrix_get(Y,best_y,0))           { best_y=j; }
+                if (gsl_matrix_get(ds->data,i,s+j)>gsl_matrix_get(ds->data,i,s+best_d)) { best_d=j; }
+            }
+            if (best_y==best_d) { ev->correct++; }
+            continue;
+        }
+        for (j=0;j<Y->size1;j++)
+        {
+            y=gsl_matrix_get(Y,j,0);
+            d=gsl_matrix_get(ds->data,i,s+j);
+            if (ds->minimums!=NULL && ds->maximums!=NULL)
+            {
+                min=gsl_vector_get(ds->minimums,s+j);
+                max=gsl_vector_get(ds->maximums,s+j);
+                y=ds->descaler(min,max,y,2.0,1.0);
+                d=ds->descaler(min,max,d,2.0,1.0);
+            } sum+=(d-y)*(d-y);
+        }
+    }
+
+    ev->accuracy=(double )ev->correct/(double )rows;
+    if (ds->type==DATASET_PREDICT) { ev->rmse=sqrt(sum/(double )(rows*nl->output->size1)); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function within_budget() returns a non-zero value if
+ * the given scores stay within the budget of the reference scores.
+ * For classification the budget is the largest drop of the accuracy
+ * and for curve fitting the largest relative growth of the root mean
+ * square error.
+ *
+ */
+
+static int within_budget(dataset_t *ds,evaluation_t *reference,evaluation_t *ev,double budget)
+{
+    if (ds->type==DATASET_CLASSIFY) { return (reference->accuracy-ev->accuracy<=budget+1e-12); }
+    return (ev->rmse<=reference->rmse*(1.0+budget)+1e-12);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*log(k)*t*l*k*(m+n))    Where l is the number of layers,
+ *                                         t the number of rows,( m x n ) the
+ *                                         dimensions of the largest synaptic
+ *                                         weights matrix and k = min(m,n).
+ *
+ * The function neural_lowrank_fit() picks the rank of every layer of the
+ * factorised network so that its scores on the given dataset stay within
+ * the given budget of the scores of the original network.The layers are
+ * fitted one after the other,every one keeping the ranks of the previous
+ * ones,and the smallest rank that meets the budget is found by bisection.
+ * Only ranks that take fewer multiplications than the dense layer are
+ * tried,a layer that cannot meet the budget with one of them stays dense.
+ * The dataset has to hold the desired output signals.The report receives
+ * the number of weights and the scores of either network.
+ *
+ * @param:  neural_lowrank_t    *nl
+ * @param:  neural_net_t        *nn
+ * @param:  dataset_t           *ds
+ * @param:  double              budget
+ * @param:  lowrank_report_t    *report
+ * @return: void
+ *
+ */
+
+void neural_lowrank_fit(neural_lowrank_t *nl,neural_net_t *nn,dataset_t *ds,double budget,lowrank_report_t *report)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l; llint lo,hi,mid,best,limit;
+    lowrank_layer_t *ll=NULL; evaluation_t ev;
+    assert(nl!=NULL && nn!=NULL && ds!=NULL && report!=NULL && budget>=0.0);
+    memset(report,0,sizeof(*report));
+    evaluation_score(nn,ds,NULL,ds->data->size1,&report->reference);
+
+    for (l=0;l<(size_t )nl->config->nlayers;l++)
+    {
+        // A rank r layer takes r*(m+n) multiplications,so
+        // only ranks below m*n/(m+n) are worth trying.
+        ll=&nl->layers[l]; ll->rank=0; best=0;
+        limit=(ll->rows*ll->columns-1)/(ll->rows+ll->columns);
+        if (limit>ll->stride) { limit=ll->stride; }
+        lo=1; hi=limit;
+        while (lo<=hi)
+        {
+            mid=lo+(hi-lo)/2; ll->rank=mid;
+            neural_lowrank_score(nl,ds,&ev);
+            if (within_budget(ds,&report->reference,&ev,budget)) { best=mid; hi=mid-1; }
+            else                                                  { lo=mid+1; }
+        } ll->rank=best;
+    }
+
+    for (l=0;l<(size_t )nl->config->nlayers;l++)
+    {
+        ll=&nl->layers[l];
+        report->reference_weights+=(size_t )(ll->rows*ll->columns);
+        report->weights+=(size_t )(ll->rank>0 ? ll->rank*(ll->rows+ll->columns) : ll->rows*ll->columns);
+    }
+    neural_lowrank_score(nl,ds,&report->factorised);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_lowrank_dump() saves the configuration of the
+ * factorised network into config.bin,in the same format as the one of
+ * neural_net_dump(),and the layers into lowrank.bin.The lowrank.bin
+ * file starts with the four bytes "NNLR" and holds per layer the number
+ * of rows,columns and the rank as long long integers followed by the
+ * synaptic weights of a dense layer,or by the left factor and the right
+ * factor of a factorised one,row after row as doubles.
+ *
+ * @param:  neural_lowrank_t    *nl
+ * @param:  char                *directory
+ * @return: void
+ *
+ */
+
+void neural_lowrank_dump(neural_lowrank_t *nl,char *directory)
+{
+    FILE *f=NULL; llint l,j; char *filepath=NULL;
+    lowrank_layer_t *ll=NULL;
+    assert(nl!=NULL && directory!=NULL);
+
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"wb");
+    if (f==NULL) { fprintf(stderr,"Could not write %s.\n",filepath); exit(EXIT_FAILURE); }
+    neural_config_dump(nl->config,f);
+    fclose(f); free(filepath);
+
+    filepath=neural_net_path(directory,"/lowrank.bin");
+    f=fopen(filepath,"wb");
+    if (f==NULL) { fprintf(stderr,"Could not write %s.\n",filepath); exit(EXIT_FAILURE); }
+    fwrite(LOWRANK_MAGIC,sizeof(char ),4,f);
+    for (l=0;l<nl->config->nlayers;l++)
+    {
+        ll=&nl->layers[l];
+        fwrite(&ll->rows,sizeof(llint ),1,f);
+        fwrite(&ll->columns,sizeof(llint ),1,f);
+        fwrite(&ll->rank,sizeof(llint ),1,f);
+        if (ll->rank==0) { fwrite(ll->W,sizeof(double ),ll->rows*ll->columns,f); continue; }
+        for (j=0;j<ll->rows;j++) { fwrite(ll->A+j*ll->stride,sizeof(double ),ll->rank,f); }
+        fwrite(ll->B,sizeof(double ),ll->rank*ll->columns,f);
+    } fclose(f); free(filepath);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_lowrank_load() loads the configuration saved in
+ * the given directory into the given config data structure and the
+ * factorised layers saved next to it.A loaded layer only holds either
+ * its synaptic weights or its two factors.If the lowrank.bin file does
+ * not match the configuration the program execution is terminated.
+ *
+ * @param:  neural_config_t     *config
+ * @param:  char                *directory
+ * @return: neural_lowrank_t    *
+ *
+ */
+
+neural_lowrank_t *neural_lowrank_load(neural_config_t *config,char *directory)
+{
+    FILE *f=NULL; llint l,rows,columns,rank; char magic[4];
+    char *filepath=NULL; neural_lowrank_t *nl=NULL;
+    lowrank_layer_t *ll=NULL; int status=0; size_t n;
+    assert(config!=NULL && directory!=NULL);
+
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"rb");
+    if (f==NULL) { fprintf(stderr,"Could not open %s.\n",filepath); exit(EXIT_FAILURE); }
+    neural_config_load(config,f);
+    fclose(f); free(filepath);
+    nl=lowrank_alloc(config);
+
+    filepath=neural_net_path(directory,"/lowrank.bin");
+    f=fopen(filepath,"rb");
+    if (f==NULL) { fprintf(stderr,"Could not open %s.\n",filepath); exit(EXIT_FAILURE); }
+    status=(fread(magic,sizeof(char ),4,f)!=4 || memcmp(magic,LOWRANK_MAGIC,4)!=0);
+    for (l=0;status==0 && l<config->nlayers;l++)
+    {
+        ll=&nl->layers[l];
+        status=(fread(&rows,sizeof(llint ),1,f)!=1 || fread(&columns,sizeof(llint ),1,f)!=1 || fread(&rank,sizeof(llint ),1,f)!=1);
+        if (status || rows!=ll->rows || columns!=ll->columns || rank<0 || rank>rows || rank>columns) { status=1; break; }
+        ll->rank=rank; ll->stride=rank;
+        if (rank==0)
+        {
+            n=(size_t )(rows*columns);
+            ll->W=(double *)malloc(n*sizeof(double ));
+            assert(ll->W!=NULL);
+            status=(fread(ll->W,sizeof(double ),n,f)!=n);
+            continue;
+        }
+        ll->A=(double *)malloc((size_t )(rows*rank)*sizeof(double ));
+        ll->B=(double *)malloc((size_t )(rank*columns)*sizeof(double ));
+        assert(ll->A!=NULL && ll->B!=NULL);
+        status=(fread(ll->A,sizeof(double ),rows*rank,f)!=(size_t )(rows*rank));
+        status=(status || fread(ll->B,sizeof(double ),rank*columns,f)!=(size_t )(rank*columns));
+    } fclose(f);
+    if (status) { fprintf(stderr,"The factorised model %s does not match its configuration.\n",filepath); exit(EXIT_FAILURE); }
+    free(filepath); return nl;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_lowrank_exists() returns a non-zero value if the
+ * given directory holds a factorised model and zero otherwise.
+ *
+ * @param:  char    *directory
+ * @return: int
+ *
+ */
+
+int neural_lowrank_exists(char *directory)
+{
+    char *filepath=NULL; FILE *f=NULL;
+    assert(directory!=NULL);
+    filepath=neural_net_path(directory,"/lowrank.bin");
+    f=fopen(filepath,"rb"); free(filepath);
+    if (f==NULL) { return 0; }
+    fclose(f); return 1;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The function neural_lowrank_free() deallocates the factorised
+ * network.The configuration belongs to the caller and is left
+ * untouched.
+ *
+ * @param:  neural_lowrank_t    *nl
+ * @return: void
+ *
+ */
+
+void neural_lowrank_free(neural_lowrank_t *nl)
+{
+    llint l;
+    assert(nl!=NULL);
+    for (l=0;l<nl->config->nlayers;l++)
+    {
+        free(nl->layers[l].W);
+        free(nl->layers[l].A);
+        free(nl->layers[l].B);
+    }
+    free(nl->layers);
+    free(nl->X); free(nl->Y); free(nl->T);
+    gsl_matrix_free(nl->output);
+    free(nl); return;
+}
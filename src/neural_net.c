@@ -13,27 +13,64 @@
 /*
  * Including the standard utilities library,
  * the standard string manipulation library,
- * the standard assertions library and the
- * "neural_net.h" header file that contains
+ * the standard assertions library,the mathematics
+ * library,the time library,the error numbers library,
+ * the gnu random number generation library,the file
+ * status libraries,
+ * the "neural_net.h" header file that contains
  * datatype definitions and function prototypings
  * of procedures regarding the neural network data
- * structure.
+ * structure,the "neural_float.h" header file for
+ * the single precision procedures,the "neural_backend.h"
+ * header file for the dense kernels and the
+ * "profiler.h" header file for the per-layer profiling hooks.
  *
  */
 
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <math.h>
+#include <time.h>
+#include <errno.h>
+#include <gsl/gsl_rng.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 #include "neural_net.h"
+#include "neural_float.h"
+#include "neural_backend.h"
+#include "profiler.h"
 
 
 
 
 
 
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function arena_round() takes the number of cells of
+ * a matrix and the width of a cell in bytes and returns the bytes
+ * the matrix takes up,rounded up to a whole number of arena alignment
+ * units,so that the next matrix in the arena starts on a cache line
+ * of its own.
+ *
+ * @param:  size_t  n
+ * @param:  size_t  width
+ * @return: size_t
+ *
+ */
+
+static size_t arena_round(size_t n,size_t width)
+{
+    size_t unit=NEURAL_NET_ALIGN;
+    return (n*width+unit-1)/unit*unit;
+}
+
+
+
+
 /*
  * @COMPLEXITY: O(l*m*n)    Where l is the number of layers
  *                          in the neural network and  ( m x n) are
@@ -46,6 +83,10 @@
  * memory for it and it's components.Once memory has been
  * allocated the fields are instantiated and the arguments
  * are assigned to the corresponding components of the net.
+ * Every layer matrix is laid over one aligned arena,so a
+ * network takes three allocations whatever its depth.The
+ * precision of the configuration decides whether the arena
+ * holds doubles or floats and its seed the initial weights.
  *
  * @param:  neural_config_t         *config
  * @return: neural_net_t            *
@@ -58,7 +99,12 @@ neural_net_t *neural_net_create(neural_config_t *config)
     // structure and checking whether the
     // given configuration is null or not.
     neural_net_t *new_nn=NULL;
-    llint i; assert(config!=NULL);
+    llint i,j,k; int type; assert(config!=NULL);
+    size_t weights=0,velocity=0,scratch=0,extra=0,w,v,t,width;
+    neural_layer_t *block=NULL; char *arena=NULL;
+    gsl_rng *random_gen=NULL;
+    assert(config->precision==PRECISION_F64 || config->precision==PRECISION_F32);
+    width=(config->precision==PRECISION_F32 ? sizeof(float ) : sizeof(double ));
 
     
     // Allocating memory for a new neural network data structure
@@ -68,45 +114,83 @@ neural_net_t *neural_net_create(neural_config_t *config)
     // component.
     new_nn=(neural_net_t *)malloc(sizeof(*new_nn));
     assert(new_nn!=NULL); new_nn->config=config;
+    new_nn->input=NULL; memset(&new_nn->output,0,sizeof(new_nn->output));
+    new_nn->tiny=(config->precision==PRECISION_F64);
+    new_nn->threads=thread_pool_cpus(); new_nn->pool=NULL;
+    new_nn->slices=NULL; new_nn->nslices=NULL;
 
     
     // Based on the given configuration settings we allocate memory
-    // for an array of neural layer data structures.
+    // for an array of neural layer data structures and for the layers
+    // themselves in a single block.
     new_nn->layers=(neural_layer_t **)malloc(config->nlayers*sizeof(neural_layer_t *));
-    assert(new_nn->layers!=NULL);
-    
-    
-    // Iterating over the newly created array
-    // to instantiate each neural layer cell.
+    block=(neural_layer_t *)malloc(config->nlayers*sizeof(neural_layer_t ));
+    assert(new_nn->layers!=NULL && block!=NULL);
+    for (i=0;i<config->nlayers;i++) { new_nn->layers[i]=&block[i]; }
+
+
+    // Measuring the arena.The first layer has as synaptic weights
+    // the number of input signals,the rest the number of neurons of
+    // the previous layer plus the bias.Every layer except the output
+    // one is a hidden layer.Every matrix is rounded up to a whole
+    // number of cache lines.A single precision network also keeps
+    // its input signals in floats and its output signals in doubles.
+    // A single layer that is too large rules out the fused pass.
     for (i=0;i<config->nlayers;i++)
     {
-        if (i==0)
+        j=config->neurons[i]; k=(i==0 ? config->signals : config->neurons[i-1]+1);
+        type=(i+1==config->nlayers ? OUTPUT_NEURAL_LAYER : HIDDEN_NEURAL_LAYER);
+        weights+=arena_round((size_t )(j*k),width);
+        scratch+=arena_round(neural_layer_scratch(j,type),width);
+        if (j*k>NEURAL_TINY_WEIGHTS) { new_nn->tiny=0; }
+    }
+    if (config->precision==PRECISION_F32)
+    {
+        extra=arena_round((size_t )config->signals,sizeof(float ));
+        extra+=arena_round((size_t )config->neurons[config->nlayers-1],sizeof(double ));
+    }
+
+
+    // Allocating the zeroed arena and laying every layer over
+    // it.The weights of all layers come first,followed by their
+    // velocities and the scratch matrices.Training without
+    // momentum never reads a velocity,so none is laid out.
+    if (config->momentum!=0.0) { velocity=weights; }
+    new_nn->size=weights+velocity+scratch+extra;
+    if (posix_memalign(&new_nn->arena,NEURAL_NET_ALIGN,new_nn->size)!=0) { new_nn->arena=NULL; }
+    assert(new_nn->arena!=NULL);
+    memset(new_nn->arena,0,new_nn->size);
+    arena=(char *)new_nn->arena;
+
+    // Every layer draws its synaptic weights from a generator
+    // of its own,seeded from one started with the seed of the
+    // configuration,or with the current time if it has none.
+    random_gen=gsl_rng_alloc(gsl_rng_taus); assert(random_gen!=NULL);
+    gsl_rng_set(random_gen,config->seed!=0 ? config->seed : (unsigned long )time(NULL));
+    for (i=0,w=0,v=weights,t=weights+velocity;i<config->nlayers;i++)
+    {
+        j=config->neurons[i]; k=(i==0 ? config->signals : config->neurons[i-1]+1);
+        type=(i+1==config->nlayers ? OUTPUT_NEURAL_LAYER : HIDDEN_NEURAL_LAYER);
+        if (config->precision==PRECISION_F32)
         {
-            // If we are at the first layer we need to specify as
-            // synaptic weights the number of input signals and 
-            // set the type of the layer to hidden.
-            new_nn->layers[i]=neural_layer_create(config->neurons[i],
-                config->signals,HIDDEN_NEURAL_LAYER);
-            continue;
+            neural_layer_create_float(new_nn->layers[i],j,k,type,(float *)(arena+w),
+                                      velocity>0 ? (float *)(arena+v) : NULL,(float *)(arena+t),gsl_rng_get(random_gen));
         }
-
-        if (i+1==config->nlayers)
+        else
         {
-            // If we are at the final layer ( output layer ) we need
-            // to specify as synaptic weights the number of neurons
-            // of the previous layer and set the type of the current
-            // layer to output.
-            new_nn->layers[i]=neural_layer_create(config->neurons[i],
-                config->neurons[i-1]+1,OUTPUT_NEURAL_LAYER);
-            continue;
+            neural_layer_create(new_nn->layers[i],j,k,type,(double *)(arena+w),
+                                velocity>0 ? (double *)(arena+v) : NULL,(double *)(arena+t),gsl_rng_get(random_gen));
         }
-        
-        // For the rest of the hidden layer we specify as synaptic
-        // weights the number of neurons of the previous layer and 
-        // set the type of the current layer to hidden.
-        new_nn->layers[i]=neural_layer_create(config->neurons[i],
-            config->neurons[i-1]+1,HIDDEN_NEURAL_LAYER);
+        w+=arena_round((size_t )(j*k),width); v+=arena_round((size_t )(j*k),width);
+        t+=arena_round(neural_layer_scratch(j,type),width);
+    }
+    if (config->precision==PRECISION_F32)
+    {
+        new_nn->input=(float *)(arena+t);
+        t+=arena_round((size_t )config->signals,sizeof(float ));
+        new_nn->output=gsl_matrix_view_array((double *)(arena+t),config->neurons[config->nlayers-1],1);
     }
+    gsl_rng_free(random_gen);
     
     // Once everything has been completed we return
     // the address of the newly created neural net.
@@ -117,6 +201,216 @@ neural_net_t *neural_net_create(neural_config_t *config)
 
 
 
+/*
+ * @COMPLEXITY: O(m*n)  Where m is the number of neurons of the run
+ *                      and n the number of synaptic weights per neuron.
+ *
+ * The static function slice_run() is the task executed by the worker
+ * threads for a split layer.It calculates the linear aggregators of
+ * the neurons of the given run with the matrix vector product of the
+ * backend and fetches them into the activation function.
+ *
+ * @param:  void    *p
+ * @return: void
+ *
+ */
+
+static void slice_run(void *p)
+{
+    neural_slice_t *slice=(neural_slice_t *)p;
+    neural_backend.gemv(slice->neurons,slice->weights,slice->W,slice->ldw,slice->x,slice->incx,slice->I);
+    neural_backend.apply(slice->config,slice->neurons,slice->I,slice->y);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function split_count() returns the number of threads
+ * a layer of the given synaptic weights is split across,at most the
+ * given number and one per NEURAL_SPLIT_MIN weights.Small layers cost
+ * less than waking up a worker,so anything below two is not split.
+ *
+ */
+
+static size_t split_count(gsl_matrix *W,size_t threads)
+{
+    size_t n=W->size1*W->size2/NEURAL_SPLIT_MIN;
+    return (n>threads ? threads : n);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*t)  Where l is the number of layers and
+ *                      t the number of threads.
+ *
+ * The static function split_create() starts the workers of the given
+ * network and cuts every layer worth splitting into runs of neurons,
+ * a multiple of four each,the blocking of the matrix vector product.
+ * The runs and the tasks that hand them out are allocated once here,so
+ * propagating a row through a split layer allocates nothing.
+ *
+ */
+
+static void split_create(neural_net_t *nn)
+{
+    size_t l,n,s,run,first,nlayers=(size_t )nn->config->nlayers; int hidden;
+    gsl_matrix *W=NULL,*I=NULL,*Y=NULL; neural_slice_t *slices=NULL;
+    nn->pool=thread_pool_create(nn->threads-1);
+    nn->slices=(neural_slice_t **)calloc(nlayers,sizeof(neural_slice_t *));
+    nn->nslices=(size_t *)calloc(nlayers,sizeof(size_t ));
+    assert(nn->slices!=NULL && nn->nslices!=NULL);
+    for (l=0;l<nlayers;l++)
+    {
+        W=neural_layer_getW(nn->layers[l]);
+        I=neural_layer_getI(nn->layers[l]);
+        Y=neural_layer_getY(nn->layers[l]);
+        hidden=(l+1<nlayers);
+        if ((n=split_count(W,nn->threads))<2) { continue; }
+        run=(W->size1+n-1)/n; run=(run+3)/4*4;
+        slices=(neural_slice_t *)calloc(n,sizeof(neural_slice_t ));
+        assert(slices!=NULL);
+        for (s=0,first=0;first<W->size1;s++,first+=run)
+        {
+            slices[s].task.fn=slice_run; slices[s].task.arg=&slices[s];
+            slices[s].config=nn->config; slices[s].ldw=W->tda;
+            slices[s].W=W->data+first*W->tda; slices[s].weights=W->size2;
+            slices[s].neurons=(W->size1-first<run ? W->size1-first : run);
+            slices[s].I=I->data+first;
+            slices[s].y=Y->data+(hidden ? 1 : 0)+first;
+        }
+        nn->slices[l]=slices; nn->nslices[l]=s;
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l+t)  Where l is the number of layers and
+ *                      t the number of threads.
+ *
+ * The static function split_free() stops the workers of the
+ * given network,if any,and deallocates the runs of its layers.
+ *
+ */
+
+static void split_free(neural_net_t *nn)
+{
+    llint l;
+    if (nn->pool==NULL) { return; }
+    thread_pool_free(nn->pool); nn->pool=NULL;
+    for (l=0;l<nn->config->nlayers;l++) { free(nn->slices[l]); }
+    free(nn->slices); nn->slices=NULL;
+    free(nn->nslices); nn->nslices=NULL;
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions of
+ *                      the synaptic weights matrix of the layer.
+ *
+ * The function neural_net_layer_propagate() takes four arguments as
+ * parameters,namely a double precision neural network,the index of
+ * one of its layers and the input signals of that layer with their
+ * stride.It calculates the linear aggregators of the layer,fetches
+ * them into the activation function and stores the output signals,
+ * after the bias factor -1 at the hidden layers.A layer with at least
+ * NEURAL_SPLIT_MIN synaptic weights for each of two or more threads
+ * has its neurons split into runs,one per thread,which are cut when
+ * the workers are started.The calling thread propagates the first run
+ * itself,posts the rest to the workers and waits for all of them,so
+ * the layer is complete once the function returns.Every neuron still
+ * adds up its own sum,so the output signals do not depend on the number
+ * of threads.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  size_t          l
+ * @param:  const double    *x
+ * @param:  size_t          incx
+ * @return: void
+ *
+ */
+
+void neural_net_layer_propagate(neural_net_t *nn,size_t l,const double *x,size_t incx)
+{
+    // Variable declarations,type assertions and
+    // retrieval of the matrices of the layer.
+    size_t s; int hidden; neural_slice_t *slices=NULL;
+    gsl_matrix *W=NULL,*I=NULL,*Y=NULL;
+    assert(nn!=NULL && x!=NULL && l<(size_t )nn->config->nlayers);
+    W=neural_layer_getW(nn->layers[l]);
+    I=neural_layer_getI(nn->layers[l]);
+    Y=neural_layer_getY(nn->layers[l]);
+    hidden=(nn->config->nlayers>(llint )l+1);
+
+    // Starting the workers and cutting the layers into
+    // runs the first time a layer is worth splitting.
+    if (nn->pool==NULL && split_count(W,nn->threads)>1) { split_create(nn); }
+    if (nn->pool==NULL || nn->slices[l]==NULL)
+    {
+        neural_backend.gemv(W->size1,W->size2,W->data,W->tda,x,incx,I->data);
+        neural_backend.apply(nn->config,W->size1,I->data,Y->data+(hidden ? 1 : 0));
+    }
+    else
+    {
+        // Handing every run but the first one to the workers,
+        // propagating the first one here and waiting for all
+        // of them before the next layer reads the outputs.
+        slices=nn->slices[l];
+        for (s=0;s<nn->nslices[l];s++) { slices[s].x=x; slices[s].incx=incx; }
+        for (s=1;s<nn->nslices[l];s++) { thread_pool_post(nn->pool,&slices[s].task); }
+        slice_run(&slices[0]);
+        thread_pool_wait(nn->pool);
+    }
+
+    // If we are at the hidden layers insert the bias factor -1
+    // at the beginning of the signals output matrix.
+    if (hidden) { gsl_matrix_set(Y,0,0,-1.0); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(w)    Where w is the number of worker threads
+ *                      the network had.
+ *
+ * The function neural_net_threads() takes two arguments as parameters,
+ * namely a neural network and the number of threads the neurons of
+ * its wide layers are split across,one per online processor if it is
+ * zero.The workers of the previous number of threads are stopped and
+ * the new ones are started the next time a layer is split.Networks
+ * that are already trained or evaluated one per thread should keep a
+ * single one.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  size_t          threads
+ * @return: void
+ *
+ */
+
+void neural_net_threads(neural_net_t *nn,size_t threads)
+{
+    assert(nn!=NULL);
+    if (threads==0) { threads=thread_pool_cpus(); }
+    if (threads!=nn->threads) { split_free(nn); }
+    nn->threads=threads;
+    return;
+}
+
+
+
+
 /*
  * @COMPLEXITY: O(l*m*n)    Where l is the number of layers
  *                          in the neural network and the
@@ -143,82 +437,252 @@ static void forward_propagate(const void *n,const void *v)
 {
     // Variable declarations and initializations,
     // type assertions and type castings.
-    double wij,vi; double temp,value;
-    size_t i,j,l,s; double sum=0.0;
-    assert(n!=NULL && v!=NULL);
+    size_t l,incx; const double *x=NULL;
+    assert(n!=NULL && v!=NULL); uint64_t t;
     neural_net_t *nn=NULL; gsl_vector *vv=NULL;
+    gsl_matrix *W=NULL,*Y=NULL;
     nn=(neural_net_t *)n; vv=(gsl_vector *)v;
+    x=vv->data; incx=vv->stride;
     
     // Beginning the forward propagation process
     // by iterating through each layer of the network.
     for (l=0;l<nn->config->nlayers;l++)
     {
-        // Retrieving the synaptic weights matrix,the
-        // linear aggregators matrix and the signals output
-        // matrix for the current neural layer data structure.
-        gsl_matrix *W=neural_layer_getW(nn->layers[l]);
-        gsl_matrix *I=neural_layer_getI(nn->layers[l]);
-        gsl_matrix *Y=neural_layer_getY(nn->layers[l]);
-
-        // If we are not at the first neural layer
-        // retrieve the signals output matrix from
-        // the previous neural layer.
-        gsl_matrix *prevY=NULL;
-        if (l>0) { prevY=neural_layer_getY(nn->layers[l-1]); }
-        
-        // Iterating over the synaptic weights
-        // matrix data structure and the corresponding
-        // input signals matrix and calculating the
-        // linear aggregators and output signals.
-        for (i=0;i<W->size1;i++)
+        t=profiler_begin();
+        // Retrieving the synaptic weights matrix and the
+        // signals output matrix for the current neural
+        // layer data structure.
+        W=neural_layer_getW(nn->layers[l]);
+        Y=neural_layer_getY(nn->layers[l]);
+
+        // Calculating the linear aggregators of the layer:
+        //
+        //          Ii = Sum ( W(i,j) * x(j) )
+        //
+        // where x are the input signals at the first layer
+        // and the output signals of the previous layer at
+        // the rest.Every linear aggregator is then fetched
+        // into the activation function and the result is
+        // stored into the output signals matrix,after the
+        // bias factor -1 at the hidden layers.The neurons
+        // of a wide layer are split across the threads.
+        neural_net_layer_propagate(nn,l,x,incx);
+        x=Y->data; incx=1;
+        profiler_end(PROFILE_FORWARD,l,t,(W->size1*W->size2+W->size2+2*W->size1)*sizeof(double ));
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function neuron_activate() returns the output signal
+ * of a neuron of the given linear aggregator.The activation functions
+ * of neural_utils.c are evaluated inline,with the same expressions,so
+ * the result is the same as the one of the function pointer of the
+ * configuration,which is only called for any other function.
+ *
+ * @param:  neural_config_t     *config
+ * @param:  double              sum
+ * @return: double
+ *
+ */
+
+static inline double neuron_activate(neural_config_t *config,double sum)
+{
+    double z=config->alpha*sum+config->beta,e;
+    switch (config->atype)
+    {
+        case ACTIVATION_LGST: return 1.0/(1.0+exp(-z));
+        case ACTIVATION_LNR:  return z;
+        case ACTIVATION_HTAN: e=exp(-z); return (1.0-e)/(1.0+e);
+        default: return config->activate(&sum,&config->alpha,&config->beta);
+    }
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers
+ *                          in the neural network and ( m x n ) are
+ *                          the dimensions of the largest synaptic
+ *                          weights matrix.
+ *
+ * The static function tiny_propagate() is the fused forward pass
+ * of a tiny network.It takes the network,the input signals and
+ * the distance between two consecutive ones and walks the arena
+ * with plain pointers,without a single gsl call or view,and with
+ * the activation function inlined instead of called through the
+ * configuration.Every sum is accumulated in the same order as in
+ * forward_propagate() and the linear aggregators and output signals
+ * of every layer are stored in the same cells,so the network is left
+ * exactly as forward_propagate() leaves it.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  const double    *x
+ * @param:  size_t          stride
+ * @return: void
+ *
+ */
+
+static void tiny_propagate(neural_net_t *nn,const double *x,size_t stride)
+{
+    // Variable declarations
+    // and initializations.
+    size_t i,j,k,l,m,n; double sum[4],v;
+    llint last=nn->config->nlayers-1;
+    const double *in=x,*w=NULL; double *I=NULL,*y=NULL;
+
+    for (l=0;l<=(size_t )last;l++)
+    {
+        // Every matrix of a layer is a contiguous view over
+        // the arena,so its data can be walked row by row.The
+        // first layer reads the input signals with their stride,
+        // the rest read the previous output signals,bias included.
+        w=nn->layers[l]->W.matrix.data;
+        m=nn->layers[l]->W.matrix.size1; n=nn->layers[l]->W.matrix.size2;
+        I=nn->layers[l]->I.matrix.data; y=nn->layers[l]->Y.matrix.data;
+        if (l<(size_t )last) { *y++=-1.0; }
+        for (i=0;i<m;i+=4,w+=4*n)
         {
-            // Calculating the linear aggregator
-            // for the current i neuron in the layer
-            // using the following formula:
-            //
-            //  if we are at the first neural layer
-            //
-            //          Ii = Sum ( W(i,j) * vv(j) )
-            //
-            //  Otherwise,for the rest neural layers
-            //
-            //          Ii = Sum ( W(i,j) * prevY(j,0) )
-            // 
-            sum=0.0;
-            for (j=0;j<W->size2;j++)
+            // Four neurons are aggregated side by side,so that
+            // their sums do not wait on each other,yet each one
+            // still adds up its own terms in order.
+            sum[0]=sum[1]=sum[2]=sum[3]=0.0;
+            if (i+4<=m)
             {
-                wij=gsl_matrix_get(W,i,j);
-                if (l==0) { vi=gsl_vector_get(vv,j); }
-                else { vi=gsl_matrix_get(prevY,j,0); }
-                sum+=wij*vi;
+                for (j=0;j<n;j++)
+                {
+                    v=in[j*stride];
+                    sum[0]+=w[j]*v; sum[1]+=w[n+j]*v;
+                    sum[2]+=w[2*n+j]*v; sum[3]+=w[3*n+j]*v;
+                }
+            }
+            else
+            {
+                for (k=0;i+k<m;k++)
+                {
+                    for (j=0;j<n;j++) { sum[k]+=w[k*n+j]*in[j*stride]; }
+                }
+            }
+            for (k=0;k<4 && i+k<m;k++)
+            {
+                I[i+k]=sum[k]; y[i+k]=neuron_activate(nn->config,sum[k]);
             }
-            
-            // Calculating the linear aggregator value
-            // for the current i neuron in the l layer.
-            gsl_matrix_set(I,i,0,sum);
-            temp=gsl_matrix_get(I,i,0);
-
-            // Fetching the above value into the activation function
-            // and the result is stored into the corresponding output
-            // signals matrix cell.We also make sure that we are not
-            // at the final layer of the network,since each signals
-            // output matrix at the hidden layers has an extra cell
-            // containing the bias factor.
-            value=nn->config->activate(&temp,&nn->config->alpha,&nn->config->beta);
-            if (nn->config->nlayers==l+1) { s=i; } else { s=i+1; }
-            gsl_matrix_set(Y,s,0,value);
-
         }
-        
-        // If we are at the hidden layers insert the bias factor -1
-        // at the beginning of the signals output matrix.
-        if (nn->config->nlayers>l+1) { gsl_matrix_set(Y,0,0,-1.0); }
+        in=nn->layers[l]->Y.matrix.data; stride=1;
     } return;
 }
 
 
 
 
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The static function batch_propagate() is the batched forward pass
+ * of a double precision network.The rows are propagated NEURAL_BATCH_ROWS
+ * at a time,every layer being a single matrix multiply of the backend over
+ * the output signals of the previous one,bias column included,followed by
+ * the activation of every row.The output signals of the last layer are
+ * written straight into the given results matrix.On the default backend
+ * every linear aggregator is the same sum as in forward_propagate(),so are
+ * the results.Every layer keeps a slot of packed weights for the whole call,
+ * so the weights are packed once per prediction rather than once per batch.
+ * The signals of the layers are not left behind,neural_net_activate() gives
+ * the ones of a single row.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  gsl_matrix      *data
+ * @param:  gsl_matrix      *results
+ * @return: void
+ *
+ */
+
+static void batch_propagate(neural_net_t *nn,gsl_matrix *data,gsl_matrix *results)
+{
+    // Variable declarations,two buffers of
+    // output signals wide enough for the widest
+    // layer and a slot of packed weights per layer.
+    size_t i,l,m,r0,rows,ldx,ldc,width=0; double *in=NULL,*out=NULL,*y=NULL;
+    size_t nlayers=(size_t )nn->config->nlayers; double *buffer[2];
+    gsl_matrix *W=NULL; void **packed=NULL;
+    for (l=0;l<nlayers;l++)
+    {
+        W=neural_layer_getW(nn->layers[l]);
+        if (W->size1+1>width) { width=W->size1+1; }
+    }
+    buffer[0]=(double *)malloc(NEURAL_BATCH_ROWS*width*sizeof(double ));
+    buffer[1]=(double *)malloc(NEURAL_BATCH_ROWS*width*sizeof(double ));
+    packed=(void **)calloc(nlayers,sizeof(void *));
+    assert(buffer[0]!=NULL && buffer[1]!=NULL && packed!=NULL);
+
+    for (r0=0;r0<data->size1;r0+=NEURAL_BATCH_ROWS)
+    {
+        rows=(data->size1-r0<NEURAL_BATCH_ROWS ? data->size1-r0 : NEURAL_BATCH_ROWS);
+        in=data->data+r0*data->tda; ldx=data->tda;
+        for (l=0;l<nlayers;l++)
+        {
+            // A hidden layer leaves its output signals after
+            // a bias column in one of the buffers,the output
+            // layer leaves them in the results matrix.
+            W=neural_layer_getW(nn->layers[l]); m=W->size1;
+            if (l+1<nlayers) { y=buffer[l%2]; out=y+1; ldc=m+1; }
+            else { y=NULL; out=results->data+r0*results->tda; ldc=results->tda; }
+            neural_backend.gemm(rows,m,W->size2,in,ldx,W->data,W->tda,out,ldc,&packed[l]);
+            for (i=0;i<rows;i++)
+            {
+                neural_backend.apply(nn->config,m,out+i*ldc,out+i*ldc);
+                if (y!=NULL) { y[i*ldc]=-1.0; }
+            }
+            in=y; ldx=ldc;
+        }
+    }
+    for (l=0;l<nlayers;l++) { neural_backend_release(packed[l]); }
+    free(packed); free(buffer[0]); free(buffer[1]);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers in
+ *                          the neural network and ( m x n ) are
+ *                          the dimensions of the largest synaptic
+ *                          weights matrix.
+ *
+ * The function neural_net_activate() takes two arguments as parameters,
+ * namely a neural network data structure and a vector of input signals
+ * that starts with the bias value.It forward propagates the single sample
+ * and returns the output signals matrix of the output layer.The returned
+ * matrix belongs to the network and is overwritten by the next sample,so
+ * unlike neural_net_predict() no memory has to be released by the caller.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  gsl_vector      *signals
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_net_activate(neural_net_t *nn,gsl_vector *signals)
+{
+    assert(nn!=NULL && signals!=NULL);
+    if (nn->config->precision==PRECISION_F32) { return neural_float_activate(nn,signals); }
+    if (nn->tiny && !profiler_enabled) { tiny_propagate(nn,signals->data,signals->stride); }
+    else { forward_propagate(nn,signals); }
+    return neural_layer_getY(nn->layers[nn->config->nlayers-1]);
+}
+
+
+
+
 /*
  * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows in the
  *                              input dataset,l is the number of layers
@@ -255,7 +719,16 @@ gsl_matrix *neural_net_predict(neural_net_t *nn,gsl_matrix *data)
     // of the neural network and allocating memory for the new
     // results matrix based on the dimensions of the Y matrix.
     output_Y=neural_layer_getY(nn->layers[nn->config->nlayers-1]);
+    if (nn->config->precision==PRECISION_F32) { output_Y=&nn->output.matrix; }
     results_matrix=gsl_matrix_alloc(data->size1,output_Y->size1);
+
+    // A double precision network that is not tiny propagates
+    // a large enough dataset a batch of rows at a time.
+    if (nn->config->precision==PRECISION_F64 && !nn->tiny && data->size1>=NEURAL_BATCH_MIN && !profiler_enabled)
+    {
+        batch_propagate(nn,data,results_matrix);
+        return results_matrix;
+    }
     
     // Iterating over the rows given datasets
     for (i=0;i<data->size1;i++)
@@ -266,7 +739,9 @@ gsl_matrix *neural_net_predict(neural_net_t *nn,gsl_matrix *data)
         // predict or classify the corresponding
         // output signals values.
         row_vector=gsl_matrix_row(data,i); 
-        forward_propagate(nn,&row_vector);
+        if (nn->config->precision==PRECISION_F32) { neural_float_activate(nn,&row_vector.vector); }
+        else if (nn->tiny && !profiler_enabled) { tiny_propagate(nn,row_vector.vector.data,1); }
+        else { forward_propagate(nn,&row_vector); }
 
         
         // Copying the results of the output signals
@@ -323,7 +798,7 @@ void neural_net_train(neural_net_t *nn,gsl_matrix *data)
  * @COMPLEXITY: Theta(l)    where l is the total number of
  *                          layers in the neural network.
  * 
- * The static function config_dump() takes two arguments
+ * The function neural_config_dump() takes two arguments
  * as parameters.The first argument is a neural configuration
  * data structure and the second one a stream data structure.
  * This function saves the field components of the configuration
@@ -335,7 +810,7 @@ void neural_net_train(neural_net_t *nn,gsl_matrix *data)
  *
  */
 
-static void config_dump(neural_config_t *config,FILE *f)
+void neural_config_dump(neural_config_t *config,FILE *f)
 {
     assert(config!=NULL && f!=NULL);
     fwrite(&config->nlayers,sizeof(llint ),1,f);
@@ -358,25 +833,50 @@ static void config_dump(neural_config_t *config,FILE *f)
  *                      of the largest synpatic weights
  *                      matrix in the neural network.
  * 
- * The static function weights_dump() takes two arguments
+ * The static function weights_dump() takes three arguments
  * as parameters.The first argument is a neural_net_t data
- * structure and the second argument is a stream data structure.
- * This function saves the synaptic weights matrices of the
- * neural network as binary into the given stream address.
+ * structure,the second argument is a stream data structure
+ * and the third one the storage format.This function saves
+ * the synaptic weights matrices of the neural network as binary
+ * into the given stream address,as floats for a single precision
+ * network and doubles otherwise.In a half precision format the
+ * four bytes "FP16" or "BF16" come first,followed by the weights
+ * narrowed row by row into two bytes each.
  *
  * @param:  neural_net_t        *nn
  * @param:  FILE                *f
+ * @param:  int                 storage
  * @return: void
  *
  */
 
-static void weights_dump(neural_net_t *nn,FILE *f)
+static void weights_dump(neural_net_t *nn,FILE *f,int storage)
 {
-    size_t l;
-    gsl_matrix *tempW=NULL;
+    size_t l,i,j;
+    gsl_matrix *tempW=NULL; gsl_matrix_float *tempWf=NULL;
+    uint16_t *buffer=NULL; float value;
     assert(nn!=NULL && f!=NULL);
+    if (storage==STORAGE_FP16 || storage==STORAGE_BF16)
+    {
+        fwrite(storage==STORAGE_FP16 ? "FP16" : "BF16",sizeof(char ),4,f);
+        for (l=0;l<nn->config->nlayers;l++)
+        {
+            tempW=neural_layer_getW(nn->layers[l]); tempWf=neural_layer_getW_float(nn->layers[l]);
+            buffer=(uint16_t *)realloc(buffer,(tempWf!=NULL ? tempWf->size2 : tempW->size2)*sizeof(uint16_t ));
+            assert(buffer!=NULL);
+            for (i=0;i<(tempWf!=NULL ? tempWf->size1 : tempW->size1);i++)
+            {
+                for (j=0;j<(tempWf!=NULL ? tempWf->size2 : tempW->size2);j++)
+                {
+                    value=(tempWf!=NULL ? gsl_matrix_float_get(tempWf,i,j) : (float )gsl_matrix_get(tempW,i,j));
+                    buffer[j]=(storage==STORAGE_FP16 ? neural_float_to_half(value) : neural_float_to_bfloat(value));
+                } fwrite(buffer,sizeof(uint16_t ),j,f);
+            }
+        } free(buffer); return;
+    }
     for (l=0;l<nn->config->nlayers;l++)
     {
+        if (nn->config->precision==PRECISION_F32) { gsl_matrix_float_fwrite(f,neural_layer_getW_float(nn->layers[l])); continue; }
         tempW=neural_layer_getW(nn->layers[l]);
         gsl_matrix_fwrite(f,tempW);
     } return;
@@ -394,7 +894,8 @@ static void weights_dump(neural_net_t *nn,FILE *f)
  * as parameters,namely a neural_net_t data structure
  * and a directory name and dumps the configuration data
  * as well as the synaptic weights of the neural network
- * into the given directory folder.
+ * into the given directory folder,in the storage format
+ * of the configuration.
  *
  * @param:  neural_net_t        *nn
  * @param:  char                *directory
@@ -420,10 +921,10 @@ void neural_net_dump(neural_net_t *nn,char *directory)
     strcpy(filepath2,directory);
     strcat(filepath2,weights_name);
     f1=fopen(filepath1,"wb");
-    config_dump(nn->config,f1);
+    neural_config_dump(nn->config,f1);
     fclose(f1); f1=NULL;
     f2=fopen(filepath2,"wb");
-    weights_dump(nn,f2);
+    weights_dump(nn,f2,nn->config->storage);
     fclose(f2); f2=NULL;
     free(filepath2);
     free(filepath1);
@@ -437,11 +938,14 @@ void neural_net_dump(neural_net_t *nn,char *directory)
  *                      of neural layers in the neural
  *                      network data structure.
  * 
- * The static function config_load() takes two arguments
+ * The function neural_config_load() takes two arguments
  * as parameters,namely a neural configuration data structure
  * and a stream data structure and loads the configuration data
  * stored in the corresponding binary file into the given config
- * data structure.
+ * data structure.The momentum is not saved,so a loaded network gets
+ * no velocity,neural_net_momentum() gives it one for training.The precision
+ * is not saved either and is left as the caller has set it.The weights
+ * of a loaded network are saved back in its own precision.
  *
  * @param:  neural_config_nt    *config
  * @param:  FILE                *f
@@ -449,7 +953,7 @@ void neural_net_dump(neural_net_t *nn,char *directory)
  *
  */
 
-static void config_load(neural_config_t *config,FILE *f)
+void neural_config_load(neural_config_t *config,FILE *f)
 {
     size_t bytes=0; bytes+=0;
     assert(config!=NULL && f!=NULL);
@@ -464,11 +968,88 @@ static void config_load(neural_config_t *config,FILE *f)
     bytes=fread(&config->beta,sizeof(double ),1,f);
     bytes=fread(&config->epochs,sizeof(llint ),1,f);
     bytes=fread(&config->atype,sizeof(int ),1,f);
+    config->momentum=0.0;
+    config->storage=STORAGE_NATIVE;
+    config->seed=0;
     return;
 }
 
 
 
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The static function cells_format() takes a neural network and
+ * a weights file as arguments and returns the format of the cells
+ * of the file: PRECISION_F32 if it holds floats,STORAGE_FP16 or
+ * STORAGE_BF16 if it holds half precision values and PRECISION_F64
+ * otherwise.The file holds one cell per synaptic weight of the
+ * network,so the format is told apart by the size of the file and
+ * for half precision by the four bytes in front of the cells.The
+ * stream is left at the first cell.
+ *
+ */
+
+static int cells_format(neural_net_t *nn,FILE *f)
+{
+    size_t l,cells=0; long bytes; char tag[4];
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        cells+=(size_t )nn->config->neurons[l]*(size_t )(l==0 ? nn->config->signals : nn->config->neurons[l-1]+1);
+    }
+    fseek(f,0,SEEK_END); bytes=ftell(f); rewind(f);
+    if (bytes==(long )(cells*sizeof(float ))) { return PRECISION_F32; }
+    if (bytes==(long )(cells*sizeof(uint16_t )+4) && fread(tag,sizeof(char ),4,f)==4)
+    {
+        if (memcmp(tag,"FP16",4)==0) { return STORAGE_FP16; }
+        if (memcmp(tag,"BF16",4)==0) { return STORAGE_BF16; }
+        rewind(f);
+    } return PRECISION_F64;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the read matrix.
+ *
+ * The static function matrix_read() reads the cells of a matrix,
+ * saved in the given format,from the stream into either the double
+ * or the float matrix,whichever one is not NULL.Cells of another
+ * format are widened or narrowed row by row on the way.Zero is
+ * returned on success and a non-zero value if the stream ended early.
+ *
+ */
+
+static int matrix_read(FILE *f,int format,gsl_matrix *m,gsl_matrix_float *mf)
+{
+    size_t i,j,rows,columns,width; int status=0;
+    double *buffer=NULL,value;
+    if (m!=NULL && format==PRECISION_F64)  { return gsl_matrix_fread(f,m); }
+    if (mf!=NULL && format==PRECISION_F32) { return gsl_matrix_float_fread(f,mf); }
+    width=(format==PRECISION_F64 ? sizeof(double ) : format==PRECISION_F32 ? sizeof(float ) : sizeof(uint16_t ));
+    rows=(m!=NULL ? m->size1 : mf->size1); columns=(m!=NULL ? m->size2 : mf->size2);
+    buffer=(double *)malloc(columns*sizeof(double ));
+    assert(buffer!=NULL);
+    for (i=0;status==0 && i<rows;i++)
+    {
+        if (fread(buffer,width,columns,f)!=columns) { status=1; break; }
+        for (j=0;j<columns;j++)
+        {
+            if (format==PRECISION_F64)     { value=buffer[j]; }
+            else if (format==PRECISION_F32) { value=(double )((float *)buffer)[j]; }
+            else if (format==STORAGE_FP16)  { value=(double )neural_float_from_half(((uint16_t *)buffer)[j]); }
+            else                            { value=(double )neural_float_from_bfloat(((uint16_t *)buffer)[j]); }
+            if (m!=NULL) { gsl_matrix_set(m,i,j,value); }
+            else         { gsl_matrix_float_set(mf,i,j,(float )value); }
+        }
+    } free(buffer); return status;
+}
+
+
+
+
 /*
  * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
  *                      of the largest synaptic weights matrix
@@ -478,7 +1059,9 @@ static void config_load(neural_config_t *config,FILE *f)
  * parameters,namely a neural network data structure and a
  * stream data structure and loads the synaptic weights matrices
  * stored in the corresponding binary file into the given neural
- * network data structure.
+ * network data structure.Weights saved in either precision or in
+ * a half precision format are converted into the precision of the
+ * network.
  *
  * @param:  neural_net_t    *nn
  * @param:  FILE            *f
@@ -488,14 +1071,15 @@ static void config_load(neural_config_t *config,FILE *f)
 
 static void weights_load(neural_net_t *nn,FILE *f)
 {
-    size_t l;
+    size_t l; int format;
     assert(nn!=NULL && f!=NULL);
     gsl_matrix *tempW=NULL;
     
+    format=cells_format(nn,f);
     for (l=0;l<nn->config->nlayers;l++)
     {
-        tempW=neural_layer_getW(nn->layers[l]);
-        gsl_matrix_fread(f,tempW);
+        tempW=(nn->config->precision==PRECISION_F32 ? NULL : neural_layer_getW(nn->layers[l]));
+        matrix_read(f,format,tempW,neural_layer_getW_float(nn->layers[l]));
     } return;
 }
         
@@ -513,6 +1097,8 @@ static void weights_load(neural_net_t *nn,FILE *f)
  * structure and loads the synaptic weights and the configuration data
  * into the newly instantiated neural network.Once the loading has been
  * completed the address of the newly created neural net is returned.
+ * The network is created in the precision already set in the given
+ * config,and weights saved in the other precision are converted.
  *
  * @param:  neural_config_t     *config
  * @param:  char                *directory
@@ -539,7 +1125,7 @@ neural_net_t *neural_net_load(neural_config_t *config,char *directory)
     strcpy(filepath2,directory);
     strcat(filepath2,weights_name); 
     f1=fopen(filepath1,"rb");
-    config_load(config,f1);
+    neural_config_load(config,f1);
     fclose(f1); f1=NULL;
     new_nn=neural_net_create(config);
     f2=fopen(filepath2,"rb");
@@ -556,11 +1142,354 @@ neural_net_t *neural_net_load(neural_config_t *config,char *directory)
 
 
 /*
- * @COMPLEXITY: O(l)    where l is the number of layers.
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_net_weight() returns the synaptic weight W(j,i)
+ * of the l-th layer of the given network and neural_net_weight_set()
+ * overwrites it,in whichever precision the network is stored.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  size_t          l
+ * @param:  size_t          j
+ * @param:  size_t          i
+ * @return: double
+ *
+ */
+
+double neural_net_weight(neural_net_t *nn,size_t l,size_t j,size_t i)
+{
+    if (nn->config->precision==PRECISION_F32) { return (double )gsl_matrix_float_get(neural_layer_getW_float(nn->layers[l]),j,i); }
+    return gsl_matrix_get(neural_layer_getW(nn->layers[l]),j,i);
+}
+
+void neural_net_weight_set(neural_net_t *nn,size_t l,size_t j,size_t i,double value)
+{
+    if (nn->config->precision==PRECISION_F32) { gsl_matrix_float_set(neural_layer_getW_float(nn->layers[l]),j,i,(float )value); return; }
+    gsl_matrix_set(neural_layer_getW(nn->layers[l]),j,i,value);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_net_signal() returns the i-th output signal
+ * of the l-th layer of the given network,the bias first at a hidden
+ * layer,in whichever precision the network is stored.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  size_t          l
+ * @param:  size_t          i
+ * @return: double
+ *
+ */
+
+double neural_net_signal(neural_net_t *nn,size_t l,size_t i)
+{
+    if (nn->config->precision==PRECISION_F32) { return (double )gsl_matrix_float_get(neural_layer_getY_float(nn->layers[l]),i,0); }
+    return gsl_matrix_get(neural_layer_getY(nn->layers[l]),i,0);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the length of the file path.
+ *
+ * The function neural_net_path() takes two arguments as parameters,
+ * namely a directory name and a file name starting with a slash,and
+ * returns a newly allocated string holding their concatenation,the
+ * path of the file inside the directory.
+ *
+ * @param:  char    *directory
+ * @param:  char    *name
+ * @return: char    *
+ *
+ */
+
+char *neural_net_path(char *directory,char *name)
+{
+    char *filepath=NULL;
+    filepath=(char *)malloc((strlen(directory)+strlen(name)+1)*sizeof(char ));
+    assert(filepath!=NULL);
+    strcpy(filepath,directory);
+    strcat(filepath,name);
+    return filepath;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the synaptic weights matrix.
+ *
+ * The static function previous_write() writes the synaptic weights
+ * of the previous epoch of the given layer into the given file,which
+ * are the current weights minus their velocity.A layer that trains
+ * without momentum has no velocity and writes its current weights,so
+ * a resumed run starts its momentum term from rest.The checkpoint
+ * format stays the same whichever way the momentum is kept,and the
+ * cells are floats for a single precision network.
+ *
+ */
+
+static int previous_write(neural_layer_t *nl,FILE *f)
+{
+    gsl_matrix *W=neural_layer_getW(nl),*O=NULL;
+    gsl_matrix *V=neural_layer_getV(nl);
+    gsl_matrix_float *Wf=neural_layer_getW_float(nl),*Of=NULL;
+    gsl_matrix_float *Vf=neural_layer_getV_float(nl);
+    int status=0;
+
+    if (Wf!=NULL)
+    {
+        Of=gsl_matrix_float_alloc(Wf->size1,Wf->size2);
+        assert(Of!=NULL); gsl_matrix_float_memcpy(Of,Wf);
+        if (Vf!=NULL) { gsl_matrix_float_sub(Of,Vf); }
+        status=gsl_matrix_float_fwrite(f,Of);
+        gsl_matrix_float_free(Of); return status;
+    }
+    O=gsl_matrix_alloc(W->size1,W->size2); assert(O!=NULL);
+    gsl_matrix_memcpy(O,W);
+    if (V!=NULL) { gsl_matrix_sub(O,V); }
+    status=gsl_matrix_fwrite(f,O);
+    gsl_matrix_free(O); return status;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the largest synaptic weights matrix.
+ *
+ * The static function checkpoint_write() takes four arguments as
+ * parameters,namely a neural network,a directory name,a file name
+ * and a flag that selects what is written into the file: the
+ * configuration ( 0 ),the synaptic weights ( 1 ),the weights of
+ * the previous epoch ( 2 ) or the epoch counter ( 3 ).The file is
+ * first written under a temporary name and then renamed,so that a
+ * crash while writing never leaves a truncated file behind.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  char            *directory
+ * @param:  char            *name
+ * @param:  int             what
+ * @param:  llint           epoch
+ * @return: int
+ *
+ */
+
+static int checkpoint_write(neural_net_t *nn,char *directory,char *name,int what,llint epoch)
+{
+    FILE *f=NULL; size_t l; int status=0;
+    char *filepath=neural_net_path(directory,name);
+    char *temppath=neural_net_path(filepath,".tmp");
+
+    f=fopen(temppath,"wb");
+    if (f==NULL) { free(temppath); free(filepath); return -1; }
+    if (what==0) { neural_config_dump(nn->config,f); }
+    if (what==1) { weights_dump(nn,f,STORAGE_NATIVE); }
+    if (what==2) { for (l=0;l<nn->config->nlayers;l++) { status|=previous_write(nn->layers[l],f); } }
+    if (what==3) { status|=(fwrite(&epoch,sizeof(llint ),1,f)!=1); }
+    status|=fflush(f); status|=fclose(f);
+    if (status==0) { status=rename(temppath,filepath); }
+
+    free(temppath); free(filepath);
+    return status;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the largest synaptic weights matrix.
+ *
+ * The function neural_net_checkpoint() takes three arguments as
+ * parameters,namely a neural network data structure,a directory
+ * name and the number of epochs trained so far.It saves everything
+ * a training run needs to be resumed: the configuration and synaptic
+ * weights in the same format as neural_net_dump(),the weights of the
+ * previous epoch that drive the momentum term into "momentum.bin" and
+ * the epoch counter into "epoch.bin".The epoch counter acts as the commit
+ * marker of the checkpoint,so the one of the previous checkpoint is removed
+ * before any other file is replaced and the new one is written last.A crash
+ * in between leaves a directory without a counter,that is never resumed as
+ * a checkpoint.Zero is returned on success and a non-zero value if a file
+ * could not be written.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  char            *directory
+ * @param:  llint           epoch
+ * @return: int
+ *
+ */
+
+int neural_net_checkpoint(neural_net_t *nn,char *directory,llint epoch)
+{
+    int status=0; char *filepath=NULL;
+    assert(nn!=NULL && directory!=NULL);
+    filepath=neural_net_path(directory,"/epoch.bin");
+    if (unlink(filepath)!=0 && errno!=ENOENT) { status=-1; }
+    free(filepath);
+    if (status!=0) { return status; }
+    status|=checkpoint_write(nn,directory,"/config.bin",0,epoch);
+    status|=checkpoint_write(nn,directory,"/weights.bin",1,epoch);
+    status|=checkpoint_write(nn,directory,"/momentum.bin",2,epoch);
+    if (status==0) { status=checkpoint_write(nn,directory,"/epoch.bin",3,epoch); }
+    return status;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the largest synaptic weights matrix.
+ *
+ * The function neural_net_restore() takes two arguments as parameters,
+ * namely a freshly created neural network data structure and the name
+ * of a dumping or checkpoint directory.It checks that the topology saved
+ * in the directory matches the one of the network and then loads the
+ * synaptic weights into it.If the directory holds a checkpoint,that is an
+ * epoch counter,the weights of the previous epoch are restored as well and
+ * the saved epoch counter is returned,otherwise the momentum term starts
+ * from rest and zero is returned.If the directory cannot be read or its topology differs,-1 is
+ * returned and the network is left untouched.Files saved in either precision
+ * or in a half precision format are converted into the precision of the network.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  char            *directory
+ * @return: llint
+ *
+ */
+
+llint neural_net_restore(neural_net_t *nn,char *directory)
+{
+    // Variable declarations
+    // and type assertions.
+    FILE *f=NULL; size_t l; int status=0;
+    llint epoch=0; char *filepath=NULL;
+    neural_config_t saved; gsl_matrix *V=NULL;
+    gsl_matrix_float *Vf=NULL,*Of=NULL; size_t i; int format;
+    assert(nn!=NULL && directory!=NULL);
+
+    // Loading the saved configuration and comparing
+    // its topology with the one of the given network.
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"rb"); free(filepath);
+    if (f==NULL) { return -1; }
+    neural_config_load(&saved,f); fclose(f);
+    if (saved.nlayers!=nn->config->nlayers || saved.signals!=nn->config->signals) { status=-1; }
+    for (l=0;status==0 && l<nn->config->nlayers;l++) { if (saved.neurons[l]!=nn->config->neurons[l]) { status=-1; } }
+    free(saved.neurons);
+    if (status!=0) { return -1; }
+
+    // Loading the synaptic weights.
+    filepath=neural_net_path(directory,"/weights.bin");
+    f=fopen(filepath,"rb"); free(filepath);
+    if (f==NULL) { return -1; }
+    weights_load(nn,f); fclose(f);
+
+    // Loading the epoch counter and,if the directory holds
+    // a checkpoint,the weights of the previous epoch.The
+    // velocity is the current weights minus the ones of the
+    // previous epoch.Otherwise the previous weights equal the
+    // current ones and the momentum term starts from rest,as
+    // it does after an unfinished checkpoint,whose weights of
+    // the previous epoch may be the ones of an older one.A
+    // network without momentum has no velocity.
+    filepath=neural_net_path(directory,"/epoch.bin");
+    f=fopen(filepath,"rb"); free(filepath);
+    if (f!=NULL) { if (fread(&epoch,sizeof(llint ),1,f)!=1) { epoch=0; } fclose(f); }
+    f=NULL;
+    if (epoch>0)
+    {
+        filepath=neural_net_path(directory,"/momentum.bin");
+        f=fopen(filepath,"rb"); free(filepath);
+    }
+    format=(f!=NULL ? cells_format(nn,f) : PRECISION_F64);
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        V=neural_layer_getV(nn->layers[l]);
+        Vf=neural_layer_getV_float(nn->layers[l]);
+        if (V==NULL && Vf==NULL) { continue; }
+        if (V!=NULL && f!=NULL)
+        {
+            matrix_read(f,format,V,NULL); gsl_matrix_scale(V,-1.0);
+            gsl_matrix_add(V,neural_layer_getW(nn->layers[l]));
+        }
+        else if (V!=NULL) { gsl_matrix_set_zero(V); }
+        if (Vf!=NULL && f!=NULL)
+        {
+            matrix_read(f,format,NULL,Vf); Of=neural_layer_getW_float(nn->layers[l]);
+            for (i=0;i<Vf->size1*Vf->size2;i++) { Vf->data[i]=Of->data[i]-Vf->data[i]; }
+        }
+        else if (Vf!=NULL) { gsl_matrix_float_set_zero(Vf); }
+    } if (f!=NULL) { fclose(f); }
+    return epoch;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers
+ *                          in the neural network and ( m x n ) the
+ *                          dimensions of the largest synaptic weights
+ *                          matrix.
+ *
+ * The function neural_net_momentum() takes two arguments as parameters,
+ * namely a neural network and a momentum rate,and returns a copy of the
+ * network that trains with that momentum.A loaded network has none,so
+ * a model that is fine-tuned with momentum needs the velocity laid out
+ * in a new arena.The configuration of the network is given the momentum,
+ * the synaptic weights are copied,the velocity starts from zero,as no
+ * previous shift exists,and the given network is deallocated.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  double          momentum
+ * @return: neural_net_t    *
+ *
+ */
+
+neural_net_t *neural_net_momentum(neural_net_t *nn,double momentum)
+{
+    llint l; neural_net_t *new_nn=NULL;
+    assert(nn!=NULL);
+    if (momentum==nn->config->momentum) { return nn; }
+    nn->config->momentum=momentum;
+    new_nn=neural_net_create(nn->config);
+    neural_net_threads(new_nn,nn->threads);
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        if (nn->config->precision==PRECISION_F32)
+        {
+            gsl_matrix_float_memcpy(neural_layer_getW_float(new_nn->layers[l]),neural_layer_getW_float(nn->layers[l]));
+            if (neural_layer_getV_float(new_nn->layers[l])!=NULL) { gsl_matrix_float_set_zero(neural_layer_getV_float(new_nn->layers[l])); }
+        }
+        else
+        {
+            gsl_matrix_memcpy(neural_layer_getW(new_nn->layers[l]),neural_layer_getW(nn->layers[l]));
+            if (neural_layer_getV(new_nn->layers[l])!=NULL) { gsl_matrix_set_zero(neural_layer_getV(new_nn->layers[l])); }
+        }
+    }
+    neural_net_free(nn); return new_nn;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
  *
  * The function neural_net_free() takes only one argument
  * as parameter,namely a neural network data structure and
  * deallocates all memory associated with it and it's components.
+ * The worker threads of its split layers,if any,are stopped.
  * The config component is not deallocated as it might have been
  * allocated in the stack or in the heap by the user in which
  * case he is obligated to deallocated it manually himself.
@@ -572,14 +1501,10 @@ neural_net_t *neural_net_load(neural_config_t *config,char *directory)
 
 void neural_net_free(neural_net_t *nn)
 {
-    llint i;
     assert(nn!=NULL);
-    for (i=0;i<nn->config->nlayers;i++)
-    {
-        neural_layer_free(nn->layers[i]);
-        nn->layers[i]=NULL;
-    }
-
+    split_free(nn);
+    free(nn->arena); nn->arena=NULL;
+    free(nn->layers[0]);
     free(nn->layers);
     nn->layers=NULL;
     free(nn); nn=NULL;
@@ -0,0 +1,564 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the int8
+ * quantised inference engine of the
+ * neural network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the string
+ * manipulation library,the mathematics library,
+ * the header file "neural_quant.h" that contains
+ * datatype definitions and function prototypings
+ * regarding the quantised network and the header
+ * file "profiler.h" for the per-layer profiling hooks.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include "neural_quant.h"
+#include "profiler.h"
+
+
+
+
+/*
+ * Defining the largest magnitude of a quantised
+ * value,the number of weights the rows are padded
+ * to a multiple of and the four bytes that open
+ * every file of quantised synaptic weights.
+ *
+ */
+
+#define QUANT_LEVELS        127
+#define QUANT_BLOCK         16
+#define QUANT_MAGIC         "NNQ8"
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The static function quant_alloc() allocates a quantised network
+ * for the given configuration.The quantised weights and the scales
+ * of every layer are laid out in a single zeroed 64-byte aligned
+ * block,each one starting on a cache line of its own.Every row of
+ * weights is padded with zeros to a whole number of blocks.
+ *
+ */
+
+static neural_quant_t *quant_alloc(neural_config_t *config)
+{
+    neural_quant_t *nq=NULL; llint l;
+    size_t size=0,widest=0,q,s; char *block=NULL;
+    void *arena=NULL;
+
+    nq=(neural_quant_t *)malloc(sizeof(*nq));
+    assert(nq!=NULL); nq->config=config;
+    nq->layers=(quant_layer_t *)malloc(config->nlayers*sizeof(quant_layer_t ));
+    assert(nq->layers!=NULL);
+
+    // Measuring the block and the widest layer,the
+    // scratch arrays hold the input signals of any layer.
+    for (l=0;l<config->nlayers;l++)
+    {
+        nq->layers[l].rows=config->neurons[l];
+        nq->layers[l].columns=(l==0 ? config->signals : config->neurons[l-1]+1);
+        nq->layers[l].stride=(nq->layers[l].columns+QUANT_BLOCK-1)/QUANT_BLOCK*QUANT_BLOCK;
+        q=(size_t )(nq->layers[l].rows*nq->layers[l].stride);
+        s=(size_t )nq->layers[l].rows*sizeof(float );
+        size+=(q+NEURAL_NET_ALIGN-1)/NEURAL_NET_ALIGN*NEURAL_NET_ALIGN;
+        size+=(s+NEURAL_NET_ALIGN-1)/NEURAL_NET_ALIGN*NEURAL_NET_ALIGN;
+        if ((size_t )nq->layers[l].stride>widest) { widest=(size_t )nq->layers[l].stride; }
+    }
+    if (posix_memalign(&arena,NEURAL_NET_ALIGN,size)!=0) { arena=NULL; }
+    assert(arena!=NULL); block=(char *)arena;
+    memset(arena,0,size);
+
+    for (l=0;l<config->nlayers;l++)
+    {
+        q=(size_t )(nq->layers[l].rows*nq->layers[l].stride);
+        s=(size_t )nq->layers[l].rows*sizeof(float );
+        nq->layers[l].Q=(int8_t *)block;
+        block+=(q+NEURAL_NET_ALIGN-1)/NEURAL_NET_ALIGN*NEURAL_NET_ALIGN;
+        nq->layers[l].scales=(float *)block;
+        block+=(s+NEURAL_NET_ALIGN-1)/NEURAL_NET_ALIGN*NEURAL_NET_ALIGN;
+        nq->layers[l].input_scale=1.0f;
+    }
+
+    nq->signals=(int8_t *)calloc(widest,sizeof(int8_t ));
+    nq->Y=(double *)malloc(widest*sizeof(double ));
+    nq->output=gsl_matrix_alloc(config->neurons[config->nlayers-1],1);
+    assert(nq->signals!=NULL && nq->Y!=NULL && nq->output!=NULL);
+    return nq;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function quant_round() maps a real value onto the
+ * nearest quantised step of the given inverse scale,saturating at
+ * the largest magnitude.
+ *
+ */
+
+static inline int8_t quant_round(double value,double inverse)
+{
+    long q=lrint(value*inverse);
+    if (q>QUANT_LEVELS)  { q=QUANT_LEVELS;  }
+    if (q<-QUANT_LEVELS) { q=-QUANT_LEVELS; }
+    return (int8_t )q;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of calibration
+ *                              rows,l the number of layers and ( m x n )
+ *                              the dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function neural_quant_create() quantises the given network.Every
+ * row of synaptic weights gets the scale that maps its largest magnitude
+ * onto 127.The rows of the calibration matrix,which start with the input
+ * signals,are then propagated through the original network and the input
+ * signals of every layer get the scale that maps the largest magnitude
+ * seen onto 127.The quantised network shares the configuration of the
+ * given one,which has to outlive it.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  gsl_matrix      *calibration
+ * @return: neural_quant_t  *
+ *
+ */
+
+neural_quant_t *neural_quant_create(neural_net_t *nn,gsl_matrix *calibration)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,j,i,r; double value,largest,*ranges=NULL;
+    neural_quant_t *nq=NULL; quant_layer_t *ql=NULL;
+    gsl_vector_view row;
+    assert(nn!=NULL && calibration!=NULL);
+    assert(calibration->size2>=(size_t )nn->config->signals);
+    nq=quant_alloc(nn->config);
+
+    // Quantising every row of synaptic
+    // weights with a scale of its own.
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        ql=&nq->layers[l];
+        for (j=0;j<(size_t )ql->rows;j++)
+        {
+            largest=0.0;
+            for (i=0;i<(size_t )ql->columns;i++) { value=fabs(neural_net_weight(nn,l,j,i)); if (value>largest) { largest=value; } }
+            ql->scales[j]=(largest>0.0 ? (float )(largest/QUANT_LEVELS) : 1.0f);
+            for (i=0;i<(size_t )ql->columns;i++)
+            {
+                ql->Q[j*ql->stride+i]=quant_round(neural_net_weight(nn,l,j,i),1.0/(double )ql->scales[j]);
+            }
+        }
+    }
+
+    // Calibrating the input signals of every layer on the
+    // largest magnitude seen over the calibration rows.The
+    // input signals of a hidden layer are the output signals
+    // of the previous one,the bias included.
+    ranges=(double *)calloc(nn->config->nlayers,sizeof(double ));
+    assert(ranges!=NULL);
+    for (r=0;r<calibration->size1;r++)
+    {
+        row=gsl_matrix_subrow(calibration,r,0,nn->config->signals);
+        neural_net_activate(nn,&row.vector);
+        for (l=0;l<nn->config->nlayers;l++)
+        {
+            for (i=0;i<(size_t )nq->layers[l].columns;i++)
+            {
+                value=fabs(l==0 ? gsl_vector_get(&row.vector,i) : neural_net_signal(nn,l-1,i));
+                if (value>ranges[l]) { ranges[l]=value; }
+            }
+        }
+    }
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        nq->layers[l].input_scale=(ranges[l]>0.0 ? (float )(ranges[l]/QUANT_LEVELS) : 1.0f);
+    } free(ranges); return nq;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of input signals.
+ *
+ * The static function quant_dot() returns the dot product of a padded
+ * row of quantised weights and the quantised input signals.The products
+ * fit into 16 bits and are summed up in a 32 bit accumulator,which holds
+ * the sum of up to 133,000 input signals without overflowing.The inner
+ * loop has a fixed number of iterations,so the compiler turns it into
+ * packed multiply and add instructions.The padded weights are zeros,so
+ * whatever the padded input signals hold does not count.
+ *
+ */
+
+static int32_t quant_dot(const int8_t *restrict w,const int8_t *restrict x,size_t n)
+{
+    size_t i,k; int32_t sum=0;
+    for (i=0;i<n;i+=QUANT_BLOCK)
+    {
+        for (k=0;k<QUANT_BLOCK;k++) { sum+=(int32_t )((int16_t )w[i+k]*(int16_t )x[i+k]); }
+    } return sum;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers
+ *                          in the neural network and ( m x n )
+ *                          the dimensions of the largest synaptic
+ *                          weights matrix.
+ *
+ * The function neural_quant_activate() is the quantised counterpart
+ * of neural_net_activate().The input signals of every layer are
+ * quantised with the calibrated scale of the layer and every linear
+ * aggregator is computed as an integer dot product,rescaled as:
+ *
+ *      I(j) = Sum ( Q(j,i) * q(i) ) * scales(j) * input_scale
+ *
+ * and fed into the activation function in doubles.The returned
+ * matrix holds the output signals and belongs to the network.
+ *
+ * @param:  neural_quant_t  *nq
+ * @param:  gsl_vector      *signals
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_quant_activate(neural_quant_t *nq,gsl_vector *signals)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,i,j,last; double inverse,step,value;
+    quant_layer_t *ql=NULL; uint64_t t;
+    assert(nq!=NULL && signals!=NULL);
+    assert(signals->size>=(size_t )nq->config->signals);
+    last=nq->config->nlayers-1;
+
+    for (l=0;l<=last;l++)
+    {
+        // Quantising the input signals of the layer,which
+        // are the given ones at the first layer and the
+        // output signals of the previous layer otherwise.
+        t=profiler_begin(); ql=&nq->layers[l];
+        inverse=1.0/(double )ql->input_scale;
+        for (i=0;i<(size_t )ql->columns;i++)
+        {
+            value=(l==0 ? gsl_vector_get(signals,i) : nq->Y[i]);
+            nq->signals[i]=quant_round(value,inverse);
+        }
+
+        // Calculating the linear aggregator and the output
+        // signal of every neuron.The output signals of a
+        // hidden layer are shifted by one cell to make room
+        // for the bias factor.
+        for (j=0;j<(size_t )ql->rows;j++)
+        {
+            step=(double )ql->scales[j]*(double )ql->input_scale;
+            value=(double )quant_dot(ql->Q+j*ql->stride,nq->signals,(size_t )ql->stride)*step;
+            value=nq->config->activate(&value,&nq->config->alpha,&nq->config->beta);
+            if (l==last) { gsl_matrix_set(nq->output,j,0,value); }
+            else         { nq->Y[j+1]=value; }
+        }
+        if (l<last) { nq->Y[0]=-1.0; }
+        profiler_end(PROFILE_FORWARD,l,t,(size_t )(ql->rows*ql->stride+ql->stride)+(size_t )ql->rows*(sizeof(float )+sizeof(double )));
+    } return nq->output;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function neural_quant_predict() is the quantised counterpart
+ * of neural_net_predict() and returns a newly allocated matrix that
+ * holds the output signals of every row of the given matrix.
+ *
+ * @param:  neural_quant_t  *nq
+ * @param:  gsl_matrix      *data
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_quant_predict(neural_quant_t *nq,gsl_matrix *data)
+{
+    size_t i; gsl_matrix *results=NULL;
+    gsl_vector_view row,destination,source;
+    assert(nq!=NULL && data!=NULL);
+    results=gsl_matrix_alloc(data->size1,nq->output->size1);
+    assert(results!=NULL);
+    for (i=0;i<data->size1;i++)
+    {
+        row=gsl_matrix_row(data,i);
+        neural_quant_activate(nq,&row.vector);
+        source=gsl_matrix_column(nq->output,0);
+        destination=gsl_matrix_row(results,i);
+        gsl_vector_memcpy(&destination.vector,&source.vector);
+    } return results;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function neural_quant_compare() propagates every row of the given
+ * dataset through both the quantised and the original network and fills
+ * in the report with how often their strongest output signals agree,the
+ * largest and the mean absolute difference of the output signals and the
+ * size of the weights of either network.If the dataset holds the desired
+ * output signals both networks are also scored on it.
+ *
+ * @param:  neural_quant_t  *nq
+ * @param:  neural_net_t    *nn
+ * @param:  dataset_t       *ds
+ * @param:  quant_report_t  *report
+ * @return: void
+ *
+ */
+
+void neural_quant_compare(neural_quant_t *nq,neural_net_t *nn,dataset_t *ds,quant_report_t *report)
+{
+    // Variable declarations,type
+    // assertions and default values.
+    size_t i,j,l,s,n,best_q,best_y,best_d,agree=0;
+    double y,q,d,min,max,delta,sum=0.0,deltas=0.0;
+    gsl_vector_view row; gsl_matrix *Y=NULL,*Q=NULL;
+    assert(nq!=NULL && nn!=NULL && ds!=NULL && report!=NULL);
+    s=(size_t )nn->config->signals; n=nq->output->size1;
+    memset(report,0,sizeof(*report));
+    report->rows=ds->data->size1;
+    report->targets=(ds->data->size2==s+n);
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        report->bytes+=(size_t )(nq->layers[l].rows*nq->layers[l].columns)+(size_t )nq->layers[l].rows*sizeof(float )+sizeof(float );
+        report->reference_bytes+=(size_t )(nq->layers[l].rows*nq->layers[l].columns)*(nn->config->precision==PRECISION_F32 ? sizeof(float ) : sizeof(double ));
+    }
+    if (report->rows==0) { return; }
+
+    for (i=0;i<report->rows;i++)
+    {
+        // Propagating the row through both networks,each
+        // one keeps its output signals in a matrix of its own.
+        row=gsl_matrix_subrow(ds->data,i,0,s);
+        Q=neural_quant_activate(nq,&row.vector);
+        Y=neural_net_activate(nn,&row.vector);
+        best_q=0; best_y=0; best_d=0;
+        for (j=0;j<n;j++)
+        {
+            y=gsl_matrix_get(Y,j,0); q=gsl_matrix_get(Q,j,0);
+            delta=fabs(y-q); deltas+=delta;
+            if (delta>report->max_delta) { report->max_delta=delta; }
+            if (q>gsl_matrix_get(Q,best_q,0)) { best_q=j; }
+            if (y>gsl_matrix_get(Y,best_y,0)) { best_y=j; }
+            if (report->targets && gsl_matrix_get(ds->data,i,s+j)>gsl_matrix_get(ds->data,i,s+best_d)) { best_d=j; }
+            if (report->targets && ds->type==DATASET_PREDICT)
+            {
+                d=gsl_matrix_get(ds->data,i,s+j);
+                if (ds->minimums!=NULL && ds->maximums!=NULL)
+                {
+                    min=gsl_vector_get(ds->minimums,s+j);
+                    max=gsl_vector_get(ds->maximums,s+j);
+                    q=ds->descaler(min,max,q,2.0,1.0);
+                    d=ds->descaler(min,max,d,2.0,1.0);
+                } sum+=(d-q)*(d-q);
+            }
+        }
+        if (best_q==best_y) { agree++; }
+        if (report->targets && ds->type==DATASET_CLASSIFY && best_q==best_d) { report->quantised.correct++; }
+    }
+
+    report->agreement=(double )agree/(double )report->rows;
+    report->mean_delta=deltas/(double )(report->rows*n);
+    if (!report->targets) { return; }
+
+    // Scoring the original network with the usual
+    // evaluation and the quantised one alike.
+    evaluation_score(nn,ds,NULL,report->rows,&report->reference);
+    report->quantised.test_rows=report->rows;
+    report->quantised.accuracy=(double )report->quantised.correct/(double )report->rows;
+    if (ds->type==DATASET_PREDICT) { report->quantised.rmse=sqrt(sum/(double )(report->rows*n)); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_quant_dump() saves the configuration of the
+ * quantised network into config.bin,in the same format as the one of
+ * neural_net_dump(),and the quantised layers into quantized.bin.The
+ * quantized.bin file starts with the four bytes "NNQ8" and holds per
+ * layer the number of rows and columns as long long integers,the input
+ * scale and the scales of the rows as floats and the quantised weights
+ * row after row as signed bytes,without the padding.
+ *
+ * @param:  neural_quant_t  *nq
+ * @param:  char            *directory
+ * @return: void
+ *
+ */
+
+void neural_quant_dump(neural_quant_t *nq,char *directory)
+{
+    FILE *f=NULL; llint l,j; char *filepath=NULL;
+    quant_layer_t *ql=NULL;
+    assert(nq!=NULL && directory!=NULL);
+
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"wb");
+    if (f==NULL) { fprintf(stderr,"Could not write %s.\n",filepath); exit(EXIT_FAILURE); }
+    neural_config_dump(nq->config,f);
+    fclose(f); free(filepath);
+
+    filepath=neural_net_path(directory,"/quantized.bin");
+    f=fopen(filepath,"wb");
+    if (f==NULL) { fprintf(stderr,"Could not write %s.\n",filepath); exit(EXIT_FAILURE); }
+    fwrite(QUANT_MAGIC,sizeof(char ),4,f);
+    for (l=0;l<nq->config->nlayers;l++)
+    {
+        ql=&nq->layers[l];
+        fwrite(&ql->rows,sizeof(llint ),1,f);
+        fwrite(&ql->columns,sizeof(llint ),1,f);
+        fwrite(&ql->input_scale,sizeof(float ),1,f);
+        fwrite(ql->scales,sizeof(float ),ql->rows,f);
+        for (j=0;j<ql->rows;j++) { fwrite(ql->Q+j*ql->stride,sizeof(int8_t ),ql->columns,f); }
+    } fclose(f); free(filepath);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_quant_load() loads the configuration saved in
+ * the given directory into the given config data structure and the
+ * quantised layers saved next to it.If the quantized.bin file does
+ * not match the configuration the program execution is terminated.
+ *
+ * @param:  neural_config_t     *config
+ * @param:  char                *directory
+ * @return: neural_quant_t      *
+ *
+ */
+
+neural_quant_t *neural_quant_load(neural_config_t *config,char *directory)
+{
+    FILE *f=NULL; llint l,j,rows,columns; char magic[4];
+    char *filepath=NULL; neural_quant_t *nq=NULL;
+    quant_layer_t *ql=NULL; int status=0;
+    assert(config!=NULL && directory!=NULL);
+
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"rb");
+    if (f==NULL) { fprintf(stderr,"Could not open %s.\n",filepath); exit(EXIT_FAILURE); }
+    neural_config_load(config,f);
+    fclose(f); free(filepath);
+    nq=quant_alloc(config);
+
+    filepath=neural_net_path(directory,"/quantized.bin");
+    f=fopen(filepath,"rb");
+    if (f==NULL) { fprintf(stderr,"Could not open %s.\n",filepath); exit(EXIT_FAILURE); }
+    status=(fread(magic,sizeof(char ),4,f)!=4 || memcmp(magic,QUANT_MAGIC,4)!=0);
+    for (l=0;status==0 && l<config->nlayers;l++)
+    {
+        ql=&nq->layers[l];
+        status=(fread(&rows,sizeof(llint ),1,f)!=1 || fread(&columns,sizeof(llint ),1,f)!=1);
+        if (status || rows!=ql->rows || columns!=ql->columns) { status=1; break; }
+        status=(fread(&ql->input_scale,sizeof(float ),1,f)!=1);
+        status=(status || fread(ql->scales,sizeof(float ),rows,f)!=(size_t )rows);
+        for (j=0;status==0 && j<rows;j++) { status=(fread(ql->Q+j*ql->stride,sizeof(int8_t ),columns,f)!=(size_t )columns); }
+    } fclose(f);
+    if (status) { fprintf(stderr,"The quantised model %s does not match its configuration.\n",filepath); exit(EXIT_FAILURE); }
+    free(filepath); return nq;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_quant_exists() returns a non-zero value if the
+ * given directory holds a quantised model and zero otherwise.
+ *
+ * @param:  char    *directory
+ * @return: int
+ *
+ */
+
+int neural_quant_exists(char *directory)
+{
+    char *filepath=NULL; FILE *f=NULL;
+    assert(directory!=NULL);
+    filepath=neural_net_path(directory,"/quantized.bin");
+    f=fopen(filepath,"rb"); free(filepath);
+    if (f==NULL) { return 0; }
+    fclose(f); return 1;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_quant_free() deallocates the quantised network.
+ * The configuration belongs to the caller and is left untouched.
+ *
+ * @param:  neural_quant_t  *nq
+ * @return: void
+ *
+ */
+
+void neural_quant_free(neural_quant_t *nq)
+{
+    assert(nq!=NULL);
+    free(nq->layers[0].Q);
+    free(nq->layers);
+    free(nq->signals); free(nq->Y);
+    gsl_matrix_free(nq->output);
+    free(nq); return;
+}
@@ -0,0 +1,755 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * hyperparameter search over neural
+ * network configurations.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,the
+ * standard assertions library,the standard string
+ * manipulation library,the standard mathematics
+ * library,the gnu random number generation library,
+ * the header file "neural_search.h" that contains the
+ * prototypings of the search procedures,the header
+ * file "neural_utils.h" that contains the training
+ * procedures and the header file "thread_pool.h"
+ * that runs the trials concurrently.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <gsl/gsl_rng.h>
+#include "neural_search.h"
+#include "neural_utils.h"
+#include "thread_pool.h"
+
+
+
+
+/*
+ * Defining a new data structure called search_state_t
+ * that is shared by all trial tasks of a search.The
+ * dataset and the validation split are read-only,while
+ * the best network found so far is protected by a mutex.
+ *
+ */
+
+typedef struct
+{
+    dataset_t           *ds;                    // The shared dataset.
+    size_t              *train;                 // The row indices of the training view.
+    size_t              ntrain;                 // The number of training rows.
+    size_t              *valid;                 // The row indices of the validation view.
+    size_t              nvalid;                 // The number of validation rows.
+    search_trial_t      *best_trial;            // The best trial finished so far.
+    neural_net_t        *best;                  // The trained network of the best trial.
+    pthread_mutex_t     lock;                   // Protects the best trial and network.
+} search_state_t;
+
+
+
+/*
+ * Defining a new data structure called trial_task_t
+ * that binds a trial to the shared search state for
+ * the thread pool.
+ *
+ */
+
+typedef struct
+{
+    search_trial_t      *trial;                 // The trial to run.
+    search_state_t      *state;                 // The shared search state.
+} trial_task_t;
+
+
+
+/*
+ * Defining a new data structure called rung_task_t that
+ * binds a trial to the shared search state for the trial
+ * schedulers.The network and its training session are
+ * kept alive between rungs,so that a surviving trial is
+ * resumed from its in-memory weights and momentum state
+ * instead of being trained again from scratch.
+ *
+ */
+
+typedef struct
+{
+    search_trial_t      *trial;                 // The trial to run.
+    search_state_t      *state;                 // The shared search state.
+    neural_net_t        *nn;                    // The network of the trial,NULL before the first rung.
+    training_session_t  ts;                     // The resumable training session of the network.
+    llint               budget;                 // The epoch budget of the current rung.
+    llint               trained;                // The epochs trained before the current rung.
+} rung_task_t;
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function trial_compare() defines the ranking of the
+ * trials.Trials that reached a larger epoch budget are ranked first,
+ * since trials stopped early by a scheduler were never trained as
+ * long as the survivors.Classification trials are ordered by decreasing validation
+ * accuracy,curve fitting trials by increasing root mean square error.
+ * Ties are broken by the validation mean square error and finally
+ * by the trial number so that the ordering is total.The two wrappers
+ * below adapt it to the comparator interface of qsort().
+ *
+ * @param:  const search_trial_t    *a
+ * @param:  const search_trial_t    *b
+ * @param:  int                     type
+ * @return: int
+ *
+ */
+
+static int trial_compare(const search_trial_t *a,const search_trial_t *b,int type)
+{
+    if (a->budget!=b->budget) { return (a->budget>b->budget ? -1 : 1); }
+    if (type==DATASET_CLASSIFY && a->score.accuracy!=b->score.accuracy) { return (a->score.accuracy>b->score.accuracy ? -1 : 1); }
+    if (type==DATASET_PREDICT && a->score.rmse!=b->score.rmse)          { return (a->score.rmse<b->score.rmse ? -1 : 1); }
+    if (a->loss!=b->loss) { return (a->loss<b->loss ? -1 : 1); }
+    return (a->id<b->id ? -1 : (a->id>b->id ? 1 : 0));
+}
+
+static int trial_compare_classify(const void *a,const void *b)
+{
+    return trial_compare((const search_trial_t *)a,(const search_trial_t *)b,DATASET_CLASSIFY);
+}
+
+static int trial_compare_predict(const void *a,const void *b)
+{
+    return trial_compare((const search_trial_t *)a,(const search_trial_t *)b,DATASET_PREDICT);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(s)    Where s is the number of grid steps.
+ *
+ * The static function range_grid() takes four arguments as parameters,
+ * namely a range,the number of grid steps,a flag indicating whether the
+ * range holds integers and an output array of at least steps cells.It
+ * writes evenly spaced points of the range into the array and returns
+ * their number.Integer ranges are spaced geometrically,so that small
+ * layer widths are explored as densely as large ones,and duplicates
+ * produced by rounding are dropped.
+ *
+ * @param:  search_range_t      r
+ * @param:  llint               steps
+ * @param:  int                 integer
+ * @param:  double              *out
+ * @return: llint
+ *
+ */
+
+static llint range_grid(search_range_t r,llint steps,int integer,double *out)
+{
+    llint i,n=0; double t,value;
+    if (r.lo==r.hi || steps<2) { out[0]=r.lo; return 1; }
+    for (i=0;i<steps;i++)
+    {
+        t=(double )i/(double )(steps-1);
+        if (integer) { value=round(r.lo*pow(r.hi/r.lo,t)); }
+        else         { value=r.lo+t*(r.hi-r.lo); }
+        if (n>0 && out[n-1]==value) { continue; }
+        out[n++]=value;
+    } return n;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function range_sample() draws a random value from the
+ * given range.Integer ranges are sampled log-uniformly and rounded,
+ * continuous ranges are sampled uniformly.
+ *
+ * @param:  search_range_t      r
+ * @param:  int                 integer
+ * @param:  gsl_rng             *random_gen
+ * @return: double
+ *
+ */
+
+static double range_sample(search_range_t r,int integer,gsl_rng *random_gen)
+{
+    double u=gsl_rng_uniform(random_gen);
+    if (r.lo==r.hi) { return r.lo; }
+    if (integer) { return round(exp(log(r.lo)+u*(log(r.hi)-log(r.lo)))); }
+    return r.lo+u*(r.hi-r.lo);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers of the trial.
+ *
+ * The static function trial_setup() fills in the configuration of
+ * a trial with the fixed settings of the search space and the given
+ * sampled hyperparameters.The neurons array is allocated here and is
+ * owned by the trial.When the width is negative every hidden layer
+ * samples its own width from the range of the search space.The initial
+ * weights are seeded with the seed of the search plus the id of the trial.
+ *
+ * @param:  search_trial_t      *trial
+ * @param:  search_space_t      *space
+ * @param:  llint               nlayers
+ * @param:  llint               width
+ * @param:  gsl_rng             *random_gen
+ * @return: void
+ *
+ */
+
+static void trial_setup(search_trial_t *trial,search_space_t *space,llint nlayers,llint width,gsl_rng *random_gen)
+{
+    llint l;
+    neural_config_t *config=&trial->config;
+    config->nlayers=nlayers;
+    config->neurons=(llint *)malloc(nlayers*sizeof(llint ));
+    assert(config->neurons!=NULL);
+    for (l=0;l+1<nlayers;l++)
+    {
+        if (width>0) { config->neurons[l]=width; }
+        else         { config->neurons[l]=(llint )range_sample(space->neurons,1,random_gen); }
+    }
+
+    config->neurons[nlayers-1]=space->outputs;
+    config->signals=space->signals;
+    config->epsilon=space->epsilon;
+    config->epochs=space->epochs;
+    config->train=backpropagation;
+    config->precision=PRECISION_F64;
+    config->storage=STORAGE_NATIVE;
+    config->seed=space->seed+(unsigned long )trial->id;
+    activation_assign(config);
+    memset(&trial->score,0,sizeof(trial->score));
+    trial->budget=space->epochs;
+    trial->loss=0.0; return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(t*l)      Where t is the number of trials and l
+ *                          the largest number of layers.
+ *
+ * The function search_trials_create() takes two arguments as parameters,
+ * namely a search space and the address where the number of trials is
+ * written.For the grid strategy it enumerates the cartesian product of
+ * the grid points of every hyperparameter,using the same width for all
+ * hidden layers of a trial.For the random strategy it samples the given
+ * number of trials independently from the ranges.The returned array must
+ * be released with search_result_free() or by freeing the neurons array
+ * of every trial and the array itself.
+ *
+ * @param:  search_space_t      *space
+ * @param:  llint               *ntrials
+ * @return: search_trial_t      *
+ *
+ */
+
+search_trial_t *search_trials_create(search_space_t *space,llint *ntrials)
+{
+    // Variable declarations
+    // and type assertions.
+    llint i,total,n[6],c[6],a,k;
+    double *points[6];
+    search_trial_t *trials=NULL,*trial=NULL;
+    gsl_rng *random_gen=NULL;
+    assert(space!=NULL && ntrials!=NULL);
+    assert(space->nactivations>0 && space->outputs>0);
+
+    random_gen=gsl_rng_alloc(gsl_rng_taus);
+    gsl_rng_set(random_gen,space->seed);
+
+    if (space->strategy==SEARCH_RANDOM)
+    {
+        // Sampling every trial independently
+        // from the ranges of the search space.
+        total=space->trials;
+        trials=(search_trial_t *)calloc(total,sizeof(search_trial_t ));
+        assert(trials!=NULL);
+        for (i=0;i<total;i++)
+        {
+            trial=&trials[i]; trial->id=i+1;
+            trial->config.atype=space->activations[gsl_rng_uniform_int(random_gen,space->nactivations)];
+            trial->config.eta=range_sample(space->eta,0,random_gen);
+            trial->config.momentum=range_sample(space->momentum,0,random_gen);
+            trial->config.alpha=range_sample(space->alpha,0,random_gen);
+            trial->config.beta=range_sample(space->beta,0,random_gen);
+            trial_setup(trial,space,(llint )round(space->nlayers.lo+gsl_rng_uniform(random_gen)*(space->nlayers.hi-space->nlayers.lo)),-1,random_gen);
+        }
+
+        gsl_rng_free(random_gen);
+        *ntrials=total; return trials;
+    }
+
+    // Computing the grid points of every hyperparameter.The
+    // number of layers is enumerated one by one while the
+    // other ranges are split into the given number of steps.
+    for (k=0;k<6;k++) { points[k]=(double *)malloc((space->steps+space->nlayers.hi+2)*sizeof(double )); assert(points[k]!=NULL); }
+    n[0]=0; for (i=(llint )space->nlayers.lo;i<=(llint )space->nlayers.hi;i++) { points[0][n[0]++]=(double )i; }
+    n[1]=range_grid(space->neurons,space->steps,1,points[1]);
+    n[2]=range_grid(space->eta,space->steps,0,points[2]);
+    n[3]=range_grid(space->momentum,space->steps,0,points[3]);
+    n[4]=range_grid(space->alpha,space->steps,0,points[4]);
+    n[5]=range_grid(space->beta,space->steps,0,points[5]);
+    for (total=space->nactivations,k=0;k<6;k++) { total*=n[k]; }
+
+    // Enumerating the cartesian product with a mixed radix
+    // counter over the grid points and the activation types.
+    trials=(search_trial_t *)calloc(total,sizeof(search_trial_t ));
+    assert(trials!=NULL);
+    for (i=0;i<total;i++)
+    {
+        a=i; for (k=5;k>=0;k--) { c[k]=a%n[k]; a/=n[k]; }
+        trial=&trials[i]; trial->id=i+1;
+        trial->config.atype=space->activations[a%space->nactivations];
+        trial->config.eta=points[2][c[2]];
+        trial->config.momentum=points[3][c[3]];
+        trial->config.alpha=points[4][c[4]];
+        trial->config.beta=points[5][c[5]];
+        trial_setup(trial,space,(llint )points[0][c[0]],(llint )points[1][c[1]],random_gen);
+    }
+
+    for (k=0;k<6;k++) { free(points[k]); }
+    gsl_rng_free(random_gen);
+    *ntrials=total; return trials;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(f(n))     Where f(n) is the time complexity of
+ *                          training the network of the trial.
+ *
+ * The static function trial_run() is the task executed by the
+ * worker threads.It trains a network for the trial quietly on
+ * the training view of the shared dataset,scores it on the
+ * validation view and keeps the network if the trial is the
+ * best one so far.
+ *
+ * @param:  void    *p
+ * @return: void
+ *
+ */
+
+static void trial_run(void *p)
+{
+    trial_task_t *task=(trial_task_t *)p;
+    search_trial_t *trial=task->trial;
+    search_state_t *state=task->state;
+    neural_net_t *nn=NULL,*loser=NULL;
+    training_session_t ts;
+
+    // Training the network on the training view.
+    nn=neural_net_create(&trial->config);
+    neural_net_threads(nn,1);
+    training_session_init(&ts,nn,state->ds->data);
+    ts.index=state->train; ts.rows=state->ntrain; ts.quiet=1;
+    backpropagation_session(nn,state->ds->data,&ts);
+
+    // Scoring the network on the validation view.
+    evaluation_score(nn,state->ds,state->valid,state->nvalid,&trial->score);
+    trial->score.train_rows=state->ntrain;
+    trial->score.epochs=ts.epoch;
+    trial->loss=sample_error_calculate(nn,state->ds->data,state->valid,state->nvalid);
+
+    // Keeping the network if it beats the best one.
+    pthread_mutex_lock(&state->lock);
+    if (state->best_trial==NULL || trial_compare(trial,state->best_trial,state->ds->type)<0)
+    {
+        loser=state->best; state->best=nn;
+        state->best_trial=trial;
+    } else { loser=nn; }
+    pthread_mutex_unlock(&state->lock);
+
+    if (loser!=NULL) { neural_net_free(loser); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(f(n))     Where f(n) is the time complexity of training
+ *                          the network of the trial for one rung.
+ *
+ * The static function rung_run() is the task executed by the worker
+ * threads for the trial schedulers.On the first rung it creates the
+ * network and its training session,on later rungs it resumes them.The
+ * session is trained quietly up to the budget of the current rung and
+ * the network is scored on the validation view.
+ *
+ * @param:  void    *p
+ * @return: void
+ *
+ */
+
+static void rung_run(void *p)
+{
+    rung_task_t *task=(rung_task_t *)p;
+    search_trial_t *trial=task->trial;
+    search_state_t *state=task->state;
+
+    if (task->nn==NULL)
+    {
+        task->nn=neural_net_create(&trial->config);
+        neural_net_threads(task->nn,1);
+        training_session_init(&task->ts,task->nn,state->ds->data);
+        task->ts.index=state->train; task->ts.rows=state->ntrain;
+        task->ts.quiet=1;
+    }
+
+    task->ts.epochs=task->budget;
+    backpropagation_session(task->nn,state->ds->data,&task->ts);
+    evaluation_score(task->nn,state->ds,state->valid,state->nvalid,&trial->score);
+    trial->score.train_rows=state->ntrain;
+    trial->score.epochs=task->ts.epoch;
+    trial->loss=sample_error_calculate(task->nn,state->ds->data,state->valid,state->nvalid);
+    trial->budget=task->budget;
+    return;
+}
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function rung_compare() orders rung tasks by the
+ * validation mean square error of their trials,breaking ties by
+ * the trial number.It is used to pick the survivors of a rung.
+ *
+ * @param:  const void  *a
+ * @param:  const void  *b
+ * @return: int
+ *
+ */
+
+static int rung_compare(const void *a,const void *b)
+{
+    const search_trial_t *ta=(*(rung_task_t *const *)a)->trial;
+    const search_trial_t *tb=(*(rung_task_t *const *)b)->trial;
+    if (ta->loss!=tb->loss) { return (ta->loss<tb->loss ? -1 : 1); }
+    return (ta->id<tb->id ? -1 : (ta->id>tb->id ? 1 : 0));
+}
+
+
+
+/*
+ * @COMPLEXITY: O(n*f(n))   Where n is the number of trials of the bracket
+ *                          and f(n) the time complexity of training one
+ *                          trial for the full epoch limit.
+ *
+ * The static function successive_halving() runs one bracket of the
+ * successive halving scheduler.All n trials are trained concurrently
+ * up to the initial budget,ranked by their validation mean square error
+ * and only the best 1/reduction of them survive.The survivors resume from
+ * their in-memory weights with a budget that is reduction times larger,
+ * until the epoch limit is reached.A lone survivor is trained straight to
+ * the limit.The networks of the final survivors are offered to the best
+ * network selection of the search state,all other networks are released.
+ *
+ * @param:  search_state_t      *state
+ * @param:  thread_pool_t       *pool
+ * @param:  search_trial_t      *trials
+ * @param:  llint               n
+ * @param:  llint               budget
+ * @param:  llint               limit
+ * @param:  llint               reduction
+ * @return: llint
+ *
+ */
+
+static llint successive_halving(search_state_t *state,thread_pool_t *pool,search_trial_t *trials,llint n,llint budget,llint limit,llint reduction)
+{
+    // Variable declarations and allocating
+    // the tasks of the bracket.
+    llint i,alive=n,keep,used=0;
+    rung_task_t *tasks=NULL,**rung=NULL;
+    tasks=(rung_task_t *)calloc(n,sizeof(rung_task_t ));
+    rung=(rung_task_t **)malloc(n*sizeof(rung_task_t *));
+    assert(tasks!=NULL && rung!=NULL);
+    for (i=0;i<n;i++)
+    {
+        tasks[i].trial=&trials[i]; tasks[i].state=state;
+        tasks[i].nn=NULL; rung[i]=&tasks[i];
+    }
+
+    for (;;)
+    {
+        // Training the surviving trials of
+        // the rung up to the current budget.
+        if (budget>limit) { budget=limit; }
+        for (i=0;i<alive;i++)
+        {
+            rung[i]->budget=budget;
+            rung[i]->trained=rung[i]->ts.epoch;
+            thread_pool_submit(pool,rung_run,rung[i]);
+        }
+        thread_pool_wait(pool);
+        for (i=0;i<alive;i++) { used+=rung[i]->ts.epoch-rung[i]->trained; }
+        if (budget>=limit) { break; }
+
+        // Keeping the best 1/reduction of the trials
+        // by validation loss and releasing the rest.
+        qsort(rung,alive,sizeof(rung_task_t *),rung_compare);
+        keep=alive/reduction; if (keep<1) { keep=1; }
+        for (i=keep;i<alive;i++) { neural_net_free(rung[i]->nn); rung[i]->nn=NULL; }
+        alive=keep; budget=(alive==1 ? limit : budget*reduction);
+    }
+
+    // Offering the final survivors to the
+    // best network selection of the search.
+    for (i=0;i<alive;i++)
+    {
+        if (state->best_trial==NULL || trial_compare(rung[i]->trial,state->best_trial,state->ds->type)<0)
+        {
+            if (state->best!=NULL) { neural_net_free(state->best); }
+            state->best=rung[i]->nn; state->best_trial=rung[i]->trial;
+        } else { neural_net_free(rung[i]->nn); }
+        rung[i]->nn=NULL;
+    }
+
+    free(rung); free(tasks);
+    return used;
+}
+
+
+
+/*
+ * @COMPLEXITY: O(log(R/r))     Where R is the epoch limit and r the
+ *                              epoch budget of the first rung.
+ *
+ * The static function hyperband_brackets() computes the brackets of
+ * the hyperband scheduler.Bracket s starts ceil((smax+1)/(s+1)*eta^s)
+ * trials with a budget of R/eta^s epochs,where smax is the largest s
+ * for which that budget is not smaller than the first rung budget.The
+ * number of trials and the initial budget of every bracket are written
+ * into the given arrays,which must hold 64 cells,and the number of
+ * brackets is returned.
+ *
+ * @param:  search_space_t      *space
+ * @param:  llint               *counts
+ * @param:  llint               *budgets
+ * @return: llint
+ *
+ */
+
+static llint hyperband_brackets(search_space_t *space,llint *counts,llint *budgets)
+{
+    llint s,smax=0,i,power,nbrackets=0;
+    double eta=(double )space->reduction;
+    while (smax<63 && (double )space->min_epochs*pow(eta,smax+1)<=(double )space->epochs) { smax++; }
+    for (s=smax;s>=0;s--)
+    {
+        for (power=1,i=0;i<s;i++) { power*=space->reduction; }
+        counts[nbrackets]=(llint )ceil((double )(smax+1)/(double )(s+1)*(double )power);
+        budgets[nbrackets]=space->epochs/power;
+        if (budgets[nbrackets]<1) { budgets[nbrackets]=1; }
+        nbrackets++;
+    } return nbrackets;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(t*f(n))   Where t is the number of trials and f(n) the
+ *                          time complexity of training a single trial,
+ *                          divided across the worker threads.
+ *
+ * The function search_run() takes two arguments as parameters,namely
+ * a search space and a loaded and optionally normalized dataset.The
+ * rows are split once into a training and a validation view,then every
+ * trial of the search space is trained concurrently against the same
+ * in-memory dataset matrix,either for the full epoch limit or under the
+ * successive halving or hyperband scheduler of the search space.The
+ * returned result holds the trials ranked from best to worst and the
+ * trained network of the best trial.
+ *
+ * @param:  search_space_t      *space
+ * @param:  dataset_t           *ds
+ * @return: search_result_t     *
+ *
+ */
+
+search_result_t *search_run(search_space_t *space,dataset_t *ds)
+{
+    // Variable declarations
+    // and type assertions.
+    llint i,b,nbrackets=0,offset;
+    llint counts[64],budgets[64];
+    size_t *perm=NULL,n;
+    search_state_t state;
+    search_space_t sampled;
+    trial_task_t *tasks=NULL;
+    thread_pool_t *pool=NULL;
+    search_result_t *sr=NULL;
+    assert(space!=NULL && ds!=NULL);
+
+    // Allocating the result and sampling the trials.The
+    // hyperband scheduler decides the number of trials
+    // itself and always samples them randomly.
+    sr=(search_result_t *)malloc(sizeof(*sr));
+    assert(sr!=NULL); sampled=*space;
+    if (space->scheduler==SCHEDULE_HYPERBAND)
+    {
+        nbrackets=hyperband_brackets(space,counts,budgets);
+        sampled.strategy=SEARCH_RANDOM; sampled.trials=0;
+        for (b=0;b<nbrackets;b++) { sampled.trials+=counts[b]; }
+    }
+    sr->trials=search_trials_create(&sampled,&sr->ntrials);
+    sr->best=NULL; sr->epochs_used=0;
+    sr->epochs_full=sr->ntrials*space->epochs;
+
+    // Splitting the rows into a validation view that
+    // holds the given fraction of a random permutation
+    // and a training view that holds the rest.
+    n=ds->data->size1;
+    perm=evaluation_permutation(n,space->seed);
+    state.ds=ds;
+    state.nvalid=(size_t )ceil(space->holdout*(double )n);
+    if (state.nvalid<1) { state.nvalid=1; }
+    if (state.nvalid>=n) { state.nvalid=n-1; }
+    state.valid=perm; state.ntrain=n-state.nvalid;
+    state.train=perm+state.nvalid;
+    state.best_trial=NULL; state.best=NULL;
+    pthread_mutex_init(&state.lock,NULL);
+    pool=thread_pool_create(space->threads);
+
+    if (space->scheduler==SCHEDULE_HALVING)
+    {
+        // Running a single successive halving bracket
+        // over all trials of the search space.
+        sr->epochs_used=successive_halving(&state,pool,sr->trials,sr->ntrials,
+            space->min_epochs,space->epochs,space->reduction);
+    }
+    else if (space->scheduler==SCHEDULE_HYPERBAND)
+    {
+        // Running the hyperband brackets one after the
+        // other,each on its own slice of the trials.
+        for (offset=0,b=0;b<nbrackets;b++)
+        {
+            sr->epochs_used+=successive_halving(&state,pool,sr->trials+offset,counts[b],
+                budgets[b],space->epochs,space->reduction);
+            offset+=counts[b];
+        }
+    }
+    else
+    {
+        // Running all trials on the thread pool
+        // for the full epoch limit.
+        tasks=(trial_task_t *)malloc(sr->ntrials*sizeof(trial_task_t ));
+        assert(tasks!=NULL);
+        for (i=0;i<sr->ntrials;i++)
+        {
+            tasks[i].trial=&sr->trials[i]; tasks[i].state=&state;
+            thread_pool_submit(pool,trial_run,&tasks[i]);
+        }
+        thread_pool_wait(pool);
+        for (i=0;i<sr->ntrials;i++) { sr->epochs_used+=sr->trials[i].score.epochs; }
+        free(tasks);
+    }
+    thread_pool_free(pool); pool=NULL;
+
+    // Ranking the trials.The ranking uses the same total order
+    // as the best network selection,so the best network belongs
+    // to the first trial and has to point at its configuration.
+    qsort(sr->trials,sr->ntrials,sizeof(search_trial_t ),
+        (ds->type==DATASET_CLASSIFY ? trial_compare_classify : trial_compare_predict));
+    sr->best=state.best;
+    if (sr->best!=NULL) { sr->best->config=&sr->trials[0].config; }
+
+    pthread_mutex_destroy(&state.lock);
+    free(perm);
+    return sr;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(t*l)      Where t is the number of trials and l
+ *                          the largest number of layers.
+ *
+ * The function search_report() takes three arguments as parameters,
+ * namely a stream,a search result and the dataset type,and prints the
+ * ranked trials as a whitespace separated table with one header line.
+ *
+ * @param:  FILE                *f
+ * @param:  search_result_t     *sr
+ * @param:  int                 type
+ * @return: void
+ *
+ */
+
+void search_report(FILE *f,search_result_t *sr,int type)
+{
+    llint i,l; char neurons[256]; int len;
+    static const char *names[]={"none","lgst","lnr","htan"};
+    search_trial_t *trial=NULL;
+    assert(f!=NULL && sr!=NULL);
+
+    fprintf(f,"%-5s %-6s %-7s %-16s %-5s %-10s %-10s %-10s %-10s %-7s %-10s %s\n","RANK","TRIAL","LAYERS","NEURONS","ACT",
+        "ETA","MOMENTUM","ALPHA","BETA","EPOCHS",(type==DATASET_CLASSIFY ? "ACCURACY" : "RMSE"),"VAL_MSE");
+    for (i=0;i<sr->ntrials;i++)
+    {
+        trial=&sr->trials[i];
+        len=snprintf(neurons,sizeof(neurons),"[");
+        for (l=0;l<trial->config.nlayers && len<(int )sizeof(neurons);l++)
+        {
+            len+=snprintf(neurons+len,sizeof(neurons)-len,"%lld%s",trial->config.neurons[l],(l+1<trial->config.nlayers ? "," : "]"));
+        }
+
+        fprintf(f,"%-5lld %-6lld %-7lld %-16s %-5s %-10g %-10g %-10g %-10g %-7lld %-10g %g\n",i+1,trial->id,trial->config.nlayers,
+            neurons,names[trial->config.atype],trial->config.eta,trial->config.momentum,trial->config.alpha,trial->config.beta,
+            trial->score.epochs,(type==DATASET_CLASSIFY ? trial->score.accuracy : trial->score.rmse),trial->loss);
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(t)    Where t is the number of trials.
+ *
+ * The function search_result_free() takes one argument as parameter,
+ * namely a search result,and deallocates the best network,the neurons
+ * array of every trial,the trials array and the result itself.
+ *
+ * @param:  search_result_t     *sr
+ * @return: void
+ *
+ */
+
+void search_result_free(search_result_t *sr)
+{
+    llint i;
+    assert(sr!=NULL);
+    if (sr->best!=NULL) { neural_net_free(sr->best); }
+    for (i=0;i<sr->ntrials;i++) { free(sr->trials[i].config.neurons); }
+    free(sr->trials); free(sr); sr=NULL;
+    return;
+}
@@ -0,0 +1,228 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * neuron pruning of the neural network
+ * data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the mathematics
+ * library and the header file "neural_shrink.h"
+ * that contains macro definitions and function
+ * prototypings regarding the neuron pruning.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <math.h>
+#include "neural_shrink.h"
+
+
+
+
+/*
+ * Defining a new data structure called shrink_cell_t
+ * that pairs the score of a hidden neuron with its
+ * index in its layer,so that the neurons of a layer
+ * can be sorted by score.
+ *
+ */
+
+typedef struct
+{
+    double              score;
+    size_t              neuron;
+} shrink_cell_t;
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function cell_compare() orders two cells by increasing
+ * score and cells of the same score by increasing index,so that the
+ * removed neurons do not depend on the sorting algorithm.
+ *
+ */
+
+static int cell_compare(const void *a,const void *b)
+{
+    const shrink_cell_t *x=(const shrink_cell_t *)a;
+    const shrink_cell_t *y=(const shrink_cell_t *)b;
+    if (x->score!=y->score) { return (x->score<y->score ? -1 : 1); }
+    return (x->neuron<y->neuron ? -1 : (x->neuron>y->neuron ? 1 : 0));
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows of the
+ *                              dataset,l the number of layers and
+ *                              ( m x n ) the dimensions of the largest
+ *                              synaptic weights matrix.
+ *
+ * The static function neuron_scores() returns the score of every hidden
+ * neuron of the given network,one array per hidden layer.With RANK_NORM
+ * the score of a neuron is the euclidean norm of its outgoing weights,
+ * the column of the posterior layer's weights it feeds.With RANK_VARIANCE
+ * it is the variance of its output signal over the rows of the dataset,
+ * which start with the input signals.
+ *
+ */
+
+static double **neuron_scores(neural_net_t *nn,int rank,gsl_matrix *data)
+{
+    size_t l,j,k,r,hidden; double **scores=NULL,**means=NULL;
+    double value,delta; gsl_vector_view row;
+    hidden=(size_t )nn->config->nlayers-1;
+    scores=(double **)malloc((hidden>0 ? hidden : 1)*sizeof(double *));
+    means=(double **)malloc((hidden>0 ? hidden : 1)*sizeof(double *));
+    assert(scores!=NULL && means!=NULL);
+    for (l=0;l<hidden;l++)
+    {
+        scores[l]=(double *)calloc(nn->config->neurons[l],sizeof(double ));
+        means[l]=(double *)calloc(nn->config->neurons[l],sizeof(double ));
+        assert(scores[l]!=NULL && means[l]!=NULL);
+    }
+
+    // The outgoing weights of neuron j of layer l are the
+    // column j+1 of the weights of layer l+1,after the bias.
+    for (l=0;rank==RANK_NORM && l<hidden;l++)
+    {
+        for (k=0;k<(size_t )nn->config->neurons[l+1];k++)
+        {
+            for (j=0;j<(size_t )nn->config->neurons[l];j++)
+            {
+                value=neural_net_weight(nn,l+1,k,j+1);
+                scores[l][j]+=value*value;
+            }
+        }
+        for (j=0;j<(size_t )nn->config->neurons[l];j++) { scores[l][j]=sqrt(scores[l][j]); }
+    }
+
+    // The variances are accumulated in a single pass with
+    // Welford's method,the scores holding the sums of the
+    // squared deviations until the last row.
+    for (r=0;rank==RANK_VARIANCE && r<data->size1;r++)
+    {
+        row=gsl_matrix_subrow(data,r,0,nn->config->signals);
+        neural_net_activate(nn,&row.vector);
+        for (l=0;l<hidden;l++)
+        {
+            for (j=0;j<(size_t )nn->config->neurons[l];j++)
+            {
+                value=neural_net_signal(nn,l,j+1); delta=value-means[l][j];
+                means[l][j]+=delta/(double )(r+1);
+                scores[l][j]+=delta*(value-means[l][j]);
+            }
+        }
+    }
+    for (l=0;l<hidden;l++)
+    {
+        for (j=0;rank==RANK_VARIANCE && data->size1>0 && j<(size_t )nn->config->neurons[l];j++) { scores[l][j]/=(double )data->size1; }
+        free(means[l]);
+    } free(means); return scores;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n+l*m*log(m))      Where r is the number of rows of
+ *                                          the dataset,l the number of layers
+ *                                          and ( m x n ) the dimensions of the
+ *                                          largest synaptic weights matrix.
+ *
+ * The function neural_shrink_create() ranks the hidden neurons of the
+ * given network by the given score and removes the given fraction of
+ * the weakest ones from every hidden layer,at least one neuron being
+ * kept per layer.A removed neuron takes its row of the layer's weights
+ * with it and its column of the posterior layer's weights,so the result
+ * is a smaller dense network whose configuration,a copy of the given
+ * network's one with fewer neurons,is written into the given config data
+ * structure.The caller owns the neurons array of it.The dataset is only
+ * read when the neurons are ranked by RANK_VARIANCE and may be NULL
+ * otherwise.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  neural_config_t *config
+ * @param:  double          fraction
+ * @param:  int             rank
+ * @param:  gsl_matrix      *data
+ * @return: neural_net_t    *
+ *
+ */
+
+neural_net_t *neural_shrink_create(neural_net_t *nn,neural_config_t *config,double fraction,int rank,gsl_matrix *data)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,j,i,k,n,removed,hidden,nlayers;
+    double **scores=NULL; size_t **kept=NULL; char *gone=NULL;
+    shrink_cell_t *cells=NULL; neural_net_t *small=NULL;
+    assert(nn!=NULL && config!=NULL && fraction>=0.0 && fraction<1.0);
+    assert(rank==RANK_NORM || (rank==RANK_VARIANCE && data!=NULL));
+    nlayers=(size_t )nn->config->nlayers; hidden=nlayers-1;
+    scores=neuron_scores(nn,rank,data);
+
+    // Copying the configuration and keeping the indices
+    // of the surviving neurons of every layer in their
+    // original order.The output neurons are all kept.
+    *config=*nn->config;
+    config->neurons=(llint *)malloc(nlayers*sizeof(llint ));
+    kept=(size_t **)malloc(nlayers*sizeof(size_t *));
+    assert(config->neurons!=NULL && kept!=NULL);
+    for (l=0;l<nlayers;l++)
+    {
+        n=(size_t )nn->config->neurons[l];
+        kept[l]=(size_t *)malloc(n*sizeof(size_t ));
+        gone=(char *)calloc(n,sizeof(char ));
+        assert(kept[l]!=NULL && gone!=NULL);
+        if (l<hidden)
+        {
+            cells=(shrink_cell_t *)malloc(n*sizeof(shrink_cell_t ));
+            assert(cells!=NULL);
+            for (j=0;j<n;j++) { cells[j].score=scores[l][j]; cells[j].neuron=j; }
+            qsort(cells,n,sizeof(shrink_cell_t ),cell_compare);
+            removed=(size_t )floor(fraction*(double )n+0.5);
+            if (removed>=n) { removed=n-1; }
+            for (j=0;j<removed;j++) { gone[cells[j].neuron]=1; }
+            free(cells); free(scores[l]);
+        }
+        for (j=0,k=0;j<n;j++) { if (!gone[j]) { kept[l][k++]=j; } }
+        config->neurons[l]=(llint )k; free(gone);
+    } free(scores);
+
+    // Copying the surviving rows of every layer.The first
+    // layer keeps every input signal,the others the bias
+    // column and the columns of the surviving neurons of
+    // the previous layer.
+    small=neural_net_create(config);
+    for (l=0;l<nlayers;l++)
+    {
+        for (j=0;j<(size_t )config->neurons[l];j++)
+        {
+            k=kept[l][j];
+            if (l==0)
+            {
+                for (i=0;i<(size_t )config->signals;i++) { neural_net_weight_set(small,l,j,i,neural_net_weight(nn,l,k,i)); }
+                continue;
+            }
+            neural_net_weight_set(small,l,j,0,neural_net_weight(nn,l,k,0));
+            for (i=0;i<(size_t )config->neurons[l-1];i++) { neural_net_weight_set(small,l,j,i+1,neural_net_weight(nn,l,k,kept[l-1][i]+1)); }
+        }
+    }
+    for (l=0;l<nlayers;l++) { free(kept[l]); }
+    free(kept); return small;
+}
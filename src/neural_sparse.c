@@ -0,0 +1,794 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * magnitude pruning and the sparse
+ * inference engine of the neural
+ * network data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the string
+ * manipulation library,the mathematics library,
+ * the header file "neural_sparse.h" that contains
+ * datatype definitions and function prototypings
+ * regarding the pruned network and the header
+ * file "profiler.h" for the per-layer profiling hooks.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include "neural_sparse.h"
+#include "profiler.h"
+
+
+
+
+/*
+ * Defining the four bytes that open every
+ * file of compressed sparse synaptic weights.
+ *
+ */
+
+#define SPARSE_MAGIC        "NNSP"
+
+
+
+
+/*
+ * Defining a new data structure called sparse_cell_t
+ * that pairs the magnitude of a synaptic weight with
+ * its offset in the weights matrix,so that the weights
+ * of a layer can be sorted by magnitude.
+ *
+ */
+
+typedef struct
+{
+    double              magnitude;
+    size_t              cell;
+} sparse_cell_t;
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function cell_compare() orders two cells by increasing
+ * magnitude and cells of the same magnitude by increasing offset,so
+ * that the pruning does not depend on the sorting algorithm.
+ *
+ */
+
+static int cell_compare(const void *a,const void *b)
+{
+    const sparse_cell_t *x=(const sparse_cell_t *)a;
+    const sparse_cell_t *y=(const sparse_cell_t *)b;
+    if (x->magnitude!=y->magnitude) { return (x->magnitude<y->magnitude ? -1 : 1); }
+    return (x->cell<y->cell ? -1 : (x->cell>y->cell ? 1 : 0));
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function network_tda() returns the number of cells
+ * a row of the weights matrix of a layer of the given network
+ * takes up in memory.
+ *
+ */
+
+static size_t network_tda(neural_net_t *nn,size_t l)
+{
+    if (nn->config->precision==PRECISION_F32) { return neural_layer_getW_float(nn->layers[l])->tda; }
+    return neural_layer_getW(nn->layers[l])->tda;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n*log(m*n))   Where l is the number of layers and
+ *                                  ( m x n ) the dimensions of the largest
+ *                                  synaptic weights matrix.
+ *
+ * The function neural_sparse_prune() zeroes the given fraction of the
+ * synaptic weights of every layer of the given network,the ones of the
+ * smallest magnitude.The weights of the bias column are left out,they
+ * are a single weight per neuron.The velocities of the pruned weights
+ * are zeroed as well.The returned mask holds the pruned weights and has
+ * to be deallocated by the caller.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  double          sparsity
+ * @return: sparse_mask_t   *
+ *
+ */
+
+sparse_mask_t *neural_sparse_prune(neural_net_t *nn,double sparsity)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,j,i,n,k,rows,columns,tda;
+    sparse_mask_t *mask=NULL; sparse_cell_t *cells=NULL;
+    assert(nn!=NULL && sparsity>=0.0 && sparsity<=1.0);
+
+    mask=(sparse_mask_t *)malloc(sizeof(*mask));
+    assert(mask!=NULL); mask->nlayers=nn->config->nlayers;
+    mask->counts=(size_t *)calloc(mask->nlayers,sizeof(size_t ));
+    mask->cells=(size_t **)calloc(mask->nlayers,sizeof(size_t *));
+    assert(mask->counts!=NULL && mask->cells!=NULL);
+
+    for (l=0;l<(size_t )nn->config->nlayers;l++)
+    {
+        // Sorting the weights of the layer,the bias
+        // column aside,by increasing magnitude.
+        rows=(size_t )nn->config->neurons[l];
+        columns=(size_t )(l==0 ? nn->config->signals : nn->config->neurons[l-1]+1);
+        tda=network_tda(nn,l); n=rows*(columns-1);
+        cells=(sparse_cell_t *)malloc((n>0 ? n : 1)*sizeof(sparse_cell_t ));
+        assert(cells!=NULL); k=0;
+        for (j=0;j<rows;j++)
+        {
+            for (i=1;i<columns;i++)
+            {
+                cells[k].cell=j*tda+i;
+                cells[k].magnitude=fabs(neural_net_weight(nn,l,j,i)); k++;
+            }
+        }
+        qsort(cells,n,sizeof(sparse_cell_t ),cell_compare);
+
+        // Keeping the offsets of the weights that
+        // fall within the pruned fraction of the layer.
+        mask->counts[l]=(size_t )floor(sparsity*(double )n+0.5);
+        if (mask->counts[l]>n) { mask->counts[l]=n; }
+        mask->cells[l]=(size_t *)malloc((mask->counts[l]>0 ? mask->counts[l] : 1)*sizeof(size_t ));
+        assert(mask->cells[l]!=NULL);
+        for (k=0;k<mask->counts[l];k++) { mask->cells[l][k]=cells[k].cell; }
+        free(cells);
+    }
+    neural_sparse_mask_apply(nn,NULL,mask);
+    return mask;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*p)      Where l is the number of layers and p
+ *                          the largest number of pruned weights
+ *                          of a layer.
+ *
+ * The function neural_sparse_mask_apply() is a row function for the
+ * training session whose user data is a sparse_mask_t data structure.
+ * It sets every pruned synaptic weight of the network and its velocity
+ * back to zero,so a network that is fine-tuned after the pruning only
+ * adjusts the weights that have survived it.The training session is
+ * not used and may be NULL.
+ *
+ * @param:  const void      *n
+ * @param:  const void      *s
+ * @param:  void            *arg
+ * @return: void
+ *
+ */
+
+void neural_sparse_mask_apply(const void *n,const void *s,void *arg)
+{
+    size_t l,k,*cells=NULL; neural_net_t *nn=NULL;
+    sparse_mask_t *mask=NULL; double *w=NULL,*v=NULL;
+    float *wf=NULL,*vf=NULL; gsl_matrix *V=NULL;
+    gsl_matrix_float *Vf=NULL;
+    assert(n!=NULL && arg!=NULL);
+    nn=(neural_net_t *)n; mask=(sparse_mask_t *)arg;
+    assert(mask->nlayers==nn->config->nlayers);
+
+    for (l=0;l<(size_t )mask->nlayers;l++)
+    {
+        cells=mask->cells[l];
+        if (nn->config->precision==PRECISION_F32)
+        {
+            wf=neural_layer_getW_float(nn->layers[l])->data;
+            Vf=neural_layer_getV_float(nn->layers[l]);
+            for (k=0;k<mask->counts[l];k++) { wf[cells[k]]=0.0f; }
+            if (Vf!=NULL) { vf=Vf->data; for (k=0;k<mask->counts[l];k++) { vf[cells[k]]=0.0f; } }
+        }
+        else
+        {
+            w=neural_layer_getW(nn->layers[l])->data;
+            V=neural_layer_getV(nn->layers[l]);
+            for (k=0;k<mask->counts[l];k++) { w[cells[k]]=0.0; }
+            if (V!=NULL) { v=V->data; for (k=0;k<mask->counts[l];k++) { v[cells[k]]=0.0; } }
+        }
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The function neural_sparse_mask_free() deallocates the
+ * given mask of pruned synaptic weights.
+ *
+ * @param:  sparse_mask_t   *mask
+ * @return: void
+ *
+ */
+
+void neural_sparse_mask_free(sparse_mask_t *mask)
+{
+    llint l;
+    assert(mask!=NULL);
+    for (l=0;l<mask->nlayers;l++) { free(mask->cells[l]); }
+    free(mask->cells); free(mask->counts);
+    free(mask); return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The static function sparse_alloc() allocates a sparse network for
+ * the given configuration with empty layers.The scratch arrays hold
+ * the input and the output signals of any layer.
+ *
+ */
+
+static neural_sparse_t *sparse_alloc(neural_config_t *config)
+{
+    neural_sparse_t *ns=NULL; llint l;
+    size_t widest=0;
+
+    ns=(neural_sparse_t *)malloc(sizeof(*ns));
+    assert(ns!=NULL); ns->config=config;
+    ns->layers=(sparse_layer_t *)calloc(config->nlayers,sizeof(sparse_layer_t ));
+    assert(ns->layers!=NULL);
+    for (l=0;l<config->nlayers;l++)
+    {
+        ns->layers[l].rows=config->neurons[l];
+        ns->layers[l].columns=(l==0 ? config->signals : config->neurons[l-1]+1);
+        if ((size_t )ns->layers[l].columns>widest) { widest=(size_t )ns->layers[l].columns; }
+        if ((size_t )ns->layers[l].rows+1>widest)  { widest=(size_t )ns->layers[l].rows+1;  }
+    }
+    ns->X=(double *)malloc(widest*sizeof(double ));
+    ns->Y=(double *)malloc(widest*sizeof(double ));
+    ns->output=gsl_matrix_alloc(config->neurons[config->nlayers-1],1);
+    assert(ns->X!=NULL && ns->Y!=NULL && ns->output!=NULL);
+    return ns;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m+z)  Where m is the number of rows of the layer
+ *                      and z the number of its non-zero weights.
+ *
+ * The static function layer_reserve() allocates the offsets,the
+ * indices and the values of a sparse layer for the given number of
+ * non-zero weights.
+ *
+ */
+
+static void layer_reserve(sparse_layer_t *sl,llint nonzeros)
+{
+    sl->nonzeros=nonzeros;
+    sl->offsets=(uint32_t *)malloc((size_t )(sl->rows+1)*sizeof(uint32_t ));
+    sl->indices=(uint32_t *)malloc((size_t )(nonzeros>0 ? nonzeros : 1)*sizeof(uint32_t ));
+    sl->values=(double *)malloc((size_t )(nonzeros>0 ? nonzeros : 1)*sizeof(double ));
+    assert(sl->offsets!=NULL && sl->indices!=NULL && sl->values!=NULL);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the synaptic weights matrix.
+ *
+ * The static function layer_settle() expands a sparse layer back
+ * into dense rows if its density is not below SPARSE_DENSITY.The
+ * offsets and the indices of a dense layer are released.
+ *
+ */
+
+static void layer_settle(sparse_layer_t *sl)
+{
+    llint j; uint32_t k; double *dense=NULL;
+    if ((double )sl->nonzeros<SPARSE_DENSITY*(double )(sl->rows*sl->columns)) { return; }
+    dense=(double *)calloc((size_t )(sl->rows*sl->columns),sizeof(double ));
+    assert(dense!=NULL);
+    for (j=0;j<sl->rows;j++)
+    {
+        for (k=sl->offsets[j];k<sl->offsets[j+1];k++) { dense[j*sl->columns+sl->indices[k]]=sl->values[k]; }
+    }
+    free(sl->offsets); free(sl->indices); free(sl->values);
+    sl->offsets=NULL; sl->indices=NULL; sl->values=dense;
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_sparse_create() gathers the non-zero synaptic
+ * weights of every layer of the given network,which is usually a
+ * pruned one,into compressed sparse rows.The layers that are too
+ * dense for the sparse kernel are kept in dense rows.The sparse
+ * network shares the configuration of the given one,which has to
+ * outlive it.
+ *
+ * @param:  neural_net_t    *nn
+ * @return: neural_sparse_t *
+ *
+ */
+
+neural_sparse_t *neural_sparse_create(neural_net_t *nn)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,j,i; llint nonzeros;
+    double value; neural_sparse_t *ns=NULL;
+    sparse_layer_t *sl=NULL; uint32_t k;
+    assert(nn!=NULL);
+    ns=sparse_alloc(nn->config);
+
+    for (l=0;l<(size_t )nn->config->nlayers;l++)
+    {
+        // Counting the non-zero weights of the layer
+        // and copying them row after row with their
+        // columns into the compressed sparse rows.
+        sl=&ns->layers[l]; nonzeros=0;
+        for (j=0;j<(size_t )sl->rows;j++)
+        {
+            for (i=0;i<(size_t )sl->columns;i++) { if (neural_net_weight(nn,l,j,i)!=0.0) { nonzeros++; } }
+        }
+        layer_reserve(sl,nonzeros); k=0;
+        for (j=0;j<(size_t )sl->rows;j++)
+        {
+            sl->offsets[j]=k;
+            for (i=0;i<(size_t )sl->columns;i++)
+            {
+                value=neural_net_weight(nn,l,j,i);
+                if (value!=0.0) { sl->indices[k]=(uint32_t )i; sl->values[k]=value; k++; }
+            }
+        }
+        sl->offsets[sl->rows]=k;
+        layer_settle(sl);
+    } return ns;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(z)    Where z is the number of non-zero weights.
+ *
+ * The static function sparse_dot() returns the dot product of a row
+ * of compressed non-zero weights and the input signals,each weight
+ * multiplied by the input signal of its column.The products are summed
+ * up in four interleaved partial sums,so that the additions do not wait
+ * on each other.
+ *
+ */
+
+static double sparse_dot(const uint32_t *restrict indices,const double *restrict w,const double *restrict x,size_t n)
+{
+    size_t k; double s0=0.0,s1=0.0,s2=0.0,s3=0.0;
+    for (k=0;k+4<=n;k+=4)
+    {
+        s0+=w[k]*x[indices[k]];     s1+=w[k+1]*x[indices[k+1]];
+        s2+=w[k+2]*x[indices[k+2]]; s3+=w[k+3]*x[indices[k+3]];
+    }
+    for (;k<n;k++) { s0+=w[k]*x[indices[k]]; }
+    return (s0+s1)+(s2+s3);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of input signals.
+ *
+ * The static function dense_dot() returns the dot product of a
+ * dense row of weights and the input signals,summed up in four
+ * partial sums like the one of sparse_dot().
+ *
+ */
+
+static double dense_dot(const double *restrict w,const double *restrict x,size_t n)
+{
+    size_t i; double s0=0.0,s1=0.0,s2=0.0,s3=0.0;
+    for (i=0;i+4<=n;i+=4)
+    {
+        s0+=w[i]*x[i];     s1+=w[i+1]*x[i+1];
+        s2+=w[i+2]*x[i+2]; s3+=w[i+3]*x[i+3];
+    }
+    for (;i<n;i++) { s0+=w[i]*x[i]; }
+    return (s0+s1)+(s2+s3);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*z)  Where l is the number of layers in
+ *                      the neural network and z the largest
+ *                      number of weights of a layer.
+ *
+ * The function neural_sparse_activate() is the sparse counterpart
+ * of neural_net_activate().The linear aggregator of every neuron of
+ * a sparse layer only goes through the non-zero weights of its row:
+ *
+ *      I(j) = Sum ( values(k) * Y(indices(k)) )  for k in row j
+ *
+ * while the layers kept in dense rows use a plain dot product.The
+ * returned matrix holds the output signals and belongs to the network.
+ *
+ * @param:  neural_sparse_t *ns
+ * @param:  gsl_vector      *signals
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_sparse_activate(neural_sparse_t *ns,gsl_vector *signals)
+{
+    // Variable declarations
+    // and type assertions.
+    size_t l,i,j,last; double value,*x=NULL,*y=NULL,*swap=NULL;
+    sparse_layer_t *sl=NULL; uint64_t t;
+    assert(ns!=NULL && signals!=NULL);
+    assert(signals->size>=(size_t )ns->config->signals);
+    last=ns->config->nlayers-1; x=ns->X; y=ns->Y;
+
+    // The input signals are gathered by column,so they
+    // are copied into a contiguous array first.The output
+    // signals of a layer are the input signals of the next
+    // one,so the two scratch arrays swap their roles.
+    for (i=0;i<(size_t )ns->config->signals;i++) { x[i]=gsl_vector_get(signals,i); }
+    for (l=0;l<=last;l++)
+    {
+        t=profiler_begin(); sl=&ns->layers[l];
+        for (j=0;j<(size_t )sl->rows;j++)
+        {
+            if (sl->indices!=NULL) { value=sparse_dot(sl->indices+sl->offsets[j],sl->values+sl->offsets[j],x,sl->offsets[j+1]-sl->offsets[j]); }
+            else                   { value=dense_dot(sl->values+j*sl->columns,x,(size_t )sl->columns); }
+            value=ns->config->activate(&value,&ns->config->alpha,&ns->config->beta);
+            if (l==last) { gsl_matrix_set(ns->output,j,0,value); }
+            else         { y[j+1]=value; }
+        }
+        if (l<last) { y[0]=-1.0; swap=x; x=y; y=swap; }
+        if (sl->indices!=NULL) { profiler_end(PROFILE_FORWARD,l,t,(size_t )sl->nonzeros*(sizeof(double )+sizeof(uint32_t ))+(size_t )(sl->columns+2*sl->rows)*sizeof(double )); }
+        else                   { profiler_end(PROFILE_FORWARD,l,t,(size_t )(sl->rows*sl->columns+sl->columns+2*sl->rows)*sizeof(double )); }
+    } return ns->output;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*z)    Where r is the number of rows,l the
+ *                          number of layers and z the largest
+ *                          number of weights of a layer.
+ *
+ * The function neural_sparse_predict() is the sparse counterpart
+ * of neural_net_predict() and returns a newly allocated matrix that
+ * holds the output signals of every row of the given matrix.
+ *
+ * @param:  neural_sparse_t *ns
+ * @param:  gsl_matrix      *data
+ * @return: gsl_matrix      *
+ *
+ */
+
+gsl_matrix *neural_sparse_predict(neural_sparse_t *ns,gsl_matrix *data)
+{
+    size_t i; gsl_matrix *results=NULL;
+    gsl_vector_view row,destination,source;
+    assert(ns!=NULL && data!=NULL);
+    results=gsl_matrix_alloc(data->size1,ns->output->size1);
+    assert(results!=NULL);
+    for (i=0;i<data->size1;i++)
+    {
+        row=gsl_matrix_row(data,i);
+        neural_sparse_activate(ns,&row.vector);
+        source=gsl_matrix_column(ns->output,0);
+        destination=gsl_matrix_row(results,i);
+        gsl_vector_memcpy(&destination.vector,&source.vector);
+    } return results;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows,l the
+ *                              number of layers and ( m x n ) the
+ *                              dimensions of the largest synaptic
+ *                              weights matrix.
+ *
+ * The function neural_sparse_compare() propagates every row of the given
+ * dataset through both the pruned and the original network and fills in
+ * the report with how often their strongest output signals agree,the
+ * largest and the mean absolute difference of the output signals,the
+ * number of weights and the size of the weights of either network.If
+ * the dataset holds the desired output signals both networks are also
+ * scored on it.
+ *
+ * @param:  neural_sparse_t *ns
+ * @param:  neural_net_t    *nn
+ * @param:  dataset_t       *ds
+ * @param:  sparse_report_t *report
+ * @return: void
+ *
+ */
+
+void neural_sparse_compare(neural_sparse_t *ns,neural_net_t *nn,dataset_t *ds,sparse_report_t *report)
+{
+    // Variable declarations,type
+    // assertions and default values.
+    size_t i,j,l,s,n,best_p,best_y,best_d,agree=0,cells;
+    double y,p,d,min,max,delta,sum=0.0,deltas=0.0;
+    gsl_vector_view row; gsl_matrix *Y=NULL,*P=NULL;
+    sparse_layer_t *sl=NULL;
+    assert(ns!=NULL && nn!=NULL && ds!=NULL && report!=NULL);
+    s=(size_t )nn->config->signals; n=ns->output->size1;
+    memset(report,0,sizeof(*report));
+    report->rows=ds->data->size1;
+    report->targets=(ds->data->size2==s+n);
+    for (l=0;l<(size_t )nn->config->nlayers;l++)
+    {
+        sl=&ns->layers[l]; cells=(size_t )(sl->rows*sl->columns);
+        report->nonzeros+=(size_t )sl->nonzeros; report->weights+=cells;
+        report->bytes+=(size_t )sl->nonzeros*(sizeof(double )+sizeof(uint32_t ))+(size_t )(sl->rows+1)*sizeof(uint32_t );
+        report->reference_bytes+=cells*(nn->config->precision==PRECISION_F32 ? sizeof(float ) : sizeof(double ));
+        if (sl->indices!=NULL) { report->sparse_layers++; }
+    }
+    if (report->rows==0) { return; }
+
+    for (i=0;i<report->rows;i++)
+    {
+        // Propagating the row through both networks,each
+        // one keeps its output signals in a matrix of its own.
+        row=gsl_matrix_subrow(ds->data,i,0,s);
+        P=neural_sparse_activate(ns,&row.vector);
+        Y=neural_net_activate(nn,&row.vector);
+        best_p=0; best_y=0; best_d=0;
+        for (j=0;j<n;j++)
+        {
+            y=gsl_matrix_get(Y,j,0); p=gsl_matrix_get(P,j,0);
+            delta=fabs(y-p); deltas+=delta;
+            if (delta>report->max_delta) { report->max_delta=delta; }
+            if (p>gsl_matrix_get(P,best_p,0)) { best_p=j; }
+            if (y>gsl_matrix_get(Y,best_y,0)) { best_y=j; }
+            if (report->targets && gsl_matrix_get(ds->data,i,s+j)>gsl_matrix_get(ds->data,i,s+best_d)) { best_d=j; }
+            if (report->targets && ds->type==DATASET_PREDICT)
+            {
+                d=gsl_matrix_get(ds->data,i,s+j);
+                if (ds->minimums!=NULL && ds->maximums!=NULL)
+                {
+                    min=gsl_vector_get(ds->minimums,s+j);
+                    max=gsl_vector_get(ds->maximums,s+j);
+                    p=ds->descaler(min,max,p,2.0,1.0);
+                    d=ds->descaler(min,max,d,2.0,1.0);
+                } sum+=(d-p)*(d-p);
+            }
+        }
+        if (best_p==best_y) { agree++; }
+        if (report->targets && ds->type==DATASET_CLASSIFY && best_p==best_d) { report->pruned.correct++; }
+    }
+
+    report->agreement=(double )agree/(double )report->rows;
+    report->mean_delta=deltas/(double )(report->rows*n);
+    if (!report->targets) { return; }
+
+    // Scoring the original network with the usual
+    // evaluation and the pruned one alike.
+    evaluation_score(nn,ds,NULL,report->rows,&report->reference);
+    report->pruned.test_rows=report->rows;
+    report->pruned.accuracy=(double )report->pruned.correct/(double )report->rows;
+    if (ds->type==DATASET_PREDICT) { report->pruned.rmse=sqrt(sum/(double )(report->rows*n)); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_sparse_dump() saves the configuration of the
+ * sparse network into config.bin,in the same format as the one of
+ * neural_net_dump(),and the layers into sparse.bin.The sparse.bin
+ * file starts with the four bytes "NNSP" and holds per layer the
+ * number of rows,columns and non-zero weights as long long integers,
+ * the offsets of the rows and the columns of the non-zero weights as
+ * unsigned 32 bit integers and the non-zero weights as doubles.The
+ * layers kept in dense rows are saved in the same compressed format.
+ *
+ * @param:  neural_sparse_t *ns
+ * @param:  char            *directory
+ * @return: void
+ *
+ */
+
+void neural_sparse_dump(neural_sparse_t *ns,char *directory)
+{
+    FILE *f=NULL; llint l,j,i; uint32_t k;
+    char *filepath=NULL; sparse_layer_t *sl=NULL;
+    double *w=NULL;
+    assert(ns!=NULL && directory!=NULL);
+
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"wb");
+    if (f==NULL) { fprintf(stderr,"Could not write %s.\n",filepath); exit(EXIT_FAILURE); }
+    neural_config_dump(ns->config,f);
+    fclose(f); free(filepath);
+
+    filepath=neural_net_path(directory,"/sparse.bin");
+    f=fopen(filepath,"wb");
+    if (f==NULL) { fprintf(stderr,"Could not write %s.\n",filepath); exit(EXIT_FAILURE); }
+    fwrite(SPARSE_MAGIC,sizeof(char ),4,f);
+    for (l=0;l<ns->config->nlayers;l++)
+    {
+        sl=&ns->layers[l];
+        fwrite(&sl->rows,sizeof(llint ),1,f);
+        fwrite(&sl->columns,sizeof(llint ),1,f);
+        fwrite(&sl->nonzeros,sizeof(llint ),1,f);
+        if (sl->indices!=NULL)
+        {
+            fwrite(sl->offsets,sizeof(uint32_t ),sl->rows+1,f);
+            fwrite(sl->indices,sizeof(uint32_t ),sl->nonzeros,f);
+            fwrite(sl->values,sizeof(double ),sl->nonzeros,f);
+            continue;
+        }
+
+        // A dense layer is compressed on the fly,the
+        // offsets first,then the columns and the values.
+        for (j=0,k=0;j<=sl->rows;j++)
+        {
+            fwrite(&k,sizeof(uint32_t ),1,f);
+            for (i=0;j<sl->rows && i<sl->columns;i++) { if (sl->values[j*sl->columns+i]!=0.0) { k++; } }
+        }
+        for (w=sl->values,j=0;j<sl->rows*sl->columns;j++)
+        {
+            if (w[j]!=0.0) { k=(uint32_t )(j%sl->columns); fwrite(&k,sizeof(uint32_t ),1,f); }
+        }
+        for (j=0;j<sl->rows*sl->columns;j++) { if (w[j]!=0.0) { fwrite(&w[j],sizeof(double ),1,f); } }
+    } fclose(f); free(filepath);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*m*n)    Where l is the number of layers and
+ *                          ( m x n ) the dimensions of the largest
+ *                          synaptic weights matrix.
+ *
+ * The function neural_sparse_load() loads the configuration saved in
+ * the given directory into the given config data structure and the
+ * sparse layers saved next to it.Every layer that is too dense for
+ * the sparse kernel is expanded into dense rows.If the sparse.bin file
+ * does not match the configuration the program execution is terminated.
+ *
+ * @param:  neural_config_t     *config
+ * @param:  char                *directory
+ * @return: neural_sparse_t     *
+ *
+ */
+
+neural_sparse_t *neural_sparse_load(neural_config_t *config,char *directory)
+{
+    FILE *f=NULL; llint l,j,rows,columns,nonzeros; char magic[4];
+    char *filepath=NULL; neural_sparse_t *ns=NULL;
+    sparse_layer_t *sl=NULL; int status=0;
+    assert(config!=NULL && directory!=NULL);
+
+    filepath=neural_net_path(directory,"/config.bin");
+    f=fopen(filepath,"rb");
+    if (f==NULL) { fprintf(stderr,"Could not open %s.\n",filepath); exit(EXIT_FAILURE); }
+    neural_config_load(config,f);
+    fclose(f); free(filepath);
+    ns=sparse_alloc(config);
+
+    filepath=neural_net_path(directory,"/sparse.bin");
+    f=fopen(filepath,"rb");
+    if (f==NULL) { fprintf(stderr,"Could not open %s.\n",filepath); exit(EXIT_FAILURE); }
+    status=(fread(magic,sizeof(char ),4,f)!=4 || memcmp(magic,SPARSE_MAGIC,4)!=0);
+    for (l=0;status==0 && l<config->nlayers;l++)
+    {
+        sl=&ns->layers[l];
+        status=(fread(&rows,sizeof(llint ),1,f)!=1 || fread(&columns,sizeof(llint ),1,f)!=1 || fread(&nonzeros,sizeof(llint ),1,f)!=1);
+        if (status || rows!=sl->rows || columns!=sl->columns || nonzeros<0 || nonzeros>rows*columns) { status=1; break; }
+        layer_reserve(sl,nonzeros);
+        status=(fread(sl->offsets,sizeof(uint32_t ),rows+1,f)!=(size_t )(rows+1));
+        status=(status || fread(sl->indices,sizeof(uint32_t ),nonzeros,f)!=(size_t )nonzeros);
+        status=(status || fread(sl->values,sizeof(double ),nonzeros,f)!=(size_t )nonzeros);
+        status=(status || sl->offsets[0]!=0 || sl->offsets[rows]!=(uint32_t )nonzeros);
+        for (j=0;status==0 && j<rows;j++) { status=(sl->offsets[j]>sl->offsets[j+1]); }
+        for (j=0;status==0 && j<nonzeros;j++) { status=(sl->indices[j]>=(uint32_t )columns); }
+        if (status==0) { layer_settle(sl); }
+    } fclose(f);
+    if (status) { fprintf(stderr,"The sparse model %s does not match its configuration.\n",filepath); exit(EXIT_FAILURE); }
+    free(filepath); return ns;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function neural_sparse_exists() returns a non-zero value if the
+ * given directory holds a sparse model and zero otherwise.
+ *
+ * @param:  char    *directory
+ * @return: int
+ *
+ */
+
+int neural_sparse_exists(char *directory)
+{
+    char *filepath=NULL; FILE *f=NULL;
+    assert(directory!=NULL);
+    filepath=neural_net_path(directory,"/sparse.bin");
+    f=fopen(filepath,"rb"); free(filepath);
+    if (f==NULL) { return 0; }
+    fclose(f); return 1;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l)    Where l is the number of layers.
+ *
+ * The function neural_sparse_free() deallocates the sparse network.
+ * The configuration belongs to the caller and is left untouched.
+ *
+ * @param:  neural_sparse_t *ns
+ * @return: void
+ *
+ */
+
+void neural_sparse_free(neural_sparse_t *ns)
+{
+    llint l;
+    assert(ns!=NULL);
+    for (l=0;l<ns->config->nlayers;l++)
+    {
+        free(ns->layers[l].offsets);
+        free(ns->layers[l].indices);
+        free(ns->layers[l].values);
+    }
+    free(ns->layers);
+    free(ns->X); free(ns->Y);
+    gsl_matrix_free(ns->output);
+    free(ns); return;
+}
@@ -14,8 +14,12 @@
  * Including the standard output library,
  * the standard utilities library,the standard
  * assertions library,the standard mathematics
- * library and the neural_net.h header file that
- * contains definitions of datatypes and function
+ * library,the unix process libraries used by the
+ * checkpoint writers,the neural_net.h header file,the
+ * neural_float.h header file,the neural_backend.h
+ * header file,the telemetry.h header file and the
+ * profiler.h header file
+ * that contain definitions of datatypes and function
  * prototypings regarding the neural network data
  * structure.
  *
@@ -25,8 +29,14 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <math.h>
+#include <unistd.h>
+#include <sys/wait.h>
 #include "neural_utils.h"
 #include "neural_net.h"
+#include "neural_float.h"
+#include "neural_backend.h"
+#include "telemetry.h"
+#include "profiler.h"
 
 
 
@@ -249,6 +259,41 @@ double linear_derivative(const void *x,const void *a,const void *b)
 
 
 
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function activation_assign() takes one argument as parameter,
+ * namely a neural configuration data structure,and based on the value
+ * of its atype field assigns the address of the corresponding activation
+ * function and it's derivative to the activate and derivative fields.
+ *
+ * @param:  neural_config_t     *config
+ * @return: void
+ *
+ */
+
+void activation_assign(neural_config_t *config)
+{
+    assert(config!=NULL);
+    if (config->atype==ACTIVATION_LGST)
+    {
+        config->activate=logistic_function;
+        config->derivative=logistic_derivative;
+    }
+    else if (config->atype==ACTIVATION_LNR)
+    {
+        config->activate=linear_function;
+        config->derivative=linear_derivative;
+    }
+    else if (config->atype==ACTIVATION_HTAN)
+    {
+        config->activate=hyperbolic_function;
+        config->derivative=hyperbolic_derivative;
+    } return;
+}
+
+
+
 /*
  * @COMPLEXITY: O(m*n)      where ( m x n ) are the dimensions of 
  *                          the desired outputs matrix.
@@ -345,82 +390,89 @@ static void forward_propagate(const void *n,const void *v)
 {
     // Variable declarations and initializations,
     // type assertions and type castings.
-    double wij,vi; double temp,value;
-    size_t i,j,l,s; double sum=0.0;
-    assert(n!=NULL && v!=NULL);
+    size_t l,incx; const double *x=NULL;
+    assert(n!=NULL && v!=NULL); uint64_t t;
     neural_net_t *nn=NULL; gsl_vector *vv=NULL;
+    gsl_matrix *W=NULL,*Y=NULL;
     nn=(neural_net_t *)n; vv=(gsl_vector *)v;
+    x=vv->data; incx=vv->stride;
     
     // Beginning the forward propagation process
     // by iterating through each layer of the network.
     for (l=0;l<nn->config->nlayers;l++)
     {
-        // Retrieving the synaptic weights matrix,the
-        // linear aggregators matrix and the signals output
-        // matrix for the current neural layer data structure.
-        gsl_matrix *W=neural_layer_getW(nn->layers[l]);
-        gsl_matrix *I=neural_layer_getI(nn->layers[l]);
-        gsl_matrix *Y=neural_layer_getY(nn->layers[l]);
-
-        // If we are not at the first neural layer
-        // retrieve the signals output matrix from
-        // the previous neural layer.
-        gsl_matrix *prevY=NULL;
-        if (l>0) { prevY=neural_layer_getY(nn->layers[l-1]); }
-        
-        // Iterating over the synaptic weights
-        // matrix data structure and the corresponding
-        // input signals matrix and calculating the
-        // linear aggregators and output signals.
-        for (i=0;i<W->size1;i++)
-        {
-            // Calculating the linear aggregator
-            // for the current i neuron in the layer
-            // using the following formula:
-            //
-            //  if we are at the first neural layer
-            //
-            //          Ii = Sum ( W(i,j) * vv(j) )
-            //
-            //  Otherwise,for the rest neural layers
-            //
-            //          Ii = Sum ( W(i,j) * prevY(j,0) )
-            // 
-            sum=0.0;
-            for (j=0;j<W->size2;j++)
-            {
-                wij=gsl_matrix_get(W,i,j);
-                if (l==0) { vi=gsl_vector_get(vv,j); }
-                else { vi=gsl_matrix_get(prevY,j,0); }
-                sum+=wij*vi;
-            }
-            
-            // Calculating the linear aggregator value
-            // for the current i neuron in the l layer.
-            gsl_matrix_set(I,i,0,sum);
-            temp=gsl_matrix_get(I,i,0);
-
-            // Fetching the above value into the activation function
-            // and the result is stored into the corresponding output
-            // signals matrix cell.We also make sure that we are not
-            // at the final layer of the network,since each signals
-            // output matrix at the hidden layers has an extra cell
-            // containing the bias factor.
-            value=nn->config->activate(&temp,&nn->config->alpha,&nn->config->beta);
-            if (nn->config->nlayers==l+1) { s=i; } else { s=i+1; }
-            gsl_matrix_set(Y,s,0,value);
+        t=profiler_begin();
+        // Retrieving the synaptic weights matrix and the
+        // signals output matrix for the current neural
+        // layer data structure.
+        W=neural_layer_getW(nn->layers[l]);
+        Y=neural_layer_getY(nn->layers[l]);
 
-        }
-        
-        // If we are at the hidden layers insert the bias factor -1
-        // at the beginning of the signals output matrix.
-        if (nn->config->nlayers>l+1) { gsl_matrix_set(Y,0,0,-1.0); }
+        // Calculating the linear aggregators of the layer:
+        //
+        //          Ii = Sum ( W(i,j) * x(j) )
+        //
+        // where x are the input signals at the first layer
+        // and the output signals of the previous layer at
+        // the rest.Every linear aggregator is then fetched
+        // into the activation function and the result is
+        // stored into the output signals matrix,after the
+        // bias factor -1 at the hidden layers.The neurons
+        // of a wide layer are split across the threads.
+        neural_net_layer_propagate(nn,l,x,incx);
+        x=Y->data; incx=1;
+        profiler_end(PROFILE_FORWARD,l,t,(W->size1*W->size2+W->size2+2*W->size1)*sizeof(double ));
     } return;
 }
 
 
 
 
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the synaptic weights matrix.
+ *
+ * The static function update_plain() adjusts the synaptic weights
+ * of a layer that trains without momentum.It is the rank one update
+ * of the backend,over the signals read with the given stride:
+ *
+ *      W(j,i) = W(j,i) + hta * delta(j) * Y(i)
+ *
+ */
+
+static void update_plain(gsl_matrix *W,gsl_matrix *D,double *y,size_t stride,double eta)
+{
+    neural_backend.ger(W->size1,W->size2,eta,D->data,y,stride,W->data,W->tda);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)  Where ( m x n ) are the dimensions
+ *                      of the synaptic weights matrix.
+ *
+ * The static function update_momentum() adjusts the synaptic weights
+ * of a layer that trains with momentum.The velocity holds the last
+ * shift of every weight,the difference between the weights and their
+ * values from the previous epoch.It is the velocity step of the backend,
+ * which the in-tree kernels take in a single streaming pass:
+ *
+ *      V(j,i) = momentum * V(j,i) + hta * delta(j) * Y(i)
+ *      W(j,i) = W(j,i) + V(j,i)
+ *
+ */
+
+static void update_momentum(gsl_matrix *W,gsl_matrix *V,gsl_matrix *D,double *y,size_t stride,double eta,double momentum)
+{
+    neural_backend.momentum(W->size1,W->size2,eta,momentum,D->data,y,stride,W->data,W->tda,V->data,V->tda);
+    return;
+}
+
+
+
+
 /*
  * @COMPLEXITY: 
  *
@@ -450,12 +502,12 @@ static void backward_propagate(const void *n,const void *in,const void *out)
     // Most of the declared variables have been
     // named in such a way as to provide a detailed
     // walkthrough of the back-propagate procedure.
-    llint l; size_t k,j,i; double wji,wji_o,shift;
-    double yj,dj,value,ij,yi,wkj,dk,sum;
+    llint l; size_t j,stride; uint64_t t;
+    double yj,dj,value,ij,sum,*d,*y;
     assert(n!=NULL && in!=NULL && out!=NULL);
     gsl_matrix *W=NULL; gsl_matrix *I=NULL;
     gsl_matrix *Y=NULL; gsl_matrix *D=NULL;
-    gsl_matrix *O=NULL; gsl_matrix *prevY=NULL;
+    gsl_matrix *V=NULL; gsl_matrix *prevY=NULL;
     gsl_matrix *postW=NULL; gsl_matrix *postD=NULL;
     
 
@@ -465,6 +517,7 @@ static void backward_propagate(const void *n,const void *in,const void *out)
     neural_net_t *nn=NULL; nn=(neural_net_t *)n;
     gsl_vector *input=NULL;input=(gsl_vector *)in;
     gsl_vector *output=NULL; output=(gsl_vector *)out;
+    double eta=nn->config->eta,momentum=nn->config->momentum;
     
     
     // Beginning the iteration from the output layer
@@ -491,16 +544,17 @@ static void backward_propagate(const void *n,const void *in,const void *out)
         // the adjustment of the synaptic weights.
         D=neural_layer_getD(nn->layers[l]);
 
-        // Retrieving the synaptic weights matrix from
-        // the previous training epoch.This matrix will
-        // be used for the optimization technique aka
-        // momentum parameter optimization.
-        O=neural_layer_getO(nn->layers[l]);
+        // Retrieving the velocity of the synaptic weights.
+        // This matrix will be used for the optimization
+        // technique aka momentum parameter optimization
+        // and is null when the momentum is zero.
+        V=neural_layer_getV(nn->layers[l]);
 
         
         // If we are not at the input layer, retrieve the 
         // signals output matrix from the previous layer.
         if (l>0) { prevY=neural_layer_getY(nn->layers[l-1]); }
+        t=profiler_begin();
 
 
         // There are two main stage to the back-propagation
@@ -541,83 +595,67 @@ static void backward_propagate(const void *n,const void *in,const void *out)
             postW=neural_layer_getW(nn->layers[l+1]);
             postD=neural_layer_getD(nn->layers[l+1]); 
 
+            // Before we calculate the local gradient related to the jth neuron,
+            // first we have to sum up the multiplication of the local gradients
+            // and synaptic weights of all neurons of the posterior layer that
+            // are connected to the current jth neuron of the current layer.The
+            // first column of the posterior weights belongs to the bias factor,
+            // so the jth neuron feeds the column j+1 of every posterior neuron:
+            //
+            //      Sum(j) = Sum(j) + posterior_delta(k)*posterior_W(k,j+1)
+            //
+            // The sums are the transposed matrix vector product of the
+            // backend over the posterior weights without their first column,
+            // which the in-tree kernels accumulate row by row,so every row k
+            // is read with unit stride.The current gradient matrix holds the
+            // sums until the derivative is applied.
+            d=D->data;
+            neural_backend.gemtv(postW->size1,D->size1,postW->data+1,postW->tda,postD->data,postD->tda,d);
+
             // Iterating over the elements of the
             // current local gradient matrix.
             for (j=0;j<D->size1;j++)
             {
-                // Before we calculate the local gradient related to the jth neuron,
-                // first we have to sum up the multiplication of the local gradients
-                // and synaptic weights of all neurons of the posterior layer that
-                // are connected to the current jth neuron of the current layer.
-                sum=0.0;
-                for (k=1;k<postW->size1;k++)
-                {
-                    // The summation is calculated using the 
-                    // following formula:
-                    //
-                    //      Sum = Sum + posterior_delta(k)*posterior_W(k,j)
-                    //
-                    // We iterate over all neurons connected to the current
-                    // jth neuron and aggregate the expected desired output value.
-                    wkj=gsl_matrix_get(postW,k,j);
-                    dk=gsl_matrix_get(postD,k,0);
-                    sum+=wkj*dk;
-                }
-                
                 // To calculate the local gradient related to the jth neuron
                 // of the current layer we use sum obtained above and the
                 // following formula:
                 //
-                //      delta(j) = - ( sum ) * g'(I(j))
+                //      delta(j) = ( sum ) * g'(I(j))
                 // 
                 // Where g' is the derivative of the activaion function.
                 // The components of the gradient matrix are overwritten
                 // in-place without needing the allocation of extra memory.
+                sum=d[j*D->tda];
                 ij=gsl_matrix_get(I,j,0);
                 value=nn->config->derivative(&ij,&nn->config->alpha,&nn->config->beta);
-                gsl_matrix_set(D,j,0,-sum*value);
+                d[j*D->tda]=sum*value;
             }
         }
+        if (l+1==nn->config->nlayers) { profiler_end(PROFILE_DELTA,l,t,4*D->size1*sizeof(double )); }
+        else { profiler_end(PROFILE_DELTA,l,t,(postW->size1*D->size1+postW->size1+2*D->size1)*sizeof(double )); }
+        t=profiler_begin();
         
         // Once we have calculate the corresponding local gradient
         // matrix,it is time to adjust the synaptic weights of the
-        // current neural layer.We begin iterating over the rows of
-        // the synaptic weights matrix for the current layer.
-        for (j=0;j<W->size1;j++)
+        // current neural layer.If we are at the hidden layers we
+        // use the output signals of the previous layer otherwise
+        // we use the given input signals.
+        if (l>0)    { y=prevY->data; stride=prevY->tda; }
+        else        { y=input->data; stride=input->stride; }
+
+        // Adjusting the synaptic weights with the kernel that
+        // matches the momentum rate.Without momentum there is
+        // no velocity to read or write,so the weights are the
+        // only matrix streamed through.
+        if (V!=NULL)
         {
-            // Retrieve the current local gradient
-            // related to the jth neuron of the current
-            // neural layer and iterating over the columns
-            // of the synaptic weights matrix.
-            dj=gsl_matrix_get(D,j,0);
-            for (i=0;i<W->size2;i++)
-            {
-                // Retrieving the current value of the synaptic
-                // weights matrix cell and it's value from the
-                // previous training epoch.
-                wji=gsl_matrix_get(W,j,i);
-                wji_o=gsl_matrix_get(O,j,i);
-
-                // Checking if we are at the hidden layers or
-                // we have reach the input layer.If we are at
-                // the hidden layers we use the output signals
-                // of the previous layer otherwise we use the
-                // given input signals.
-                if (l>0)    { yi=gsl_matrix_get(prevY,i,0); }
-                else        { yi=gsl_vector_get(input,i);   }
-                
-                // Calculating the total amount the current synaptic
-                // weights cell is going to be shifted by the following
-                // formula:
-                //
-                //      W(j,i) = W(j,i) + momentum * ( W(j,i) - O(j,i) ) + hta * delta(j) * Y(i)
-                // 
-                // Once the shift has been calculated the cell is updated and
-                // so previous value written into the O matrix.
-                shift=wji+nn->config->momentum*(wji-wji_o)+(nn->config->eta)*dj*yi;
-                gsl_matrix_set(O,j,i,wji);
-                gsl_matrix_set(W,j,i,shift);
-            }
+            update_momentum(W,V,D,y,stride,eta,momentum);
+            profiler_end(PROFILE_UPDATE,l,t,(4*W->size1*W->size2+W->size1+W->size2)*sizeof(double ));
+        }
+        else
+        {
+            update_plain(W,D,y,stride,eta);
+            profiler_end(PROFILE_UPDATE,l,t,(2*W->size1*W->size2+W->size1+W->size2)*sizeof(double ));
         }
     }
     
@@ -629,40 +667,223 @@ static void backward_propagate(const void *n,const void *in,const void *out)
 
 
 /*
- * @COMPLEXITY:
+ * @COMPLEXITY: O(r*n)      Where r is the number of rows in the
+ *                          training view and n the number of
+ *                          desired output signals.
  *
- * The function backpropagation() takes two immutable
- * pointers as arguments.The first one is cast into
- * a neural_net_t pointer and the second one into
- * a gsl_matrix pointer.Once casting has been completed
- * The training samples are seperated from the desired
- * output samples using matrix views.Once the training
- * set X and desired output D have been defined the
- * training process for the neural network begins.
+ * The static function view_error_calculate() is the counterpart of
+ * mean_square_error_calculate() for training views.It evaluates the
+ * same squared error expression but only over the rows listed in the
+ * given index array,or over every row when the index array is NULL.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  gsl_matrix      *D
+ * @param:  size_t          *index
+ * @param:  size_t          rows
+ * @return: double
+ *
+ */
+
+static double view_error_calculate(neural_net_t *nn,gsl_matrix *D,size_t *index,size_t rows)
+{
+    size_t i,j,r; double di,yi;
+    double sum=0.0,total_error=0.0;
+    gsl_matrix *Y=neural_layer_getY(nn->layers[nn->config->nlayers-1]);
+    uint64_t t=profiler_begin();
+
+    if (index==NULL) { total_error=mean_square_error_calculate(nn,D,&rows); }
+    for (i=0;index!=NULL && i<rows;i++)
+    {
+        r=index[i]; sum=0.0;
+        for (j=0;j<D->size2;j++)
+        {
+            di=gsl_matrix_get(D,r,j);
+            yi=gsl_matrix_get(Y,j,0);
+            sum+=pow(di-yi,2);
+        } total_error+=(double )sum/(double )2.0;
+    } if (index!=NULL) { total_error/=(double )rows; }
+    profiler_end(PROFILE_ERROR,0,t,rows*D->size2*sizeof(double ));
+    return total_error;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(r*l*m*n)      Where r is the number of rows in the view,
+ *                              l is the number of layers and ( m x n ) the
+ *                              dimensions of the largest weights matrix.
+ *
+ * The function sample_error_calculate() takes four arguments as
+ * parameters,namely a neural network,a dataset matrix that holds
+ * the bias,signals and desired outputs columns,an array of row
+ * indices and the number of rows in it.Unlike the epoch error of
+ * the training loop every sample is forward propagated before its
+ * squared error is accumulated,which makes the returned mean square
+ * error suitable for scoring held-out validation rows.The rows are
+ * propagated by neural_net_predict(),which batches them.A NULL index
+ * array selects every row of the matrix.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  gsl_matrix      *data
+ * @param:  size_t          *index
+ * @param:  size_t          rows
+ * @return: double
+ *
+ */
+
+double sample_error_calculate(neural_net_t *nn,gsl_matrix *data,size_t *index,size_t rows)
+{
+    size_t i,j,r,s; double di,yi,sum,total_error=0.0;
+    gsl_vector_view src,dest; gsl_matrix *X=NULL,*P=NULL;
+    assert(nn!=NULL && data!=NULL && rows>0);
+    s=nn->config->signals;
+
+    // Gathering the signals of the selected rows,so that
+    // neural_net_predict() can propagate them as a batch.
+    X=gsl_matrix_alloc(rows,s); assert(X!=NULL);
+    for (i=0;i<rows;i++)
+    {
+        r=(index==NULL ? i : index[i]);
+        src=gsl_matrix_subrow(data,r,0,s); dest=gsl_matrix_row(X,i);
+        gsl_vector_memcpy(&dest.vector,&src.vector);
+    }
+    P=neural_net_predict(nn,X);
+
+    for (i=0;i<rows;i++)
+    {
+        // Summing up the squared errors of the
+        // output neurons of the current row.
+        r=(index==NULL ? i : index[i]); sum=0.0;
+        for (j=0;j<P->size2;j++)
+        {
+            di=gsl_matrix_get(data,r,s+j);
+            yi=gsl_matrix_get(P,i,j);
+            sum+=pow(di-yi,2);
+        } total_error+=sum/2.0;
+    }
+    gsl_matrix_free(X); gsl_matrix_free(P);
+    return total_error/(double )rows;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(l*n)      Where l is the number of layers and n
+ *                          the number of neurons of the widest layer.
+ *
+ * The static function gradient_calculate() returns the squared norm of
+ * the gradient of the last backward propagation.The gradient of a layer
+ * is the outer product of its local gradients and its input signals,so
+ * its squared norm is the product of their squared norms and is found
+ * without visiting the synaptic weights.
+ *
+ * @param:  neural_net_t    *nn
+ * @param:  gsl_vector      *input
+ * @return: double
+ *
+ */
+
+static double gradient_calculate(neural_net_t *nn,gsl_vector *input)
+{
+    size_t l; double dd,yy,total=0.0;
+    gsl_matrix *W=NULL,*D=NULL,*prevY=NULL;
+    for (l=0;l<nn->config->nlayers;l++)
+    {
+        W=neural_layer_getW(nn->layers[l]);
+        D=neural_layer_getD(nn->layers[l]);
+        dd=neural_backend.dot(W->size1,D->data,1,D->data,1);
+        if (l>0) { prevY=neural_layer_getY(nn->layers[l-1]); yy=neural_backend.dot(W->size2,prevY->data,1,prevY->data,1); }
+        else { yy=neural_backend.dot(W->size2,input->data,input->stride,input->data,input->stride); }
+        total+=dd*yy;
+    } return total;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function training_session_init() takes three arguments
+ * as parameters,namely a training session data structure,a
+ * neural network and the training dataset matrix.It resets
+ * the session so that it covers every row of the matrix and
+ * uses the epoch limit of the network's configuration.The
+ * progress line is limited to ten per second by default.
+ *
+ * @param:  training_session_t  *ts
+ * @param:  neural_net_t        *nn
+ * @param:  gsl_matrix          *data
+ * @return: void
+ *
+ */
+
+void training_session_init(training_session_t *ts,neural_net_t *nn,gsl_matrix *data)
+{
+    assert(ts!=NULL && nn!=NULL && data!=NULL);
+    ts->index=NULL; ts->rows=data->size1;
+    ts->epoch=0; ts->epochs=nn->config->epochs;
+    ts->mse=1.0; ts->loss=1.0; ts->quiet=0;
+    ts->interval=0.1; ts->printed=0.0;
+    ts->gradients=0; ts->gradient=0.0;
+    ts->stop=0; ts->on_epoch=NULL;
+    ts->arg=NULL; ts->on_row=NULL;
+    ts->row_arg=NULL; return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(e*r*l*m*n)    Where e is the number of epochs,r the number
+ *                              of rows in the training view,l the number of
+ *                              layers and ( m x n ) the dimensions of the
+ *                              largest synaptic weights matrix.
+ *
+ * The function backpropagation_session() takes three immutable
+ * pointers as arguments.The first one is cast into a neural_net_t
+ * pointer,the second one into a gsl_matrix pointer and the third
+ * one into a training_session_t pointer.The training samples are
+ * seperated from the desired output samples using matrix views and
+ * the rows selected by the session are fed through the network until
+ * the convergence limit or the session's epoch budget is reached.The
+ * session keeps the epoch counter and the last error so that a run
+ * can be resumed later with a larger budget.Raising the stop flag
+ * of the session ends the run once the current epoch has finished,
+ * and the epoch function of the session is invoked after every epoch
+ * and its row function after every row.
+ * Single precision networks are trained by the float procedures of
+ * neural_float.c with the same bookkeeping.
  *
  * @param:  const void      *n
  * @param:  const void      *d
+ * @param:  const void      *s
  * @return: void
- * 
+ *
  */
 
-void backpropagation(const void *n,const void *d)
+void backpropagation_session(const void *n,const void *d,const void *s)
 {
     // Variable declarations and initializations
     // and type verifications.
-    size_t k1,k2,n1,n2,i; 
-    assert(n!=NULL && d!=NULL); llint epoch_counter=0;
+    size_t k1,k2,n1,n2,i,r;
+    assert(n!=NULL && d!=NULL && s!=NULL);
     double err_curr=1.0,err_prev=1.0,loss=0.0;
+    double gradient=0.0,now=0.0; int last=0;
     neural_net_t *nn=NULL; gsl_matrix *data=NULL;
+    training_session_t *ts=NULL; gsl_matrix_float *single=NULL;
     gsl_vector_view vector_input_row;
     gsl_vector_view vector_output_row;
 
     
     // Casting the given parameters into the corresponding
     // datatypes.The first one into a neural_net_t data
-    // structure and the second one into a gsl_matrix.
-    nn=NULL; nn=(neural_net_t *)n;
-    data=NULL; data=(gsl_matrix *)d;
+    // structure,the second one into a gsl_matrix and the
+    // third one into a training session.
+    nn=(neural_net_t *)n; data=(gsl_matrix *)d;
+    ts=(training_session_t *)s;
     
 
     // Retrieving a matrix view of the given dataset
@@ -678,35 +899,183 @@ void backpropagation(const void *n,const void *d)
     k1=0; k2=nn->config->signals; n1=data->size1;
     n2=data->size2-nn->config->signals;
     gsl_matrix_view D=gsl_matrix_submatrix(data,k1,k2,n1,n2);
+
+    // A single precision network is trained on a float
+    // copy of the dataset,made once for the whole session.
+    if (nn->config->precision==PRECISION_F32) { single=neural_float_narrow(data); }
     
     // Beginning the training process of the back-propagation
-    // algorithm.We stop the procedure when the maximum epoch
-    // limit or convergence limit has beenr reached. 
-    do
+    // algorithm.We stop the procedure when the epoch budget
+    // or convergence limit has been reached or when the stop
+    // flag of the session has been raised from outside.
+    while (ts->epoch<ts->epochs && !ts->stop)
     {
         // Calculate the current mse value and begin
-        // iterating over the given training dataset.
-        err_prev=mean_square_error_calculate(nn,&D,&data->size1);
-        for (i=0;i<data->size1;i++)
+        // iterating over the rows of the training view.
+        if (single!=NULL)
+        {
+            // The single precision network goes through the
+            // same epoch with its own float procedures.
+            err_prev=neural_float_error(nn,single,ts->index,ts->rows);
+            gradient=neural_float_epoch(nn,single,ts);
+        }
+        else { err_prev=view_error_calculate(nn,(gsl_matrix *)&D,ts->index,ts->rows); gradient=0.0; }
+        for (i=0;single==NULL && i<ts->rows;i++)
         {
             // Get the ith input row and fetch it into the
             // neural network using the forward_propagate procedure.
-            vector_input_row=gsl_matrix_row((gsl_matrix *)&X,i);
+            r=(ts->index==NULL ? i : ts->index[i]);
+            vector_input_row=gsl_matrix_row((gsl_matrix *)&X,r);
             forward_propagate(nn,&vector_input_row);
             
             // Get the ith output row and fetch it into the
             // neural network using the backward propagate procedure.
-            vector_output_row=gsl_matrix_row((gsl_matrix *)&D,i);
+            vector_output_row=gsl_matrix_row((gsl_matrix *)&D,r);
             backward_propagate(nn,&vector_input_row,&vector_output_row);
+            if (ts->on_row!=NULL) { ts->on_row(nn,ts,ts->row_arg); }
+            if (ts->gradients) { gradient+=gradient_calculate(nn,(gsl_vector *)&vector_input_row); }
         }
         
         // Retrieve the mean square error value after the current training
         // epoch and increment the epoch counter by one.Print the epoch
         // counter,current loss and the current mean square error into the
-        // standard output stream.
-        err_curr=mean_square_error_calculate(nn,&D,&data->size1); epoch_counter+=1; loss=fabs(err_curr-err_prev);
-        printf(CYN"EPOCHS"RESET" = %lld, "BLU"LOSS"RESET" = %g, "YEL"MSE"RESET" = %g\n",epoch_counter,loss,err_curr);
-    } while (loss>nn->config->epsilon && epoch_counter<nn->config->epochs);
+        // standard output stream unless the session is a quiet one or the
+        // previous line was printed less than an interval ago.The line of
+        // the last epoch is always printed.
+        if (single!=NULL) { err_curr=neural_float_error(nn,single,ts->index,ts->rows); }
+        else { err_curr=view_error_calculate(nn,(gsl_matrix *)&D,ts->index,ts->rows); }
+        ts->epoch+=1; loss=fabs(err_curr-err_prev);
+        ts->mse=err_curr; ts->loss=loss;
+        if (ts->gradients) { ts->gradient=sqrt(gradient/(double )ts->rows); }
+        last=(ts->epoch>=ts->epochs || loss<=nn->config->epsilon || ts->stop);
+        if (!ts->quiet)
+        {
+            now=telemetry_clock();
+            if (last || now-ts->printed>=ts->interval)
+            {
+                printf(CYN"EPOCHS"RESET" = %lld, "BLU"LOSS"RESET" = %g, "YEL"MSE"RESET" = %g\n",ts->epoch,loss,err_curr);
+                ts->printed=now;
+            }
+        }
+        if (ts->on_epoch!=NULL) { ts->on_epoch(nn,ts,ts->arg); }
+        if (loss<=nn->config->epsilon) { break; }
+    }
+    if (single!=NULL) { gsl_matrix_float_free(single); }
     return;
 }
 
+
+
+
+/*
+ * @COMPLEXITY: O(f(n))     Where f(n) is the time complexity
+ *                          of the backpropagation_session().
+ *
+ * The function backpropagation() takes two immutable
+ * pointers as arguments.The first one is cast into
+ * a neural_net_t pointer and the second one into
+ * a gsl_matrix pointer.It trains the network on every
+ * row of the given dataset using a fresh training
+ * session whose epoch budget is taken from the network's
+ * configuration.
+ *
+ * @param:  const void      *n
+ * @param:  const void      *d
+ * @return: void
+ * 
+ */
+
+void backpropagation(const void *n,const void *d)
+{
+    training_session_t ts;
+    assert(n!=NULL && d!=NULL);
+    training_session_init(&ts,(neural_net_t *)n,(gsl_matrix *)d);
+    backpropagation_session(n,d,&ts);
+    return;
+}
+
+
+
+
+
+/*
+ * @COMPLEXITY: O(m*n)      Where ( m x n ) are the dimensions of the
+ *                          largest synaptic weights matrix,paid by the
+ *                          child process only.
+ *
+ * The function checkpoint_epoch() is an epoch function for the
+ * training session whose user data is a checkpoint_t data structure.
+ * Every given number of epochs it forks a child process that writes
+ * the copy-on-write snapshot of the network into the checkpoint
+ * directory and exits,while the parent carries on training.If the
+ * previous writer is still running the checkpoint is deferred,and
+ * if the process cannot be forked the checkpoint is written in place.
+ *
+ * @param:  const void      *n
+ * @param:  const void      *s
+ * @param:  void            *arg
+ * @return: void
+ *
+ */
+
+void checkpoint_epoch(const void *n,const void *s,void *arg)
+{
+    // Variable declarations,type
+    // assertions and castings.
+    pid_t pid; int status;
+    assert(n!=NULL && s!=NULL);
+    neural_net_t *nn=(neural_net_t *)n;
+    training_session_t *ts=(training_session_t *)s;
+    checkpoint_t *cp=(checkpoint_t *)arg;
+    assert(cp!=NULL && cp->every>0);
+
+    // Checking whether a checkpoint is due,either
+    // by the epoch counter or because it was deferred.
+    if (ts->epoch%cp->every!=0 && !cp->deferred) { return; }
+
+    // Reaping the previous writer.If it is still
+    // running the checkpoint is deferred.
+    if (cp->child>0)
+    {
+        if (waitpid(cp->child,&status,WNOHANG)==0) { cp->deferred=1; return; }
+        if (!WIFEXITED(status) || WEXITSTATUS(status)!=0) { fprintf(stderr,"Checkpoint writer failed for %s.\n",cp->directory); }
+        cp->child=0;
+    }
+
+    // Forking the writer.The child process sees the network
+    // as it is right now and exits without flushing the stdio
+    // buffers it shares with the parent.
+    cp->deferred=0; cp->written++;
+    fflush(NULL);
+    pid=fork();
+    if (pid==0) { _exit(neural_net_checkpoint(nn,cp->directory,ts->epoch)==0 ? 0 : 1); }
+    if (pid<0)  { neural_net_checkpoint(nn,cp->directory,ts->epoch); return; }
+    cp->child=pid;
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function checkpoint_finish() takes one argument as parameter,
+ * namely a checkpoint data structure,and waits for the writer that is
+ * still in flight.It returns zero if the last checkpoint was written
+ * successfully and a non-zero value otherwise.
+ *
+ * @param:  checkpoint_t    *cp
+ * @return: int
+ *
+ */
+
+int checkpoint_finish(checkpoint_t *cp)
+{
+    int status=0;
+    assert(cp!=NULL);
+    if (cp->child<=0) { return 0; }
+    if (waitpid(cp->child,&status,0)<0) { return -1; }
+    cp->child=0;
+    return (WIFEXITED(status) && WEXITSTATUS(status)==0 ? 0 : 1);
+}
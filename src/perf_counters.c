@@ -0,0 +1,248 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * hardware performance counters.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the string
+ * manipulation library,the unix standard symbolic
+ * constants library,the linux perf events and
+ * system call interfaces and the header file
+ * "perf_counters.h" that contains datatype
+ * definitions and function prototypings regarding
+ * the hardware performance counters.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <unistd.h>
+#include "perf_counters.h"
+
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+
+
+
+/*
+ * The names of the counted events,in the
+ * order of the macros of perf_counters.h.
+ *
+ */
+
+static const char *event_names[PERF_EVENTS]={ "cycles","instructions","L1D misses","LLC misses","branch misses" };
+
+
+
+
+#ifdef __linux__
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The static function event_open() opens a single event that counts
+ * the calling thread in user space only.The event is added to the
+ * group of the given leader,or leads a new group if the leader is -1.
+ * The file descriptor is returned,or -1 on failure.
+ *
+ */
+
+static int event_open(uint32_t type,uint64_t config,int leader)
+{
+    struct perf_event_attr attr;
+    memset(&attr,0,sizeof(attr));
+    attr.size=sizeof(attr); attr.type=type; attr.config=config;
+    attr.disabled=(leader==-1); attr.inherit=0;
+    attr.exclude_kernel=1; attr.exclude_hv=1;
+    attr.read_format=PERF_FORMAT_GROUP|PERF_FORMAT_ID|PERF_FORMAT_TOTAL_TIME_ENABLED|PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int )syscall(SYS_perf_event_open,&attr,0,-1,leader,0);
+}
+#endif
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function perf_counters_open() opens the group of counted events
+ * for the calling thread.If the cycles counter cannot be opened,because
+ * the kernel is not a linux one or perf_event_paranoid forbids it,NULL is
+ * returned.The other events are optional and are left out if unavailable.
+ *
+ * @param:  void
+ * @return: perf_counters_t *
+ *
+ */
+
+perf_counters_t *perf_counters_open(void)
+{
+#ifdef __linux__
+    // The event types and configurations in
+    // the order of the macros of perf_counters.h.
+    static const uint32_t types[PERF_EVENTS]=
+    {
+        PERF_TYPE_HARDWARE,PERF_TYPE_HARDWARE,PERF_TYPE_HW_CACHE,PERF_TYPE_HW_CACHE,PERF_TYPE_HARDWARE
+    };
+    static const uint64_t configs[PERF_EVENTS]=
+    {
+        PERF_COUNT_HW_CPU_CYCLES,PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_L1D|(PERF_COUNT_HW_CACHE_OP_READ<<8)|(PERF_COUNT_HW_CACHE_RESULT_MISS<<16),
+        PERF_COUNT_HW_CACHE_LL|(PERF_COUNT_HW_CACHE_OP_READ<<8)|(PERF_COUNT_HW_CACHE_RESULT_MISS<<16),
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+    perf_counters_t *pc=NULL; size_t e;
+
+    // Opening the cycles counter as the group
+    // leader and the rest of the events in it.
+    pc=(perf_counters_t *)malloc(sizeof(*pc));
+    assert(pc!=NULL);
+    memset(pc->values,0,sizeof(pc->values));
+    for (e=0;e<PERF_EVENTS;e++)
+    {
+        pc->fd[e]=event_open(types[e],configs[e],e==0 ? -1 : pc->fd[0]);
+        pc->id[e]=0;
+        if (pc->fd[e]==-1 && e==0) { free(pc); return NULL; }
+        if (pc->fd[e]!=-1) { ioctl(pc->fd[e],PERF_EVENT_IOC_ID,&pc->id[e]); }
+    } return pc;
+#else
+    return NULL;
+#endif
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function perf_counters_start() resets the counters of the
+ * group and starts counting.
+ *
+ * @param:  perf_counters_t     *pc
+ * @return: void
+ *
+ */
+
+void perf_counters_start(perf_counters_t *pc)
+{
+    assert(pc!=NULL);
+#ifdef __linux__
+    ioctl(pc->fd[0],PERF_EVENT_IOC_RESET,PERF_IOC_FLAG_GROUP);
+    ioctl(pc->fd[0],PERF_EVENT_IOC_ENABLE,PERF_IOC_FLAG_GROUP);
+#endif
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function perf_counters_stop() stops counting and reads the
+ * counts of the group into the values of the data structure.If the
+ * kernel had to multiplex the group with other users of the counters
+ * the counts are scaled up to the whole time the group was enabled.
+ *
+ * @param:  perf_counters_t     *pc
+ * @return: void
+ *
+ */
+
+void perf_counters_stop(perf_counters_t *pc)
+{
+    assert(pc!=NULL);
+#ifdef __linux__
+    // The group read format: the number of events,
+    // the enabled and running times and a value and
+    // identifier pair per event.
+    uint64_t buffer[3+2*PERF_EVENTS]; size_t e,i,n;
+    double scale=1.0;
+    ioctl(pc->fd[0],PERF_EVENT_IOC_DISABLE,PERF_IOC_FLAG_GROUP);
+    memset(pc->values,0,sizeof(pc->values));
+    if (read(pc->fd[0],buffer,sizeof(buffer))<(ssize_t )(3*sizeof(uint64_t ))) { return; }
+    if (buffer[2]>0 && buffer[2]<buffer[1]) { scale=(double )buffer[1]/(double )buffer[2]; }
+    n=(buffer[0]<PERF_EVENTS ? buffer[0] : PERF_EVENTS);
+    for (i=0;i<n;i++)
+    {
+        for (e=0;e<PERF_EVENTS;e++)
+        {
+            if (pc->fd[e]!=-1 && pc->id[e]==buffer[3+2*i+1]) { pc->values[e]=(uint64_t )((double )buffer[3+2*i]*scale); }
+        }
+    }
+#endif
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function perf_counters_print() writes the counts of the last
+ * measured phase into the given stream,together with the instructions
+ * per cycle and every count divided by the given number of samples,the
+ * rows the phase went through.Unavailable events are printed as n/a.
+ *
+ * @param:  FILE                *f
+ * @param:  perf_counters_t     *pc
+ * @param:  char                *phase
+ * @param:  double              samples
+ * @return: void
+ *
+ */
+
+void perf_counters_print(FILE *f,perf_counters_t *pc,char *phase,double samples)
+{
+    size_t e;
+    assert(f!=NULL && pc!=NULL && phase!=NULL);
+    if (samples<1.0) { samples=1.0; }
+    fprintf(f,"PERF %-12s",phase);
+    if (pc->fd[PERF_INSTRUCTIONS]!=-1 && pc->values[PERF_CYCLES]>0)
+    {
+        fprintf(f," IPC = %.3f,",(double )pc->values[PERF_INSTRUCTIONS]/(double )pc->values[PERF_CYCLES]);
+    }
+    for (e=0;e<PERF_EVENTS;e++)
+    {
+        if (pc->fd[e]==-1) { fprintf(f," %s = n/a%s",event_names[e],e+1<PERF_EVENTS ? "," : "\n"); continue; }
+        fprintf(f," %s = %llu ( %.2f/sample )%s",event_names[e],(unsigned long long )pc->values[e],
+                (double )pc->values[e]/samples,e+1<PERF_EVENTS ? "," : "\n");
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function perf_counters_close() closes the events of the
+ * group and deallocates the data structure.
+ *
+ * @param:  perf_counters_t     *pc
+ * @return: void
+ *
+ */
+
+void perf_counters_close(perf_counters_t *pc)
+{
+    size_t e;
+    assert(pc!=NULL);
+    for (e=PERF_EVENTS;e>0;e--) { if (pc->fd[e-1]!=-1) { close(pc->fd[e-1]); } }
+    free(pc); return;
+}
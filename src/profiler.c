@@ -0,0 +1,230 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * per-layer profiler of the training
+ * and predicting procedures.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library and the header
+ * file "profiler.h" that contains datatype definitions
+ * and function prototypings regarding the profiler.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include "profiler.h"
+
+
+
+
+/*
+ * Defining a new data structure called profile_event_t
+ * that holds a single region of the chrome trace,and the
+ * state of the profiler.The counters are updated with
+ * atomic additions since the cross validation folds and
+ * the search trials train on several threads at once.
+ *
+ */
+
+typedef struct
+{
+    uint64_t            start;          // The time stamp the region started at.
+    uint64_t            duration;       // The duration of the region in nanoseconds.
+    uint64_t            bytes;          // The number of bytes touched by the region.
+    uint32_t            tid;            // The profiler identifier of the thread.
+    uint16_t            phase;          // The phase of the region.
+    uint16_t            layer;          // The layer slot of the region.
+} profile_event_t;
+
+int                     profiler_enabled=0;
+static uint64_t         nanos[PROFILE_PHASES][PROFILE_LAYERS];
+static uint64_t         calls[PROFILE_PHASES][PROFILE_LAYERS];
+static uint64_t         bytes[PROFILE_PHASES][PROFILE_LAYERS];
+static uint64_t         origin=0;
+static profile_event_t  *events=NULL;
+static size_t           capacity=0;
+static size_t           recorded=0;
+static uint32_t         threads=0;
+static __thread uint32_t thread_id=0;
+static char             *trace_file=NULL;
+static const char       *phase_names[PROFILE_PHASES]={ "forward","delta","update","error" };
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function profiler_clock() returns the number of nanoseconds
+ * elapsed on the monotonic clock.It never returns zero,which the
+ * hooks use to tell that the profiler is off.
+ *
+ * @param:  void
+ * @return: uint64_t
+ *
+ */
+
+uint64_t profiler_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return (uint64_t )ts.tv_sec*1000000000ULL+(uint64_t )ts.tv_nsec+1;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function profiler_record() accounts a finished region to the
+ * given phase and layer and appends it to the chrome trace if one is
+ * being recorded and there is room left in the event buffer.
+ *
+ * @param:  int         phase
+ * @param:  size_t      layer
+ * @param:  uint64_t    start
+ * @param:  size_t      n
+ * @return: void
+ *
+ */
+
+void profiler_record(int phase,size_t layer,uint64_t start,size_t n)
+{
+    uint64_t duration=profiler_clock()-start; size_t e;
+    if (layer>=PROFILE_LAYERS) { layer=PROFILE_LAYERS-1; }
+    __atomic_fetch_add(&nanos[phase][layer],duration,__ATOMIC_RELAXED);
+    __atomic_fetch_add(&calls[phase][layer],1,__ATOMIC_RELAXED);
+    __atomic_fetch_add(&bytes[phase][layer],n,__ATOMIC_RELAXED);
+    if (events==NULL) { return; }
+
+    if (thread_id==0) { thread_id=__atomic_add_fetch(&threads,1,__ATOMIC_RELAXED); }
+    e=__atomic_fetch_add(&recorded,1,__ATOMIC_RELAXED);
+    if (e>=capacity) { return; }
+    events[e].start=start; events[e].duration=duration;
+    events[e].bytes=n; events[e].tid=thread_id;
+    events[e].phase=(uint16_t )phase; events[e].layer=(uint16_t )layer;
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of recorded events.
+ *
+ * The static function trace_write() writes the recorded regions into
+ * the given file in the chrome trace event format,that is loaded by
+ * chrome://tracing and by the perfetto user interface.
+ *
+ */
+
+static void trace_write(char *filename)
+{
+    size_t i,n=(recorded<capacity ? recorded : capacity);
+    FILE *f=fopen(filename,"w");
+    if (f==NULL) { fprintf(stderr,"Could not open the trace file %s.\n",filename); return; }
+    fprintf(f,"{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for (i=0;i<n;i++)
+    {
+        fprintf(f,"{\"name\":\"%s L%u\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"layer\":%u,\"bytes\":%llu}}%s\n",
+                phase_names[events[i].phase],events[i].layer,phase_names[events[i].phase],(double )(events[i].start-origin)/1e3,
+                (double )events[i].duration/1e3,events[i].tid,events[i].layer,(unsigned long long )events[i].bytes,i+1<n ? "," : "");
+    } fprintf(f,"]}\n"); fclose(f);
+    if (recorded>capacity) { fprintf(stderr,"The trace kept the first %zu of %zu regions.\n",capacity,recorded); }
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(p*l)      Where p is the number of phases and
+ *                          l the number of layer slots.
+ *
+ * The function profiler_report() writes a summary of the profiled
+ * regions into the given stream: the number of calls,the total time,
+ * its share of the profiled time,the time per call and the bandwidth
+ * of every phase and layer that was entered at least once.
+ *
+ * @param:  FILE    *f
+ * @return: void
+ *
+ */
+
+void profiler_report(FILE *f)
+{
+    size_t p,l; uint64_t total=0;
+    for (p=0;p<PROFILE_PHASES;p++) { for (l=0;l<PROFILE_LAYERS;l++) { total+=nanos[p][l]; } }
+    fprintf(f,"\n%-8s %6s %14s %12s %8s %12s %10s\n","PHASE","LAYER","CALLS","TOTAL ms","TIME %","ns/CALL","GB/s");
+    for (p=0;p<PROFILE_PHASES;p++)
+    {
+        for (l=0;l<PROFILE_LAYERS;l++)
+        {
+            if (calls[p][l]==0) { continue; }
+            fprintf(f,"%-8s %6zu %14llu %12.3f %8.2f %12.1f %10.3f\n",phase_names[p],l,(unsigned long long )calls[p][l],
+                    (double )nanos[p][l]/1e6,total>0 ? 100.0*(double )nanos[p][l]/(double )total : 0.0,
+                    (double )nanos[p][l]/(double )calls[p][l],nanos[p][l]>0 ? (double )bytes[p][l]/(double )nanos[p][l] : 0.0);
+        }
+    } return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of recorded events.
+ *
+ * The static function profiler_exit() is registered with atexit() and
+ * prints the summary into the standard error stream and writes the trace.
+ *
+ */
+
+static void profiler_exit(void)
+{
+    profiler_enabled=0;
+    profiler_report(stderr);
+    if (trace_file!=NULL) { trace_write(trace_file); }
+    free(events); events=NULL;
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function profiler_enable() switches the profiler on.If a trace
+ * file name is given the regions are also recorded into a preallocated
+ * event buffer and written into it in the chrome trace event format.The
+ * summary and the trace are written when the program exits.
+ *
+ * @param:  char    *trace
+ * @return: void
+ *
+ */
+
+void profiler_enable(char *trace)
+{
+    if (profiler_enabled) { return; }
+    if (trace!=NULL)
+    {
+        capacity=1<<20; trace_file=trace;
+        events=(profile_event_t *)malloc(capacity*sizeof(profile_event_t ));
+        assert(events!=NULL);
+    }
+    origin=profiler_clock(); profiler_enabled=1;
+    atexit(profiler_exit);
+    return;
+}
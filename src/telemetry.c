@@ -0,0 +1,221 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * training telemetry data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the string
+ * manipulation library,the time library for the
+ * monotonic clock and the header file "telemetry.h"
+ * that contains datatype definitions and function
+ * prototypings regarding the telemetry data structure.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <time.h>
+#include "telemetry.h"
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function telemetry_clock() returns the number of seconds
+ * elapsed on the monotonic clock.It is only meaningful as the
+ * difference of two readings.
+ *
+ * @param:  void
+ * @return: double
+ *
+ */
+
+double telemetry_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return (double )ts.tv_sec+(double )ts.tv_nsec*1e-9;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(n)    Where n is the given interval.
+ *
+ * The function telemetry_create() takes two arguments as parameters.
+ * The first one is the target of the telemetry,either a file path or
+ * "fd:<number>" for an already opened file descriptor,and the second
+ * one is the number of epochs that are buffered before being written
+ * out.If the target cannot be opened NULL is returned.
+ *
+ * @param:  char        *target
+ * @param:  size_t      interval
+ * @return: telemetry_t *
+ *
+ */
+
+telemetry_t *telemetry_create(char *target,size_t interval)
+{
+    // Variable declarations
+    // and type assertions.
+    FILE *f=NULL; int owned=1;
+    telemetry_t *tm=NULL;
+    assert(target!=NULL && interval>0);
+
+    // Opening the target stream.A file descriptor
+    // is wrapped into a stream that is not closed
+    // when the telemetry is freed.
+    if (strncmp(target,"fd:",3)==0) { f=fdopen(atoi(&target[3]),"w"); owned=0; }
+    else { f=fopen(target,"w"); }
+    if (f==NULL) { return NULL; }
+
+    // Allocating the telemetry and its buffer
+    // of records and initializing the rest of
+    // the components.
+    tm=(telemetry_t *)malloc(sizeof(*tm));
+    assert(tm!=NULL);
+    tm->records=(telemetry_record_t *)malloc(interval*sizeof(telemetry_record_t ));
+    assert(tm->records!=NULL);
+    tm->capacity=interval; tm->count=0;
+    tm->stream=f; tm->owned=owned;
+    tm->stamp=telemetry_clock();
+    tm->next=NULL; tm->next_arg=NULL;
+    return tm;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function telemetry_attach() takes two arguments as parameters,
+ * namely a telemetry data structure and a training session.It installs
+ * the telemetry as the epoch function of the session,chaining the epoch
+ * function that was installed before,and asks the session to measure
+ * the gradient norm of every epoch.
+ *
+ * @param:  telemetry_t         *tm
+ * @param:  training_session_t  *ts
+ * @return: void
+ *
+ */
+
+void telemetry_attach(telemetry_t *tm,training_session_t *ts)
+{
+    assert(tm!=NULL && ts!=NULL);
+    tm->next=ts->on_epoch; tm->next_arg=ts->arg;
+    ts->on_epoch=telemetry_epoch; ts->arg=tm;
+    ts->gradients=1; tm->stamp=telemetry_clock();
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)    Amortized,writing the buffer costs
+ *                          O(n) once every n epochs.
+ *
+ * The function telemetry_epoch() is an epoch function for the training
+ * session whose user data is a telemetry data structure.It stores the
+ * metrics of the finished epoch into the next free record,writes the
+ * buffer out once it is full and invokes the chained epoch function.
+ *
+ * @param:  const void      *n
+ * @param:  const void      *s
+ * @param:  void            *arg
+ * @return: void
+ *
+ */
+
+void telemetry_epoch(const void *n,const void *s,void *arg)
+{
+    // Variable declarations,type
+    // assertions and castings.
+    double now=telemetry_clock();
+    telemetry_record_t *r=NULL;
+    assert(n!=NULL && s!=NULL && arg!=NULL);
+    neural_net_t *nn=(neural_net_t *)n;
+    training_session_t *ts=(training_session_t *)s;
+    telemetry_t *tm=(telemetry_t *)arg;
+
+    // Filling in the next record of the buffer.
+    r=&tm->records[tm->count++];
+    r->epoch=ts->epoch; r->seconds=now-tm->stamp;
+    r->throughput=(r->seconds>0.0 ? (double )ts->rows/r->seconds : 0.0);
+    r->loss=ts->loss; r->mse=ts->mse;
+    r->eta=nn->config->eta; r->gradient=ts->gradient;
+    if (tm->count==tm->capacity) { telemetry_flush(tm); }
+
+    // Invoking the chained epoch function and starting
+    // the clock of the next epoch once it has returned.
+    if (tm->next!=NULL) { tm->next(n,s,tm->next_arg); }
+    tm->stamp=telemetry_clock();
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of buffered records.
+ *
+ * The function telemetry_flush() writes the buffered records into
+ * the telemetry stream,one JSON object per line,and empties the buffer.
+ *
+ * @param:  telemetry_t     *tm
+ * @return: void
+ *
+ */
+
+void telemetry_flush(telemetry_t *tm)
+{
+    size_t i; telemetry_record_t *r=NULL;
+    assert(tm!=NULL);
+    for (i=0;i<tm->count;i++)
+    {
+        r=&tm->records[i];
+        fprintf(tm->stream,"{\"epoch\":%lld,\"seconds\":%.9g,\"samples_per_sec\":%.9g,\"loss\":%.9g,\"mse\":%.9g,\"eta\":%.9g,\"grad_norm\":%.9g}\n",
+                r->epoch,r->seconds,r->throughput,r->loss,r->mse,r->eta,r->gradient);
+    } fflush(tm->stream); tm->count=0;
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(n)    Where n is the number of buffered records.
+ *
+ * The function telemetry_free() writes out the records that are
+ * still buffered and deallocates all memory blocks associated with
+ * the telemetry data structure.The stream is closed if it was opened
+ * by telemetry_create() from a file path.
+ *
+ * @param:  telemetry_t     *tm
+ * @return: void
+ *
+ */
+
+void telemetry_free(telemetry_t *tm)
+{
+    assert(tm!=NULL);
+    telemetry_flush(tm);
+    if (tm->owned) { fclose(tm->stream); }
+    free(tm->records); free(tm);
+    return;
+}
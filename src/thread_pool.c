@@ -0,0 +1,273 @@
+/*
+ * This file contains the definitions
+ * of the procedures regarding the
+ * thread pool data structure.
+ *
+ * @author: Endri Kastrati
+ * @date:   19/10/2026
+ *
+ */
+
+
+
+
+/*
+ * Including the standard utilities library,
+ * the standard assertions library,the unix
+ * standard symbolic constants library and the
+ * header file "thread_pool.h" that contains
+ * datatype definitions and function prototypings
+ * regarding the thread pool data structure.
+ *
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <unistd.h>
+#include "thread_pool.h"
+
+
+
+
+/*
+ * @COMPLEXITY: O(t)    Where t is the total number of
+ *                      tasks executed by the worker.
+ *
+ * The static function worker_loop() is the entry point of
+ * every worker thread.It blocks on the ready condition until
+ * a task has been queued,pops it from the head of the queue
+ * and runs it outside of the lock.Once the task returns the
+ * pending counter is decremented and waiters are woken up
+ * when no more work is outstanding.The loop exits when the
+ * pool is shutting down and the queue has been drained.
+ *
+ * @param:  void    *p
+ * @return: void    *
+ *
+ */
+
+static void *worker_loop(void *p)
+{
+    thread_pool_t *tp=(thread_pool_t *)p;
+    task_t *task=NULL;
+
+    for (;;)
+    {
+        // Waiting until there is a task in the
+        // queue or the pool is being destroyed.
+        pthread_mutex_lock(&tp->lock);
+        while (tp->head==NULL && !tp->shutdown) { pthread_cond_wait(&tp->ready,&tp->lock); }
+        if (tp->head==NULL && tp->shutdown) { pthread_mutex_unlock(&tp->lock); break; }
+
+        // Popping the first task of the queue.
+        task=tp->head; tp->head=task->next;
+        if (tp->head==NULL) { tp->tail=NULL; }
+        pthread_mutex_unlock(&tp->lock);
+
+        // Running the task without holding the lock
+        // and releasing the memory of the queue node,
+        // unless it belongs to the thread that posted it.
+        task->fn(task->arg);
+        if (!task->owned) { free(task); }
+
+        // Decrementing the pending counter and waking
+        // up the threads that wait for the pool to idle.
+        pthread_mutex_lock(&tp->lock);
+        if (--tp->pending==0) { pthread_cond_broadcast(&tp->done); }
+        pthread_mutex_unlock(&tp->lock);
+    } return NULL;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(w)    Where w is the number of worker threads.
+ *
+ * The function thread_pool_create() takes one argument as
+ * parameter,namely the number of worker threads,and creates
+ * a new thread pool data structure whose workers are started
+ * immediately and block until tasks are submitted.A value of
+ * zero creates one worker per online processor.
+ *
+ * @param:  size_t              nworkers
+ * @return: thread_pool_t       *
+ *
+ */
+
+thread_pool_t *thread_pool_create(size_t nworkers)
+{
+    size_t i; int status;
+    thread_pool_t *new_tp=NULL;
+    if (nworkers==0) { nworkers=thread_pool_cpus(); }
+
+    // Allocating memory for the pool and its
+    // workers array and initializing the queue.
+    new_tp=(thread_pool_t *)malloc(sizeof(*new_tp));
+    assert(new_tp!=NULL);
+    new_tp->workers=(pthread_t *)malloc(nworkers*sizeof(pthread_t ));
+    assert(new_tp->workers!=NULL);
+    new_tp->nworkers=nworkers;
+    new_tp->head=NULL; new_tp->tail=NULL;
+    new_tp->pending=0; new_tp->shutdown=0;
+    pthread_mutex_init(&new_tp->lock,NULL);
+    pthread_cond_init(&new_tp->ready,NULL);
+    pthread_cond_init(&new_tp->done,NULL);
+
+    // Starting the worker threads.
+    for (i=0;i<nworkers;i++)
+    {
+        status=pthread_create(&new_tp->workers[i],NULL,worker_loop,new_tp);
+        assert(status==0);
+    }
+
+    return new_tp;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function thread_pool_submit() takes three arguments
+ * as parameters,namely a thread pool data structure,a task
+ * function and its argument,and appends the task to the
+ * tail of the queue waking up one idle worker.
+ *
+ * @param:  thread_pool_t       *tp
+ * @param:  TaskFn              fn
+ * @param:  void                *arg
+ * @return: void
+ *
+ */
+
+void thread_pool_submit(thread_pool_t *tp,TaskFn fn,void *arg)
+{
+    task_t *task=NULL;
+    assert(tp!=NULL && fn!=NULL);
+    task=(task_t *)malloc(sizeof(*task));
+    assert(task!=NULL);
+    task->fn=fn; task->arg=arg; task->next=NULL; task->owned=0;
+
+    pthread_mutex_lock(&tp->lock);
+    if (tp->tail==NULL) { tp->head=task; }
+    else                { tp->tail->next=task; }
+    tp->tail=task; tp->pending++;
+    pthread_cond_signal(&tp->ready);
+    pthread_mutex_unlock(&tp->lock);
+    return;
+}
+
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function thread_pool_post() takes two arguments as
+ * parameters,namely a thread pool data structure and a task
+ * whose function and argument have been filled in by the caller,
+ * and appends it to the tail of the queue waking up one idle
+ * worker.The task is not copied,so it must stay alive until
+ * thread_pool_wait() returns,after which it may be posted again.
+ *
+ * @param:  thread_pool_t       *tp
+ * @param:  task_t              *task
+ * @return: void
+ *
+ */
+
+void thread_pool_post(thread_pool_t *tp,task_t *task)
+{
+    assert(tp!=NULL && task!=NULL && task->fn!=NULL);
+    task->next=NULL; task->owned=1;
+    pthread_mutex_lock(&tp->lock);
+    if (tp->tail==NULL) { tp->head=task; }
+    else                { tp->tail->next=task; }
+    tp->tail=task; tp->pending++;
+    pthread_cond_signal(&tp->ready);
+    pthread_mutex_unlock(&tp->lock);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(t)    Where t is the number of outstanding tasks.
+ *
+ * The function thread_pool_wait() takes one argument as
+ * parameter,namely a thread pool data structure,and blocks
+ * the calling thread until every submitted task has finished.
+ *
+ * @param:  thread_pool_t       *tp
+ * @return: void
+ *
+ */
+
+void thread_pool_wait(thread_pool_t *tp)
+{
+    assert(tp!=NULL);
+    pthread_mutex_lock(&tp->lock);
+    while (tp->pending>0) { pthread_cond_wait(&tp->done,&tp->lock); }
+    pthread_mutex_unlock(&tp->lock);
+    return;
+}
+
+
+
+
+/*
+ * @COMPLEXITY: Theta(1)
+ *
+ * The function thread_pool_cpus() takes no arguments
+ * and returns the number of online processors,or one
+ * if that number cannot be determined.
+ *
+ * @param:  void
+ * @return: size_t
+ *
+ */
+
+size_t thread_pool_cpus(void)
+{
+    long ncpus=sysconf(_SC_NPROCESSORS_ONLN);
+    return (ncpus>0 ? (size_t )ncpus : 1);
+}
+
+
+
+
+/*
+ * @COMPLEXITY: O(w)    Where w is the number of worker threads.
+ *
+ * The function thread_pool_free() takes one argument as
+ * parameter,namely a thread pool data structure.It waits
+ * for the queued tasks to finish,joins the worker threads
+ * and deallocates all memory associated with the pool.
+ *
+ * @param:  thread_pool_t       *tp
+ * @return: void
+ *
+ */
+
+void thread_pool_free(thread_pool_t *tp)
+{
+    size_t i;
+    assert(tp!=NULL);
+    thread_pool_wait(tp);
+
+    pthread_mutex_lock(&tp->lock);
+    tp->shutdown=1;
+    pthread_cond_broadcast(&tp->ready);
+    pthread_mutex_unlock(&tp->lock);
+
+    for (i=0;i<tp->nworkers;i++) { pthread_join(tp->workers[i],NULL); }
+    pthread_mutex_destroy(&tp->lock);
+    pthread_cond_destroy(&tp->ready);
+    pthread_cond_destroy(&tp->done);
+    free(tp->workers); free(tp); tp=NULL;
+    return;
+}